@@ -32,7 +32,7 @@ export class AppComponent implements OnInit, OnDestroy {
   speed: number = 0;
   speedLimit: number = 255;
   ip: string = '127.0.0.1';
-  realSpeed: number = 0;
+  realSpeed: number | null = null;
   COMPONENT_TYPE = ComponentType;
   private webSocket: WebSocket;
 
@@ -76,12 +76,22 @@ export class AppComponent implements OnInit, OnDestroy {
 
     this.webSocket.onopen = () => {
       console.log('WebSocket connected');
+      // the measured speed is only broadcast when it changes, so fetch the current one
+      this.subscriptions.push(
+        this.http.get('getRealSpeed', {responseType: "text"}).subscribe((value) => {
+          this.setRealSpeed(value);
+        })
+      )
     };
 
     this.webSocket.onmessage = (event) => {
       console.log('Received message:', event.data);
-      this.realSpeed = event.data;
-      this.speed = this.mapValueTo100(this.realSpeed);
+      const data = String(event.data);
+      if (data.startsWith('real:')) {
+        this.setRealSpeed(data.substring(5));
+      } else {
+        this.speed = this.mapValueTo100(Number(data));
+      }
     };
 
     this.webSocket.onclose = () => {
@@ -89,6 +99,11 @@ export class AppComponent implements OnInit, OnDestroy {
     };
   }
 
+  // measured speed from the back-EMF sensing, "unknown" when it can't be measured
+  private setRealSpeed(value: string): void {
+    this.realSpeed = value === 'unknown' ? null : Number(value);
+  }
+
   private unsubscribeAll(): void {
     this.subscriptions.forEach(s => s.unsubscribe())
   }
@@ -104,8 +119,7 @@ export class AppComponent implements OnInit, OnDestroy {
   }
 
   changeSpeed(): void {
-    this.realSpeed = this.mapValueTo255(this.speed)
-    const url = `/config?speed=${String(this.realSpeed)}`
+    const url = `/config?speed=${String(this.mapValueTo255(this.speed))}`
     this.http.get(url, {responseType: 'text'}).subscribe((next) => {
       console.log('HTTP request successful:', next);
     })
@@ -5,4 +5,4 @@ ${n.map((r,i)=>`${i+1}) ${r.toString()}`).join(`
 `+t.message,i,n,r),t[hg]=i,t[wi]=null,t}function Dg(t,e,n,r=null){t=t&&t.charAt(0)===`
 `&&t.charAt(1)==gg?t.slice(2):t;let i=se(e);if(Array.isArray(e))i=e.map(se).join(" -> ");else if(typeof e=="object"){let o=[];for(let s in e)if(e.hasOwnProperty(s)){let a=e[s];o.push(s+":"+(typeof a=="string"?JSON.stringify(a):se(a)))}i=`{${o.join(", ")}}`}return`${n}${r?"("+r+")":""}[${i}]: ${t.replace(pg,`
   `)}`}function tr(t){return{toString:t}.toString()}var Ll=function(t){return t[t.OnPush=0]="OnPush",t[t.Default=1]="Default",t}(Ll||{}),Re=function(t){return t[t.Emulated=0]="Emulated",t[t.None=2]="None",t[t.ShadowDom=3]="ShadowDom",t}(Re||{}),ln={},ge=[];function Vl(t,e,n){let r=t.length;for(;;){let i=t.indexOf(e,n);if(i===-1)return i;if(i===0||t.charCodeAt(i-1)<=32){let o=e.length;if(i+o===r||t.charCodeAt(i+o)<=32)return i}n=i+1}}function Ts(t,e,n){let r=0;for(;r<n.length;){let i=n[r];if(typeof i=="number"){if(i!==0)break;r++;let o=n[r++],s=n[r++],a=n[r++];t.setAttribute(e,s,a,o)}else{let o=i,s=n[++r];wg(o)?t.setProperty(e,o,s):t.setAttribute(e,o,s),r++}}return r}function Cg(t){return t===3||t===4||t===6}function wg(t){return t.charCodeAt(0)===64}function Gn(t,e){if(!(e===null||e.length===0))if(t===null||t.length===0)t=e.slice();else{let n=-1;for(let r=0;r<e.length;r++){let i=e[r];typeof i=="number"?n=i:n===0||(n===-1||n===2?Kc(t,n,i,null,e[++r]):Kc(t,n,i,null,null))}}return t}function Kc(t,e,n,r,i){let o=0,s=t.length;if(e===-1)s=-1;else for(;o<t.length;){let a=t[o++];if(typeof a=="number"){if(a===e){s=-1;break}else if(a>e){s=o-1;break}}}for(;o<t.length;){let a=t[o];if(typeof a=="number")break;if(a===n){if(r===null){i!==null&&(t[o+1]=i);return}else if(r===t[o+1]){t[o+2]=i;return}}o++,r!==null&&o++,i!==null&&o++}s!==-1&&(t.splice(s,0,e),o=s+1),t.splice(o++,0,n),r!==null&&t.splice(o++,0,r),i!==null&&t.splice(o++,0,i)}var jl="ng-template";function Eg(t,e,n){let r=0,i=!0;for(;r<t.length;){let o=t[r++];if(typeof o=="string"&&i){let s=t[r++];if(n&&o==="class"&&Vl(s.toLowerCase(),e,0)!==-1)return!0}else if(o===1){for(;r<t.length&&typeof(o=t[r++])=="string";)if(o.toLowerCase()===e)return!0;return!1}else typeof o=="number"&&(i=!1)}return!1}function $l(t){return t.type===4&&t.value!==jl}function bg(t,e,n){let r=t.type===4&&!n?jl:t.value;return e===r}function Ig(t,e,n){let r=4,i=t.attrs||[],o=Sg(i),s=!1;for(let a=0;a<e.length;a++){let u=e[a];if(typeof u=="number"){if(!s&&!De(r)&&!De(u))return!1;if(s&&De(u))continue;s=!1,r=u|r&1;continue}if(!s)if(r&4){if(r=2|r&1,u!==""&&!bg(t,u,n)||u===""&&e.length===1){if(De(r))return!1;s=!0}}else{let c=r&8?u:e[++a];if(r&8&&t.attrs!==null){if(!Eg(t.attrs,c,n)){if(De(r))return!1;s=!0}continue}let l=r&8?"class":u,d=Mg(l,i,$l(t),n);if(d===-1){if(De(r))return!1;s=!0;continue}if(c!==""){let f;d>o?f="":f=i[d+1].toLowerCase();let h=r&8?f:null;if(h&&Vl(h,c,0)!==-1||r&2&&c!==f){if(De(r))return!1;s=!0}}}}return De(r)||s}function De(t){return(t&1)===0}function Mg(t,e,n,r){if(e===null)return-1;let i=0;if(r||!n){let o=!1;for(;i<e.length;){let s=e[i];if(s===t)return i;if(s===3||s===6)o=!0;else if(s===1||s===2){let a=e[++i];for(;typeof a=="string";)a=e[++i];continue}else{if(s===4)break;if(s===0){i+=4;continue}}i+=o?1:2}return-1}else return Tg(e,t)}function _g(t,e,n=!1){for(let r=0;r<e.length;r++)if(Ig(t,e[r],n))return!0;return!1}function Sg(t){for(let e=0;e<t.length;e++){let n=t[e];if(Cg(n))return e}return t.length}function Tg(t,e){let n=t.indexOf(4);if(n>-1)for(n++;n<t.length;){let r=t[n];if(typeof r=="number")return-1;if(r===e)return n;n++}return-1}function Jc(t,e){return t?":not("+e.trim()+")":e}function Ag(t){let e=t[0],n=1,r=2,i="",o=!1;for(;n<t.length;){let s=t[n];if(typeof s=="string")if(r&2){let a=t[++n];i+="["+s+(a.length>0?'="'+a+'"':"")+"]"}else r&8?i+="."+s:r&4&&(i+=" "+s);else i!==""&&!De(s)&&(e+=Jc(o,i),i=""),r=s,o=o||!De(r);n++}return i!==""&&(e+=Jc(o,i)),e}function xg(t){return t.map(Ag).join(",")}function Ng(t){let e=[],n=[],r=1,i=2;for(;r<t.length;){let o=t[r];if(typeof o=="string")i===2?o!==""&&e.push(o,t[++r]):i===8&&n.push(o);else{if(!De(i))break;i=o}r++}return{attrs:e,classes:n}}function Ui(t){return tr(()=>{let e=Gl(t),n=V(m({},e),{decls:t.decls,vars:t.vars,template:t.template,consts:t.consts||null,ngContentSelectors:t.ngContentSelectors,onPush:t.changeDetection===Ll.OnPush,directiveDefs:null,pipeDefs:null,dependencies:e.standalone&&t.dependencies||null,getStandaloneInjector:null,signals:t.signals??!1,data:t.data||{},encapsulation:t.encapsulation||Re.Emulated,styles:t.styles||ge,_:null,schemas:t.schemas||null,tView:null,id:""});Wl(n);let r=t.dependencies;return n.directiveDefs=el(r,!1),n.pipeDefs=el(r,!0),n.id=Pg(n),n})}function Og(t){return St(t)||Ul(t)}function Rg(t){return t!==null}function Le(t){return tr(()=>({type:t.type,bootstrap:t.bootstrap||ge,declarations:t.declarations||ge,imports:t.imports||ge,exports:t.exports||ge,transitiveCompileScopes:null,schemas:t.schemas||null,id:t.id||null}))}function Xc(t,e){if(t==null)return ln;let n={};for(let r in t)if(t.hasOwnProperty(r)){let i=t[r],o=i;Array.isArray(i)&&(o=i[1],i=i[0]),n[i]=r,e&&(e[i]=o)}return n}function Ee(t){return tr(()=>{let e=Gl(t);return Wl(e),e})}function St(t){return t[tg]||null}function Ul(t){return t[ng]||null}function Bl(t){return t[rg]||null}function Hl(t){let e=St(t)||Ul(t)||Bl(t);return e!==null?e.standalone:!1}function zl(t,e){let n=t[ig]||null;if(!n&&e===!0)throw new Error(`Type ${se(t)} does not have '\u0275mod' property.`);return n}function Gl(t){let e={};return{type:t.type,providersResolver:null,factory:null,hostBindings:t.hostBindings||null,hostVars:t.hostVars||0,hostAttrs:t.hostAttrs||null,contentQueries:t.contentQueries||null,declaredInputs:e,inputTransforms:null,inputConfig:t.inputs||ln,exportAs:t.exportAs||null,standalone:t.standalone===!0,signals:t.signals===!0,selectors:t.selectors||ge,viewQuery:t.viewQuery||null,features:t.features||null,setInput:null,findHostDirectiveDefs:null,hostDirectives:null,inputs:Xc(t.inputs,e),outputs:Xc(t.outputs),debugInfo:null}}function Wl(t){t.features?.forEach(e=>e(t))}function el(t,e){if(!t)return null;let n=e?Bl:Og;return()=>(typeof t=="function"?t():t).map(r=>n(r)).filter(Rg)}function Pg(t){let e=0,n=[t.selectors,t.ngContentSelectors,t.hostVars,t.hostAttrs,t.consts,t.vars,t.decls,t.encapsulation,t.standalone,t.signals,t.exportAs,JSON.stringify(t.inputs),JSON.stringify(t.outputs),Object.getOwnPropertyNames(t.type.prototype),!!t.contentQueries,!!t.viewQuery].join("|");for(let i of n)e=Math.imul(31,e)+i.charCodeAt(0)<<0;return e+=2147483647+1,"c"+e}var We=0,R=1,T=2,K=3,Ce=4,be=5,Ei=6,Wn=7,He=8,dn=9,qn=10,ne=11,Zn=12,tl=13,nr=14,Pe=15,fa=16,sn=17,ha=18,Bi=19,ql=20,Hn=21,ls=22,Tt=23,At=25,Zl=1;var xt=7,bi=8,Ii=9,me=10,fn=function(t){return t[t.None=0]="None",t[t.HasTransplantedViews=2]="HasTransplantedViews",t[t.HasChildViewsToRefresh=4]="HasChildViewsToRefresh",t}(fn||{});function ot(t){return Array.isArray(t)&&typeof t[Zl]=="object"}function we(t){return Array.isArray(t)&&t[Zl]===!0}function Yl(t){return(t.flags&4)!==0}function Hi(t){return t.componentOffset>-1}function Ql(t){return(t.flags&1)===1}function st(t){return!!t.template}function Fg(t){return(t[T]&512)!==0}function hn(t,e){let n=t.hasOwnProperty(Di);return n?t[Di]:null}var As=class{constructor(e,n,r){this.previousValue=e,this.currentValue=n,this.firstChange=r}isFirstChange(){return this.firstChange}};function Cn(){return Kl}function Kl(t){return t.type.prototype.ngOnChanges&&(t.setInput=Lg),kg}Cn.ngInherit=!0;function kg(){let t=Xl(this),e=t?.current;if(e){let n=t.previous;if(n===ln)t.previous=e;else for(let r in e)n[r]=e[r];t.current=null,this.ngOnChanges(e)}}function Lg(t,e,n,r){let i=this.declaredInputs[n],o=Xl(t)||Vg(t,{previous:ln,current:null}),s=o.current||(o.current={}),a=o.previous,u=a[i];s[i]=new As(u&&u.currentValue,e,a===ln),t[r]=e}var Jl="__ngSimpleChanges__";function Xl(t){return t[Jl]||null}function Vg(t,e){return t[Jl]=e}var nl=null;var Ne=function(t,e,n){nl?.(t,e,n)},jg="svg",$g="math";function Fe(t){for(;Array.isArray(t);)t=t[We];return t}function ed(t,e){return Fe(e[t])}function Ie(t,e){return Fe(e[t.index])}function td(t,e){return t.data[e]}function ut(t,e){let n=e[t];return ot(n)?n:n[We]}function pa(t){return(t[T]&128)===128}function Ug(t){return we(t[K])}function rl(t,e){return e==null?null:t[e]}function nd(t){t[sn]=0}function Bg(t){t[T]&1024||(t[T]|=1024,pa(t)&&zi(t))}function rd(t){return t[T]&9216||t[Tt]?.dirty}function id(t){rd(t)&&zi(t)}function zi(t){let e=t[K];for(;e!==null&&!(we(e)&&e[T]&fn.HasChildViewsToRefresh||ot(e)&&e[T]&8192);){if(we(e))e[T]|=fn.HasChildViewsToRefresh;else if(e[T]|=8192,!pa(e))break;e=e[K]}}function Hg(t,e){if((t[T]&256)===256)throw new C(911,!1);t[Hn]===null&&(t[Hn]=[]),t[Hn].push(e)}var P={lFrame:hd(null),bindingsEnabled:!0,skipHydrationRootTNode:null};function zg(){return P.lFrame.elementDepthCount}function Gg(){P.lFrame.elementDepthCount++}function Wg(){P.lFrame.elementDepthCount--}function od(){return P.bindingsEnabled}function qg(){return P.skipHydrationRootTNode!==null}function Zg(t){return P.skipHydrationRootTNode===t}function Yg(){P.skipHydrationRootTNode=null}function J(){return P.lFrame.lView}function qe(){return P.lFrame.tView}function Me(){let t=sd();for(;t!==null&&t.type===64;)t=t.parent;return t}function sd(){return P.lFrame.currentTNode}function Qg(){let t=P.lFrame,e=t.currentTNode;return t.isParent?e:e.parent}function Gi(t,e){let n=P.lFrame;n.currentTNode=t,n.isParent=e}function ad(){return P.lFrame.isParent}function Kg(){P.lFrame.isParent=!1}function Jg(){let t=P.lFrame,e=t.bindingRootIndex;return e===-1&&(e=t.bindingRootIndex=t.tView.bindingStartIndex),e}function Xg(){return P.lFrame.bindingIndex}function em(t){return P.lFrame.bindingIndex=t}function ud(){return P.lFrame.bindingIndex++}function cd(t){let e=P.lFrame,n=e.bindingIndex;return e.bindingIndex=e.bindingIndex+t,n}function tm(){return P.lFrame.inI18n}function nm(t,e){let n=P.lFrame;n.bindingIndex=n.bindingRootIndex=t,xs(e)}function rm(){return P.lFrame.currentDirectiveIndex}function xs(t){P.lFrame.currentDirectiveIndex=t}function im(t){let e=P.lFrame.currentDirectiveIndex;return e===-1?null:t[e]}function ld(t){P.lFrame.currentQueryIndex=t}function om(t){let e=t[R];return e.type===2?e.declTNode:e.type===1?t[be]:null}function dd(t,e,n){if(n&O.SkipSelf){let i=e,o=t;for(;i=i.parent,i===null&&!(n&O.Host);)if(i=om(o),i===null||(o=o[nr],i.type&10))break;if(i===null)return!1;e=i,t=o}let r=P.lFrame=fd();return r.currentTNode=e,r.lView=t,!0}function ga(t){let e=fd(),n=t[R];P.lFrame=e,e.currentTNode=n.firstChild,e.lView=t,e.tView=n,e.contextLView=t,e.bindingIndex=n.bindingStartIndex,e.inI18n=!1}function fd(){let t=P.lFrame,e=t===null?null:t.child;return e===null?hd(t):e}function hd(t){let e={currentTNode:null,isParent:!0,lView:null,tView:null,selectedIndex:-1,contextLView:null,elementDepthCount:0,currentNamespace:null,currentDirectiveIndex:-1,bindingRootIndex:-1,bindingIndex:-1,currentQueryIndex:0,parent:t,child:null,inI18n:!1};return t!==null&&(t.child=e),e}function pd(){let t=P.lFrame;return P.lFrame=t.parent,t.currentTNode=null,t.lView=null,t}var gd=pd;function ma(){let t=pd();t.isParent=!0,t.tView=null,t.selectedIndex=-1,t.contextLView=null,t.elementDepthCount=0,t.currentDirectiveIndex=-1,t.currentNamespace=null,t.bindingRootIndex=-1,t.bindingIndex=-1,t.currentQueryIndex=0}function Ft(){return P.lFrame.selectedIndex}function Nt(t){P.lFrame.selectedIndex=t}function sm(){let t=P.lFrame;return td(t.tView,t.selectedIndex)}function am(){return P.lFrame.currentNamespace}var md=!0;function vd(){return md}function yd(t){md=t}function um(t,e,n){let{ngOnChanges:r,ngOnInit:i,ngDoCheck:o}=e.type.prototype;if(r){let s=Kl(e);(n.preOrderHooks??=[]).push(t,s),(n.preOrderCheckHooks??=[]).push(t,s)}i&&(n.preOrderHooks??=[]).push(0-t,i),o&&((n.preOrderHooks??=[]).push(t,o),(n.preOrderCheckHooks??=[]).push(t,o))}function Dd(t,e){for(let n=e.directiveStart,r=e.directiveEnd;n<r;n++){let o=t.data[n].type.prototype,{ngAfterContentInit:s,ngAfterContentChecked:a,ngAfterViewInit:u,ngAfterViewChecked:c,ngOnDestroy:l}=o;s&&(t.contentHooks??=[]).push(-n,s),a&&((t.contentHooks??=[]).push(n,a),(t.contentCheckHooks??=[]).push(n,a)),u&&(t.viewHooks??=[]).push(-n,u),c&&((t.viewHooks??=[]).push(n,c),(t.viewCheckHooks??=[]).push(n,c)),l!=null&&(t.destroyHooks??=[]).push(n,l)}}function pi(t,e,n){Cd(t,e,3,n)}function gi(t,e,n,r){(t[T]&3)===n&&Cd(t,e,n,r)}function ds(t,e){let n=t[T];(n&3)===e&&(n&=16383,n+=1,t[T]=n)}function Cd(t,e,n,r){let i=r!==void 0?t[sn]&65535:0,o=r??-1,s=e.length-1,a=0;for(let u=i;u<s;u++)if(typeof e[u+1]=="number"){if(a=e[u],r!=null&&a>=r)break}else e[u]<0&&(t[sn]+=65536),(a<o||o==-1)&&(cm(t,n,e,u),t[sn]=(t[sn]&4294901760)+u+2),u++}function il(t,e){Ne(4,t,e);let n=fe(null);try{e.call(t)}finally{fe(n),Ne(5,t,e)}}function cm(t,e,n,r){let i=n[r]<0,o=n[r+1],s=i?-n[r]:n[r],a=t[s];i?t[T]>>14<t[sn]>>16&&(t[T]&3)===e&&(t[T]+=16384,il(a,o)):il(a,o)}var cn=-1,Ot=class{constructor(e,n,r){this.factory=e,this.resolving=!1,this.canSeeViewProviders=n,this.injectImpl=r}};function lm(t){return t instanceof Ot}function dm(t){return(t.flags&8)!==0}function fm(t){return(t.flags&16)!==0}function wd(t){return t!==cn}function Mi(t){let e=t&32767;return t&32767}function hm(t){return t>>16}function _i(t,e){let n=hm(t),r=e;for(;n>0;)r=r[nr],n--;return r}var Ns=!0;function ol(t){let e=Ns;return Ns=t,e}var pm=256,Ed=pm-1,bd=5,gm=0,Oe={};function mm(t,e,n){let r;typeof n=="string"?r=n.charCodeAt(0)||0:n.hasOwnProperty($n)&&(r=n[$n]),r==null&&(r=n[$n]=gm++);let i=r&Ed,o=1<<i;e.data[t+(i>>bd)]|=o}function Si(t,e){let n=Id(t,e);if(n!==-1)return n;let r=e[R];r.firstCreatePass&&(t.injectorIndex=e.length,fs(r.data,t),fs(e,null),fs(r.blueprint,null));let i=va(t,e),o=t.injectorIndex;if(wd(i)){let s=Mi(i),a=_i(i,e),u=a[R].data;for(let c=0;c<8;c++)e[o+c]=a[s+c]|u[s+c]}return e[o+8]=i,o}function fs(t,e){t.push(0,0,0,0,0,0,0,0,e)}function Id(t,e){return t.injectorIndex===-1||t.parent&&t.parent.injectorIndex===t.injectorIndex||e[t.injectorIndex+8]===null?-1:t.injectorIndex}function va(t,e){if(t.parent&&t.parent.injectorIndex!==-1)return t.parent.injectorIndex;let n=0,r=null,i=e;for(;i!==null;){if(r=Ad(i),r===null)return cn;if(n++,i=i[nr],r.injectorIndex!==-1)return r.injectorIndex|n<<16}return cn}function Os(t,e,n){mm(t,e,n)}function Md(t,e,n){if(n&O.Optional||t!==void 0)return t;da(e,"NodeInjector")}function _d(t,e,n,r){if(n&O.Optional&&r===void 0&&(r=null),!(n&(O.Self|O.Host))){let i=t[dn],o=pe(void 0);try{return i?i.get(e,r,n&O.Optional):Fl(e,r,n&O.Optional)}finally{pe(o)}}return Md(r,e,n)}function Sd(t,e,n,r=O.Default,i){if(t!==null){if(e[T]&2048&&!(r&O.Self)){let s=wm(t,e,n,r,Oe);if(s!==Oe)return s}let o=Td(t,e,n,r,Oe);if(o!==Oe)return o}return _d(e,n,r,i)}function Td(t,e,n,r,i){let o=Dm(n);if(typeof o=="function"){if(!dd(e,t,r))return r&O.Host?Md(i,n,r):_d(e,n,r,i);try{let s;if(s=o(r),s==null&&!(r&O.Optional))da(n);else return s}finally{gd()}}else if(typeof o=="number"){let s=null,a=Id(t,e),u=cn,c=r&O.Host?e[Pe][be]:null;for((a===-1||r&O.SkipSelf)&&(u=a===-1?va(t,e):e[a+8],u===cn||!al(r,!1)?a=-1:(s=e[R],a=Mi(u),e=_i(u,e)));a!==-1;){let l=e[R];if(sl(o,a,l.data)){let d=vm(a,e,n,s,r,c);if(d!==Oe)return d}u=e[a+8],u!==cn&&al(r,e[R].data[a+8]===c)&&sl(o,a,e)?(s=l,a=Mi(u),e=_i(u,e)):a=-1}}return i}function vm(t,e,n,r,i,o){let s=e[R],a=s.data[t+8],u=r==null?Hi(a)&&Ns:r!=s&&(a.type&3)!==0,c=i&O.Host&&o===a,l=ym(a,s,n,u,c);return l!==null?pn(e,s,l,a):Oe}function ym(t,e,n,r,i){let o=t.providerIndexes,s=e.data,a=o&1048575,u=t.directiveStart,c=t.directiveEnd,l=o>>20,d=r?a:a+l,f=i?a+l:c;for(let h=d;h<f;h++){let g=s[h];if(h<u&&n===g||h>=u&&g.type===n)return h}if(i){let h=s[u];if(h&&st(h)&&h.type===n)return u}return null}function pn(t,e,n,r){let i=t[n],o=e.data;if(lm(i)){let s=i;s.resolving&&sg(og(o[n]));let a=ol(s.canSeeViewProviders);s.resolving=!0;let u,c=s.injectImpl?pe(s.injectImpl):null,l=dd(t,r,O.Default);try{i=t[n]=s.factory(void 0,o,t,r),e.firstCreatePass&&n>=r.directiveStart&&um(n,o[n],e)}finally{c!==null&&pe(c),ol(a),s.resolving=!1,gd()}}return i}function Dm(t){if(typeof t=="string")return t.charCodeAt(0)||0;let e=t.hasOwnProperty($n)?t[$n]:void 0;return typeof e=="number"?e>=0?e&Ed:Cm:e}function sl(t,e,n){let r=1<<t;return!!(n[e+(t>>bd)]&r)}function al(t,e){return!(t&O.Self)&&!(t&O.Host&&e)}var _t=class{constructor(e,n){this._tNode=e,this._lView=n}get(e,n,r){return Sd(this._tNode,this._lView,e,$i(r),n)}};function Cm(){return new _t(Me(),J())}function wn(t){return tr(()=>{let e=t.prototype.constructor,n=e[Di]||Rs(e),r=Object.prototype,i=Object.getPrototypeOf(t.prototype).constructor;for(;i&&i!==r;){let o=i[Di]||Rs(i);if(o&&o!==n)return o;i=Object.getPrototypeOf(i)}return o=>new o})}function Rs(t){return xl(t)?()=>{let e=Rs(ie(t));return e&&e()}:hn(t)}function wm(t,e,n,r,i){let o=t,s=e;for(;o!==null&&s!==null&&s[T]&2048&&!(s[T]&512);){let a=Td(o,s,n,r|O.Self,Oe);if(a!==Oe)return a;let u=o.parent;if(!u){let c=s[ql];if(c){let l=c.get(n,Oe,r);if(l!==Oe)return l}u=Ad(s),s=s[nr]}o=u}return i}function Ad(t){let e=t[R],n=e.type;return n===2?e.declTNode:n===1?t[be]:null}var di="__parameters__";function Em(t){return function(...n){if(t){let r=t(...n);for(let i in r)this[i]=r[i]}}}function xd(t,e,n){return tr(()=>{let r=Em(e);function i(...o){if(this instanceof i)return r.apply(this,o),this;let s=new i(...o);return a.annotation=s,a;function a(u,c,l){let d=u.hasOwnProperty(di)?u[di]:Object.defineProperty(u,di,{value:[]})[di];for(;d.length<=l;)d.push(null);return(d[l]=d[l]||[]).push(s),u}}return n&&(i.prototype=Object.create(n.prototype)),i.prototype.ngMetadataName=t,i.annotationCls=i,i})}function bm(t){return typeof t=="function"}function ya(t,e){t.forEach(n=>Array.isArray(n)?ya(n,e):e(n))}function Nd(t,e,n){e>=t.length?t.push(n):t.splice(e,0,n)}function Ti(t,e){return e>=t.length-1?t.pop():t.splice(e,1)[0]}function Im(t,e){let n=[];for(let r=0;r<t;r++)n.push(e);return n}function Mm(t,e,n,r){let i=t.length;if(i==e)t.push(n,r);else if(i===1)t.push(r,t[0]),t[0]=n;else{for(i--,t.push(t[i-1],t[i]);i>e;){let o=i-2;t[i]=t[o],i--}t[e]=n,t[e+1]=r}}function _m(t,e,n){let r=rr(t,e);return r>=0?t[r|1]=n:(r=~r,Mm(t,r,e,n)),r}function hs(t,e){let n=rr(t,e);if(n>=0)return t[n|1]}function rr(t,e){return Sm(t,e,1)}function Sm(t,e,n){let r=0,i=t.length>>n;for(;i!==r;){let o=r+(i-r>>1),s=t[o<<n];if(e===s)return o<<n;s>e?i=o:r=o+1}return~(i<<n)}var Wi=kl(xd("Optional"),8);var Da=kl(xd("SkipSelf"),4);var ir=new E("ENVIRONMENT_INITIALIZER"),Od=new E("INJECTOR",-1),Rd=new E("INJECTOR_DEF_TYPES"),Ai=class{get(e,n=zn){if(n===zn){let r=new Error(`NullInjectorError: No provider for ${se(e)}!`);throw r.name="NullInjectorError",r}return n}};function ct(t){return{\u0275providers:t}}function Tm(...t){return{\u0275providers:Pd(!0,t),\u0275fromNgModule:!0}}function Pd(t,...e){let n=[],r=new Set,i,o=s=>{n.push(s)};return ya(e,s=>{let a=s;Ps(a,o,[],r)&&(i||=[],i.push(a))}),i!==void 0&&Fd(i,o),n}function Fd(t,e){for(let n=0;n<t.length;n++){let{ngModule:r,providers:i}=t[n];Ca(i,o=>{e(o,r)})}}function Ps(t,e,n,r){if(t=ie(t),!t)return!1;let i=null,o=Zc(t),s=!o&&St(t);if(!o&&!s){let u=t.ngModule;if(o=Zc(u),o)i=u;else return!1}else{if(s&&!s.standalone)return!1;i=t}let a=r.has(i);if(s){if(a)return!1;if(r.add(i),s.dependencies){let u=typeof s.dependencies=="function"?s.dependencies():s.dependencies;for(let c of u)Ps(c,e,n,r)}}else if(o){if(o.imports!=null&&!a){r.add(i);let c;try{ya(o.imports,l=>{Ps(l,e,n,r)&&(c||=[],c.push(l))})}finally{}c!==void 0&&Fd(c,e)}if(!a){let c=hn(i)||(()=>new i);e({provide:i,useFactory:c,deps:ge},i),e({provide:Rd,useValue:i,multi:!0},i),e({provide:ir,useValue:()=>I(i),multi:!0},i)}let u=o.providers;if(u!=null&&!a){let c=t;Ca(u,l=>{e(l,c)})}}else return!1;return i!==t&&t.providers!==void 0}function Ca(t,e){for(let n of t)Nl(n)&&(n=n.\u0275providers),Array.isArray(n)?Ca(n,e):e(n)}var Am=L({provide:String,useValue:L});function kd(t){return t!==null&&typeof t=="object"&&Am in t}function xm(t){return!!(t&&t.useExisting)}function Nm(t){return!!(t&&t.useFactory)}function gn(t){return typeof t=="function"}function Om(t){return!!t.useClass}var qi=new E("Set Injector scope."),mi={},Rm={},ps;function wa(){return ps===void 0&&(ps=new Ai),ps}var le=class{},Yn=class extends le{get destroyed(){return this._destroyed}constructor(e,n,r,i){super(),this.parent=n,this.source=r,this.scopes=i,this.records=new Map,this._ngOnDestroyHooks=new Set,this._onDestroyHooks=[],this._destroyed=!1,ks(e,s=>this.processProvider(s)),this.records.set(Od,an(void 0,this)),i.has("environment")&&this.records.set(le,an(void 0,this));let o=this.records.get(qi);o!=null&&typeof o.value=="string"&&this.scopes.add(o.value),this.injectorDefTypes=new Set(this.get(Rd,ge,O.Self))}destroy(){this.assertNotDestroyed(),this._destroyed=!0;try{for(let n of this._ngOnDestroyHooks)n.ngOnDestroy();let e=this._onDestroyHooks;this._onDestroyHooks=[];for(let n of e)n()}finally{this.records.clear(),this._ngOnDestroyHooks.clear(),this.injectorDefTypes.clear()}}onDestroy(e){return this.assertNotDestroyed(),this._onDestroyHooks.push(e),()=>this.removeOnDestroy(e)}runInContext(e){this.assertNotDestroyed();let n=it(this),r=pe(void 0),i;try{return e()}finally{it(n),pe(r)}}get(e,n=zn,r=O.Default){if(this.assertNotDestroyed(),e.hasOwnProperty(Wc))return e[Wc](this);r=$i(r);let i,o=it(this),s=pe(void 0);try{if(!(r&O.SkipSelf)){let u=this.records.get(e);if(u===void 0){let c=Vm(e)&&ji(e);c&&this.injectableDefInScope(c)?u=an(Fs(e),mi):u=null,this.records.set(e,u)}if(u!=null)return this.hydrate(e,u)}let a=r&O.Self?wa():this.parent;return n=r&O.Optional&&n===zn?null:n,a.get(e,n)}catch(a){if(a.name==="NullInjectorError"){if((a[wi]=a[wi]||[]).unshift(se(e)),o)throw a;return yg(a,e,"R3InjectorError",this.source)}else throw a}finally{pe(s),it(o)}}resolveInjectorInitializers(){let e=it(this),n=pe(void 0),r;try{let i=this.get(ir,ge,O.Self);for(let o of i)o()}finally{it(e),pe(n)}}toString(){let e=[],n=this.records;for(let r of n.keys())e.push(se(r));return`R3Injector[${e.join(", ")}]`}assertNotDestroyed(){if(this._destroyed)throw new C(205,!1)}processProvider(e){e=ie(e);let n=gn(e)?e:ie(e&&e.provide),r=Fm(e);if(!gn(e)&&e.multi===!0){let i=this.records.get(n);i||(i=an(void 0,mi,!0),i.factory=()=>Ss(i.multi),this.records.set(n,i)),n=e,i.multi.push(e)}else{let i=this.records.get(n)}this.records.set(n,r)}hydrate(e,n){return n.value===mi&&(n.value=Rm,n.value=n.factory()),typeof n.value=="object"&&n.value&&Lm(n.value)&&this._ngOnDestroyHooks.add(n.value),n.value}injectableDefInScope(e){if(!e.providedIn)return!1;let n=ie(e.providedIn);return typeof n=="string"?n==="any"||this.scopes.has(n):this.injectorDefTypes.has(n)}removeOnDestroy(e){let n=this._onDestroyHooks.indexOf(e);n!==-1&&this._onDestroyHooks.splice(n,1)}};function Fs(t){let e=ji(t),n=e!==null?e.factory:hn(t);if(n!==null)return n;if(t instanceof E)throw new C(204,!1);if(t instanceof Function)return Pm(t);throw new C(204,!1)}function Pm(t){let e=t.length;if(e>0){let r=Im(e,"?");throw new C(204,!1)}let n=cg(t);return n!==null?()=>n.factory(t):()=>new t}function Fm(t){if(kd(t))return an(void 0,t.useValue);{let e=Ld(t);return an(e,mi)}}function Ld(t,e,n){let r;if(gn(t)){let i=ie(t);return hn(i)||Fs(i)}else if(kd(t))r=()=>ie(t.useValue);else if(Nm(t))r=()=>t.useFactory(...Ss(t.deps||[]));else if(xm(t))r=()=>I(ie(t.useExisting));else{let i=ie(t&&(t.useClass||t.provide));if(km(t))r=()=>new i(...Ss(t.deps));else return hn(i)||Fs(i)}return r}function an(t,e,n=!1){return{factory:t,value:e,multi:n?[]:void 0}}function km(t){return!!t.deps}function Lm(t){return t!==null&&typeof t=="object"&&typeof t.ngOnDestroy=="function"}function Vm(t){return typeof t=="function"||typeof t=="object"&&t instanceof E}function ks(t,e){for(let n of t)Array.isArray(n)?ks(n,e):n&&Nl(n)?ks(n.\u0275providers,e):e(n)}function Ze(t,e){t instanceof Yn&&t.assertNotDestroyed();let n,r=it(t),i=pe(void 0);try{return e()}finally{it(r),pe(i)}}function ul(t,e=null,n=null,r){let i=Vd(t,e,n,r);return i.resolveInjectorInitializers(),i}function Vd(t,e=null,n=null,r,i=new Set){let o=[n||ge,Tm(t)];return r=r||(typeof t=="object"?void 0:se(t)),new Yn(o,e||wa(),r||null,i)}var Ye=(()=>{let e=class e{static create(r,i){if(Array.isArray(r))return ul({name:""},i,r,"");{let o=r.name??"";return ul({name:o},r.parent,r.providers,o)}}};e.THROW_IF_NOT_FOUND=zn,e.NULL=new Ai,e.\u0275prov=w({token:e,providedIn:"any",factory:()=>I(Od)}),e.__NG_ELEMENT_ID__=-1;let t=e;return t})();var Ls;function jd(t){Ls=t}function jm(){if(Ls!==void 0)return Ls;if(typeof document<"u")return document;throw new C(210,!1)}var Ea=new E("AppId",{providedIn:"root",factory:()=>$m}),$m="ng",ba=new E("Platform Initializer"),_e=new E("Platform ID",{providedIn:"platform",factory:()=>"unknown"});var Ia=new E("CSP nonce",{providedIn:"root",factory:()=>jm().body?.querySelector("[ngCspNonce]")?.getAttribute("ngCspNonce")||null});function $d(t){return t instanceof Function?t():t}function Ud(t){return(t.flags&128)===128}var ze=function(t){return t[t.Important=1]="Important",t[t.DashCase=2]="DashCase",t}(ze||{});var Bd=new Map,Um=0;function Bm(){return Um++}function Hm(t){Bd.set(t[Bi],t)}function zm(t){Bd.delete(t[Bi])}var cl="__ngContext__";function mn(t,e){ot(e)?(t[cl]=e[Bi],Hm(e)):t[cl]=e}var Gm;function Ma(t,e){return Gm(t,e)}function _a(t){let e=t[K];return we(e)?e[K]:e}function Hd(t){return Gd(t[Zn])}function zd(t){return Gd(t[Ce])}function Gd(t){for(;t!==null&&!we(t);)t=t[Ce];return t}function un(t,e,n,r,i){if(r!=null){let o,s=!1;we(r)?o=r:ot(r)&&(s=!0,r=r[We]);let a=Fe(r);t===0&&n!==null?i==null?Yd(e,n,a):xi(e,n,a,i||null,!0):t===1&&n!==null?xi(e,n,a,i||null,!0):t===2?cv(e,a,s):t===3&&e.destroyNode(a),o!=null&&dv(e,t,o,n,i)}}function Wm(t,e){return t.createText(e)}function qm(t,e,n){t.setValue(e,n)}function Wd(t,e,n){return t.createElement(e,n)}function Zm(t,e){let n=e[ne];or(t,e,n,2,null,null),e[We]=null,e[be]=null}function Ym(t,e,n,r,i,o){r[We]=i,r[be]=e,or(t,r,n,1,i,o)}function Qm(t,e){or(t,e,e[ne],2,null,null)}function Km(t){let e=t[Zn];if(!e)return gs(t[R],t);for(;e;){let n=null;if(ot(e))n=e[Zn];else{let r=e[me];r&&(n=r)}if(!n){for(;e&&!e[Ce]&&e!==t;)ot(e)&&gs(e[R],e),e=e[K];e===null&&(e=t),ot(e)&&gs(e[R],e),n=e&&e[Ce]}e=n}}function Jm(t,e,n,r){let i=me+r,o=n.length;r>0&&(n[i-1][Ce]=e),r<o-me?(e[Ce]=n[i],Nd(n,me+r,e)):(n.push(e),e[Ce]=null),e[K]=n;let s=e[fa];s!==null&&n!==s&&Xm(s,e);let a=e[ha];a!==null&&a.insertView(t),id(e),e[T]|=128}function Xm(t,e){let n=t[Ii],i=e[K][K][Pe];e[Pe]!==i&&(t[T]|=fn.HasTransplantedViews),n===null?t[Ii]=[e]:n.push(e)}function qd(t,e){let n=t[Ii],r=n.indexOf(e),i=e[K];n.splice(r,1)}function Vs(t,e){if(t.length<=me)return;let n=me+e,r=t[n];if(r){let i=r[fa];i!==null&&i!==t&&qd(i,r),e>0&&(t[n-1][Ce]=r[Ce]);let o=Ti(t,me+e);Zm(r[R],r);let s=o[ha];s!==null&&s.detachView(o[R]),r[K]=null,r[Ce]=null,r[T]&=-129}return r}function Zd(t,e){if(!(e[T]&256)){let n=e[ne];n.destroyNode&&or(t,e,n,3,null,null),Km(e)}}function gs(t,e){if(!(e[T]&256)){e[T]&=-129,e[T]|=256,e[Tt]&&hc(e[Tt]),tv(t,e),ev(t,e),e[R].type===1&&e[ne].destroy();let n=e[fa];if(n!==null&&we(e[K])){n!==e[K]&&qd(n,e);let r=e[ha];r!==null&&r.detachView(t)}zm(e)}}function ev(t,e){let n=t.cleanup,r=e[Wn];if(n!==null)for(let o=0;o<n.length-1;o+=2)if(typeof n[o]=="string"){let s=n[o+3];s>=0?r[s]():r[-s].unsubscribe(),o+=2}else{let s=r[n[o+1]];n[o].call(s)}r!==null&&(e[Wn]=null);let i=e[Hn];if(i!==null){e[Hn]=null;for(let o=0;o<i.length;o++){let s=i[o];s()}}}function tv(t,e){let n;if(t!=null&&(n=t.destroyHooks)!=null)for(let r=0;r<n.length;r+=2){let i=e[n[r]];if(!(i instanceof Ot)){let o=n[r+1];if(Array.isArray(o))for(let s=0;s<o.length;s+=2){let a=i[o[s]],u=o[s+1];Ne(4,a,u);try{u.call(a)}finally{Ne(5,a,u)}}else{Ne(4,i,o);try{o.call(i)}finally{Ne(5,i,o)}}}}}function nv(t,e,n){return rv(t,e.parent,n)}function rv(t,e,n){let r=e;for(;r!==null&&r.type&40;)e=r,r=e.parent;if(r===null)return n[We];{let{componentOffset:i}=r;if(i>-1){let{encapsulation:o}=t.data[r.directiveStart+i];if(o===Re.None||o===Re.Emulated)return null}return Ie(r,n)}}function xi(t,e,n,r,i){t.insertBefore(e,n,r,i)}function Yd(t,e,n){t.appendChild(e,n)}function ll(t,e,n,r,i){r!==null?xi(t,e,n,r,i):Yd(t,e,n)}function iv(t,e,n,r){t.removeChild(e,n,r)}function Sa(t,e){return t.parentNode(e)}function ov(t,e){return t.nextSibling(e)}function sv(t,e,n){return uv(t,e,n)}function av(t,e,n){return t.type&40?Ie(t,n):null}var uv=av,dl;function Qd(t,e,n,r){let i=nv(t,r,e),o=e[ne],s=r.parent||e[be],a=sv(s,r,e);if(i!=null)if(Array.isArray(n))for(let u=0;u<n.length;u++)ll(o,i,n[u],a,!1);else ll(o,i,n,a,!1);dl!==void 0&&dl(o,r,e,n,i)}function vi(t,e){if(e!==null){let n=e.type;if(n&3)return Ie(e,t);if(n&4)return js(-1,t[e.index]);if(n&8){let r=e.child;if(r!==null)return vi(t,r);{let i=t[e.index];return we(i)?js(-1,i):Fe(i)}}else{if(n&32)return Ma(e,t)()||Fe(t[e.index]);{let r=Kd(t,e);if(r!==null){if(Array.isArray(r))return r[0];let i=_a(t[Pe]);return vi(i,r)}else return vi(t,e.next)}}}return null}function Kd(t,e){if(e!==null){let r=t[Pe][be],i=e.projection;return r.projection[i]}return null}function js(t,e){let n=me+t+1;if(n<e.length){let r=e[n],i=r[R].firstChild;if(i!==null)return vi(r,i)}return e[xt]}function cv(t,e,n){let r=Sa(t,e);r&&iv(t,r,e,n)}function Ta(t,e,n,r,i,o,s){for(;n!=null;){let a=r[n.index],u=n.type;if(s&&e===0&&(a&&mn(Fe(a),r),n.flags|=2),(n.flags&32)!==32)if(u&8)Ta(t,e,n.child,r,i,o,!1),un(e,t,i,a,o);else if(u&32){let c=Ma(n,r),l;for(;l=c();)un(e,t,i,l,o);un(e,t,i,a,o)}else u&16?lv(t,e,r,n,i,o):un(e,t,i,a,o);n=s?n.projectionNext:n.next}}function or(t,e,n,r,i,o){Ta(n,r,t.firstChild,e,i,o,!1)}function lv(t,e,n,r,i,o){let s=n[Pe],u=s[be].projection[r.projection];if(Array.isArray(u))for(let c=0;c<u.length;c++){let l=u[c];un(e,t,i,l,o)}else{let c=u,l=s[K];Ud(r)&&(c.flags|=128),Ta(t,e,c,l,i,o,!0)}}function dv(t,e,n,r,i){let o=n[xt],s=Fe(n);o!==s&&un(e,t,r,o,i);for(let a=me;a<n.length;a++){let u=n[a];or(u[R],u,t,e,r,o)}}function fv(t,e,n,r,i){if(e)i?t.addClass(n,r):t.removeClass(n,r);else{let o=r.indexOf("-")===-1?void 0:ze.DashCase;i==null?t.removeStyle(n,r,o):(typeof i=="string"&&i.endsWith("!important")&&(i=i.slice(0,-10),o|=ze.Important),t.setStyle(n,r,i,o))}}function hv(t,e,n){t.setAttribute(e,"style",n)}function Jd(t,e,n){n===""?t.removeAttribute(e,"class"):t.setAttribute(e,"class",n)}function Xd(t,e,n){let{mergedAttrs:r,classes:i,styles:o}=n;r!==null&&Ts(t,e,r),i!==null&&Jd(t,e,i),o!==null&&hv(t,e,o)}var $s=class{constructor(e){this.changingThisBreaksApplicationSecurity=e}toString(){return`SafeValue must use [property]=binding: ${this.changingThisBreaksApplicationSecurity} (see ${eg})`}};function Aa(t){return t instanceof $s?t.changingThisBreaksApplicationSecurity:t}var pv="h",gv="b";var mv=(t,e,n)=>null;function xa(t,e,n=!1){return mv(t,e,n)}var Us=class{},Ni=class{};function vv(t){let e=Error(`No component factory found for ${se(t)}.`);return e[yv]=t,e}var yv="ngComponent";var Bs=class{resolveComponentFactory(e){throw vv(e)}},Zi=(()=>{let e=class e{};e.NULL=new Bs;let t=e;return t})();function Dv(){return Na(Me(),J())}function Na(t,e){return new lt(Ie(t,e))}var lt=(()=>{let e=class e{constructor(r){this.nativeElement=r}};e.__NG_ELEMENT_ID__=Dv;let t=e;return t})();var Qn=class{},kt=(()=>{let e=class e{constructor(){this.destroyNode=null}};e.__NG_ELEMENT_ID__=()=>Cv();let t=e;return t})();function Cv(){let t=J(),e=Me(),n=ut(e.index,t);return(ot(n)?n:t)[ne]}var wv=(()=>{let e=class e{};e.\u0275prov=w({token:e,providedIn:"root",factory:()=>null});let t=e;return t})(),Rt=class{constructor(e){this.full=e,this.major=e.split(".")[0],this.minor=e.split(".")[1],this.patch=e.split(".").slice(2).join(".")}},Ev=new Rt("17.0.7"),ms={};function ef(t){return Oa(t)?Array.isArray(t)||!(t instanceof Map)&&Symbol.iterator in t:!1}function bv(t,e){if(Array.isArray(t))for(let n=0;n<t.length;n++)e(t[n]);else{let n=t[Symbol.iterator](),r;for(;!(r=n.next()).done;)e(r.value)}}function Oa(t){return t!==null&&(typeof t=="function"||typeof t=="object")}var Hs=class{constructor(){}supports(e){return ef(e)}create(e){return new zs(e)}},Iv=(t,e)=>e,zs=class{constructor(e){this.length=0,this._linkedRecords=null,this._unlinkedRecords=null,this._previousItHead=null,this._itHead=null,this._itTail=null,this._additionsHead=null,this._additionsTail=null,this._movesHead=null,this._movesTail=null,this._removalsHead=null,this._removalsTail=null,this._identityChangesHead=null,this._identityChangesTail=null,this._trackByFn=e||Iv}forEachItem(e){let n;for(n=this._itHead;n!==null;n=n._next)e(n)}forEachOperation(e){let n=this._itHead,r=this._removalsHead,i=0,o=null;for(;n||r;){let s=!r||n&&n.currentIndex<fl(r,i,o)?n:r,a=fl(s,i,o),u=s.currentIndex;if(s===r)i--,r=r._nextRemoved;else if(n=n._next,s.previousIndex==null)i++;else{o||(o=[]);let c=a-i,l=u-i;if(c!=l){for(let f=0;f<c;f++){let h=f<o.length?o[f]:o[f]=0,g=h+f;l<=g&&g<c&&(o[f]=h+1)}let d=s.previousIndex;o[d]=l-c}}a!==u&&e(s,a,u)}}forEachPreviousItem(e){let n;for(n=this._previousItHead;n!==null;n=n._nextPrevious)e(n)}forEachAddedItem(e){let n;for(n=this._additionsHead;n!==null;n=n._nextAdded)e(n)}forEachMovedItem(e){let n;for(n=this._movesHead;n!==null;n=n._nextMoved)e(n)}forEachRemovedItem(e){let n;for(n=this._removalsHead;n!==null;n=n._nextRemoved)e(n)}forEachIdentityChange(e){let n;for(n=this._identityChangesHead;n!==null;n=n._nextIdentityChange)e(n)}diff(e){if(e==null&&(e=[]),!ef(e))throw new C(900,!1);return this.check(e)?this:null}onDestroy(){}check(e){this._reset();let n=this._itHead,r=!1,i,o,s;if(Array.isArray(e)){this.length=e.length;for(let a=0;a<this.length;a++)o=e[a],s=this._trackByFn(a,o),n===null||!Object.is(n.trackById,s)?(n=this._mismatch(n,o,s,a),r=!0):(r&&(n=this._verifyReinsertion(n,o,s,a)),Object.is(n.item,o)||this._addIdentityChange(n,o)),n=n._next}else i=0,bv(e,a=>{s=this._trackByFn(i,a),n===null||!Object.is(n.trackById,s)?(n=this._mismatch(n,a,s,i),r=!0):(r&&(n=this._verifyReinsertion(n,a,s,i)),Object.is(n.item,a)||this._addIdentityChange(n,a)),n=n._next,i++}),this.length=i;return this._truncate(n),this.collection=e,this.isDirty}get isDirty(){return this._additionsHead!==null||this._movesHead!==null||this._removalsHead!==null||this._identityChangesHead!==null}_reset(){if(this.isDirty){let e;for(e=this._previousItHead=this._itHead;e!==null;e=e._next)e._nextPrevious=e._next;for(e=this._additionsHead;e!==null;e=e._nextAdded)e.previousIndex=e.currentIndex;for(this._additionsHead=this._additionsTail=null,e=this._movesHead;e!==null;e=e._nextMoved)e.previousIndex=e.currentIndex;this._movesHead=this._movesTail=null,this._removalsHead=this._removalsTail=null,this._identityChangesHead=this._identityChangesTail=null}}_mismatch(e,n,r,i){let o;return e===null?o=this._itTail:(o=e._prev,this._remove(e)),e=this._unlinkedRecords===null?null:this._unlinkedRecords.get(r,null),e!==null?(Object.is(e.item,n)||this._addIdentityChange(e,n),this._reinsertAfter(e,o,i)):(e=this._linkedRecords===null?null:this._linkedRecords.get(r,i),e!==null?(Object.is(e.item,n)||this._addIdentityChange(e,n),this._moveAfter(e,o,i)):e=this._addAfter(new Gs(n,r),o,i)),e}_verifyReinsertion(e,n,r,i){let o=this._unlinkedRecords===null?null:this._unlinkedRecords.get(r,null);return o!==null?e=this._reinsertAfter(o,e._prev,i):e.currentIndex!=i&&(e.currentIndex=i,this._addToMoves(e,i)),e}_truncate(e){for(;e!==null;){let n=e._next;this._addToRemovals(this._unlink(e)),e=n}this._unlinkedRecords!==null&&this._unlinkedRecords.clear(),this._additionsTail!==null&&(this._additionsTail._nextAdded=null),this._movesTail!==null&&(this._movesTail._nextMoved=null),this._itTail!==null&&(this._itTail._next=null),this._removalsTail!==null&&(this._removalsTail._nextRemoved=null),this._identityChangesTail!==null&&(this._identityChangesTail._nextIdentityChange=null)}_reinsertAfter(e,n,r){this._unlinkedRecords!==null&&this._unlinkedRecords.remove(e);let i=e._prevRemoved,o=e._nextRemoved;return i===null?this._removalsHead=o:i._nextRemoved=o,o===null?this._removalsTail=i:o._prevRemoved=i,this._insertAfter(e,n,r),this._addToMoves(e,r),e}_moveAfter(e,n,r){return this._unlink(e),this._insertAfter(e,n,r),this._addToMoves(e,r),e}_addAfter(e,n,r){return this._insertAfter(e,n,r),this._additionsTail===null?this._additionsTail=this._additionsHead=e:this._additionsTail=this._additionsTail._nextAdded=e,e}_insertAfter(e,n,r){let i=n===null?this._itHead:n._next;return e._next=i,e._prev=n,i===null?this._itTail=e:i._prev=e,n===null?this._itHead=e:n._next=e,this._linkedRecords===null&&(this._linkedRecords=new Oi),this._linkedRecords.put(e),e.currentIndex=r,e}_remove(e){return this._addToRemovals(this._unlink(e))}_unlink(e){this._linkedRecords!==null&&this._linkedRecords.remove(e);let n=e._prev,r=e._next;return n===null?this._itHead=r:n._next=r,r===null?this._itTail=n:r._prev=n,e}_addToMoves(e,n){return e.previousIndex===n||(this._movesTail===null?this._movesTail=this._movesHead=e:this._movesTail=this._movesTail._nextMoved=e),e}_addToRemovals(e){return this._unlinkedRecords===null&&(this._unlinkedRecords=new Oi),this._unlinkedRecords.put(e),e.currentIndex=null,e._nextRemoved=null,this._removalsTail===null?(this._removalsTail=this._removalsHead=e,e._prevRemoved=null):(e._prevRemoved=this._removalsTail,this._removalsTail=this._removalsTail._nextRemoved=e),e}_addIdentityChange(e,n){return e.item=n,this._identityChangesTail===null?this._identityChangesTail=this._identityChangesHead=e:this._identityChangesTail=this._identityChangesTail._nextIdentityChange=e,e}},Gs=class{constructor(e,n){this.item=e,this.trackById=n,this.currentIndex=null,this.previousIndex=null,this._nextPrevious=null,this._prev=null,this._next=null,this._prevDup=null,this._nextDup=null,this._prevRemoved=null,this._nextRemoved=null,this._nextAdded=null,this._nextMoved=null,this._nextIdentityChange=null}},Ws=class{constructor(){this._head=null,this._tail=null}add(e){this._head===null?(this._head=this._tail=e,e._nextDup=null,e._prevDup=null):(this._tail._nextDup=e,e._prevDup=this._tail,e._nextDup=null,this._tail=e)}get(e,n){let r;for(r=this._head;r!==null;r=r._nextDup)if((n===null||n<=r.currentIndex)&&Object.is(r.trackById,e))return r;return null}remove(e){let n=e._prevDup,r=e._nextDup;return n===null?this._head=r:n._nextDup=r,r===null?this._tail=n:r._prevDup=n,this._head===null}},Oi=class{constructor(){this.map=new Map}put(e){let n=e.trackById,r=this.map.get(n);r||(r=new Ws,this.map.set(n,r)),r.add(e)}get(e,n){let r=e,i=this.map.get(r);return i?i.get(e,n):null}remove(e){let n=e.trackById;return this.map.get(n).remove(e)&&this.map.delete(n),e}get isEmpty(){return this.map.size===0}clear(){this.map.clear()}};function fl(t,e,n){let r=t.previousIndex;if(r===null)return r;let i=0;return n&&r<n.length&&(i=n[r]),r+e+i}var qs=class{constructor(){}supports(e){return e instanceof Map||Oa(e)}create(){return new Zs}},Zs=class{constructor(){this._records=new Map,this._mapHead=null,this._appendAfter=null,this._previousMapHead=null,this._changesHead=null,this._changesTail=null,this._additionsHead=null,this._additionsTail=null,this._removalsHead=null,this._removalsTail=null}get isDirty(){return this._additionsHead!==null||this._changesHead!==null||this._removalsHead!==null}forEachItem(e){let n;for(n=this._mapHead;n!==null;n=n._next)e(n)}forEachPreviousItem(e){let n;for(n=this._previousMapHead;n!==null;n=n._nextPrevious)e(n)}forEachChangedItem(e){let n;for(n=this._changesHead;n!==null;n=n._nextChanged)e(n)}forEachAddedItem(e){let n;for(n=this._additionsHead;n!==null;n=n._nextAdded)e(n)}forEachRemovedItem(e){let n;for(n=this._removalsHead;n!==null;n=n._nextRemoved)e(n)}diff(e){if(!e)e=new Map;else if(!(e instanceof Map||Oa(e)))throw new C(900,!1);return this.check(e)?this:null}onDestroy(){}check(e){this._reset();let n=this._mapHead;if(this._appendAfter=null,this._forEach(e,(r,i)=>{if(n&&n.key===i)this._maybeAddToChanges(n,r),this._appendAfter=n,n=n._next;else{let o=this._getOrCreateRecordForKey(i,r);n=this._insertBeforeOrAppend(n,o)}}),n){n._prev&&(n._prev._next=null),this._removalsHead=n;for(let r=n;r!==null;r=r._nextRemoved)r===this._mapHead&&(this._mapHead=null),this._records.delete(r.key),r._nextRemoved=r._next,r.previousValue=r.currentValue,r.currentValue=null,r._prev=null,r._next=null}return this._changesTail&&(this._changesTail._nextChanged=null),this._additionsTail&&(this._additionsTail._nextAdded=null),this.isDirty}_insertBeforeOrAppend(e,n){if(e){let r=e._prev;return n._next=e,n._prev=r,e._prev=n,r&&(r._next=n),e===this._mapHead&&(this._mapHead=n),this._appendAfter=e,e}return this._appendAfter?(this._appendAfter._next=n,n._prev=this._appendAfter):this._mapHead=n,this._appendAfter=n,null}_getOrCreateRecordForKey(e,n){if(this._records.has(e)){let i=this._records.get(e);this._maybeAddToChanges(i,n);let o=i._prev,s=i._next;return o&&(o._next=s),s&&(s._prev=o),i._next=null,i._prev=null,i}let r=new Ys(e);return this._records.set(e,r),r.currentValue=n,this._addToAdditions(r),r}_reset(){if(this.isDirty){let e;for(this._previousMapHead=this._mapHead,e=this._previousMapHead;e!==null;e=e._next)e._nextPrevious=e._next;for(e=this._changesHead;e!==null;e=e._nextChanged)e.previousValue=e.currentValue;for(e=this._additionsHead;e!=null;e=e._nextAdded)e.previousValue=e.currentValue;this._changesHead=this._changesTail=null,this._additionsHead=this._additionsTail=null,this._removalsHead=null}}_maybeAddToChanges(e,n){Object.is(n,e.currentValue)||(e.previousValue=e.currentValue,e.currentValue=n,this._addToChanges(e))}_addToAdditions(e){this._additionsHead===null?this._additionsHead=this._additionsTail=e:(this._additionsTail._nextAdded=e,this._additionsTail=e)}_addToChanges(e){this._changesHead===null?this._changesHead=this._changesTail=e:(this._changesTail._nextChanged=e,this._changesTail=e)}_forEach(e,n){e instanceof Map?e.forEach(n):Object.keys(e).forEach(r=>n(e[r],r))}},Ys=class{constructor(e){this.key=e,this.previousValue=null,this.currentValue=null,this._nextPrevious=null,this._next=null,this._prev=null,this._nextAdded=null,this._nextRemoved=null,this._nextChanged=null}};function hl(){return new Ra([new Hs])}var Ra=(()=>{let e=class e{constructor(r){this.factories=r}static create(r,i){if(i!=null){let o=i.factories.slice();r=r.concat(o)}return new e(r)}static extend(r){return{provide:e,useFactory:i=>e.create(r,i||hl()),deps:[[e,new Da,new Wi]]}}find(r){let i=this.factories.find(o=>o.supports(r));if(i!=null)return i;throw new C(901,!1)}};e.\u0275prov=w({token:e,providedIn:"root",factory:hl});let t=e;return t})();function pl(){return new Pa([new qs])}var Pa=(()=>{let e=class e{constructor(r){this.factories=r}static create(r,i){if(i){let o=i.factories.slice();r=r.concat(o)}return new e(r)}static extend(r){return{provide:e,useFactory:i=>e.create(r,i||pl()),deps:[[e,new Da,new Wi]]}}find(r){let i=this.factories.find(o=>o.supports(r));if(i)return i;throw new C(901,!1)}};e.\u0275prov=w({token:e,providedIn:"root",factory:pl});let t=e;return t})();function Ri(t,e,n,r,i=!1){for(;n!==null;){let o=e[n.index];o!==null&&r.push(Fe(o)),we(o)&&Mv(o,r);let s=n.type;if(s&8)Ri(t,e,n.child,r);else if(s&32){let a=Ma(n,e),u;for(;u=a();)r.push(u)}else if(s&16){let a=Kd(e,n);if(Array.isArray(a))r.push(...a);else{let u=_a(e[Pe]);Ri(u[R],u,a,r,!0)}}n=i?n.projectionNext:n.next}return r}function Mv(t,e){for(let n=me;n<t.length;n++){let r=t[n],i=r[R].firstChild;i!==null&&Ri(r[R],r,i,e)}t[xt]!==t[We]&&e.push(t[xt])}var tf=[];function _v(t){return t[Tt]??Sv(t)}function Sv(t){let e=tf.pop()??Object.create(Av);return e.lView=t,e}function Tv(t){t.lView[Tt]!==t&&(t.lView=null,tf.push(t))}var Av=V(m({},lc),{consumerIsAlwaysLive:!0,consumerMarkedDirty:t=>{zi(t.lView)},consumerOnSignalRead(){this.lView[Tt]=this}}),xv="ngOriginalError";function vs(t){return t[xv]}var Ge=class{constructor(){this._console=console}handleError(e){let n=this._findOriginalError(e);this._console.error("ERROR",e),n&&this._console.error("ORIGINAL ERROR",n)}_findOriginalError(e){let n=e&&vs(e);for(;n&&vs(n);)n=vs(n);return n||null}},nf=new E("",{providedIn:"root",factory:()=>p(Ge).handleError.bind(void 0)});var rf=!1,Nv=new E("",{providedIn:"root",factory:()=>rf});var Qe={};function Lt(t){of(qe(),J(),Ft()+t,!1)}function of(t,e,n,r){if(!r)if((e[T]&3)===3){let o=t.preOrderCheckHooks;o!==null&&pi(e,o,n)}else{let o=t.preOrderHooks;o!==null&&gi(e,o,0,n)}Nt(n)}function U(t,e=O.Default){let n=J();if(n===null)return I(t,e);let r=Me();return Sd(r,n,ie(t),e)}function Ov(t,e){let n=t.hostBindingOpCodes;if(n!==null)try{for(let r=0;r<n.length;r++){let i=n[r];if(i<0)Nt(~i);else{let o=i,s=n[++r],a=n[++r];nm(s,o);let u=e[o];a(2,u)}}}finally{Nt(-1)}}function Fa(t,e,n,r,i,o,s,a,u,c,l){let d=e.blueprint.slice();return d[We]=i,d[T]=r|4|128|8,(c!==null||t&&t[T]&2048)&&(d[T]|=2048),nd(d),d[K]=d[nr]=t,d[He]=n,d[qn]=s||t&&t[qn],d[ne]=a||t&&t[ne],d[dn]=u||t&&t[dn]||null,d[be]=o,d[Bi]=Bm(),d[Ei]=l,d[ql]=c,d[Pe]=e.type==2?t[Pe]:d,d}function ka(t,e,n,r,i){let o=t.data[e];if(o===null)o=Rv(t,e,n,r,i),tm()&&(o.flags|=32);else if(o.type&64){o.type=n,o.value=r,o.attrs=i;let s=Qg();o.injectorIndex=s===null?-1:s.injectorIndex}return Gi(o,!0),o}function Rv(t,e,n,r,i){let o=sd(),s=ad(),a=s?o:o&&o.parent,u=t.data[e]=$v(t,a,n,e,r,i);return t.firstChild===null&&(t.firstChild=u),o!==null&&(s?o.child==null&&u.parent!==null&&(o.child=u):o.next===null&&(o.next=u,u.prev=o)),u}function sf(t,e,n,r){if(n===0)return-1;let i=e.length;for(let o=0;o<n;o++)e.push(r),t.blueprint.push(r),t.data.push(null);return i}function af(t,e,n,r,i){let o=Ft(),s=r&2;try{Nt(-1),s&&e.length>At&&of(t,e,At,!1),Ne(s?2:0,i),n(r,i)}finally{Nt(o),Ne(s?3:1,i)}}function uf(t,e,n){if(Yl(e)){let r=fe(null);try{let i=e.directiveStart,o=e.directiveEnd;for(let s=i;s<o;s++){let a=t.data[s];a.contentQueries&&a.contentQueries(1,n[s],s)}}finally{fe(r)}}}function Pv(t,e,n){od()&&(Zv(t,e,n,Ie(n,e)),(n.flags&64)===64&&ff(t,e,n))}function Fv(t,e,n=Ie){let r=e.localNames;if(r!==null){let i=e.index+1;for(let o=0;o<r.length;o+=2){let s=r[o+1],a=s===-1?n(e,t):t[s];t[i++]=a}}}function cf(t){let e=t.tView;return e===null||e.incompleteFirstPass?t.tView=lf(1,null,t.template,t.decls,t.vars,t.directiveDefs,t.pipeDefs,t.viewQuery,t.schemas,t.consts,t.id):e}function lf(t,e,n,r,i,o,s,a,u,c,l){let d=At+r,f=d+i,h=kv(d,f),g=typeof c=="function"?c():c;return h[R]={type:t,blueprint:h,template:n,queries:null,viewQuery:a,declTNode:e,data:h.slice().fill(null,d),bindingStartIndex:d,expandoStartIndex:f,hostBindingOpCodes:null,firstCreatePass:!0,firstUpdatePass:!0,staticViewQueries:!1,staticContentQueries:!1,preOrderHooks:null,preOrderCheckHooks:null,contentHooks:null,contentCheckHooks:null,viewHooks:null,viewCheckHooks:null,destroyHooks:null,cleanup:null,contentQueries:null,components:null,directiveRegistry:typeof o=="function"?o():o,pipeRegistry:typeof s=="function"?s():s,firstChild:null,schemas:u,consts:g,incompleteFirstPass:!1,ssrId:l}}function kv(t,e){let n=[];for(let r=0;r<e;r++)n.push(r<t?null:Qe);return n}function Lv(t,e,n,r){let o=r.get(Nv,rf)||n===Re.ShadowDom,s=t.selectRootElement(e,o);return Vv(s),s}function Vv(t){jv(t)}var jv=t=>null;function $v(t,e,n,r,i,o){let s=e?e.injectorIndex:-1,a=0;return qg()&&(a|=128),{type:n,index:r,insertBeforeIndex:null,injectorIndex:s,directiveStart:-1,directiveEnd:-1,directiveStylingLast:-1,componentOffset:-1,propertyBindings:null,flags:a,providerIndexes:0,value:i,attrs:o,mergedAttrs:null,localNames:null,initialInputs:void 0,inputs:null,outputs:null,tView:null,next:null,prev:null,projectionNext:null,child:null,parent:e,projection:null,styles:null,stylesWithoutHost:null,residualStyles:void 0,classes:null,classesWithoutHost:null,residualClasses:void 0,classBindings:0,styleBindings:0}}function gl(t,e,n,r){for(let i in t)if(t.hasOwnProperty(i)){n=n===null?{}:n;let o=t[i];r===null?ml(n,e,i,o):r.hasOwnProperty(i)&&ml(n,e,r[i],o)}return n}function ml(t,e,n,r){t.hasOwnProperty(n)?t[n].push(e,r):t[n]=[e,r]}function Uv(t,e,n){let r=e.directiveStart,i=e.directiveEnd,o=t.data,s=e.attrs,a=[],u=null,c=null;for(let l=r;l<i;l++){let d=o[l],f=n?n.get(d):null,h=f?f.inputs:null,g=f?f.outputs:null;u=gl(d.inputs,l,u,h),c=gl(d.outputs,l,c,g);let _=u!==null&&s!==null&&!$l(e)?ry(u,l,s):null;a.push(_)}u!==null&&(u.hasOwnProperty("class")&&(e.flags|=8),u.hasOwnProperty("style")&&(e.flags|=16)),e.initialInputs=a,e.inputs=u,e.outputs=c}function Bv(t){return t==="class"?"className":t==="for"?"htmlFor":t==="formaction"?"formAction":t==="innerHtml"?"innerHTML":t==="readonly"?"readOnly":t==="tabindex"?"tabIndex":t}function Hv(t,e,n,r,i,o,s,a){let u=Ie(e,n),c=e.inputs,l;!a&&c!=null&&(l=c[r])?(Va(t,n,l,r,i),Hi(e)&&zv(n,e.index)):e.type&3?(r=Bv(r),i=s!=null?s(i,e.value||"",r):i,o.setProperty(u,r,i)):e.type&12}function zv(t,e){let n=ut(e,t);n[T]&16||(n[T]|=64)}function Gv(t,e,n,r){if(od()){let i=r===null?null:{"":-1},o=Qv(t,n),s,a;o===null?s=a=null:[s,a]=o,s!==null&&df(t,e,n,s,i,a),i&&Kv(n,r,i)}n.mergedAttrs=Gn(n.mergedAttrs,n.attrs)}function df(t,e,n,r,i,o){for(let c=0;c<r.length;c++)Os(Si(n,e),t,r[c].type);Xv(n,t.data.length,r.length);for(let c=0;c<r.length;c++){let l=r[c];l.providersResolver&&l.providersResolver(l)}let s=!1,a=!1,u=sf(t,e,r.length,null);for(let c=0;c<r.length;c++){let l=r[c];n.mergedAttrs=Gn(n.mergedAttrs,l.hostAttrs),ey(t,n,e,u,l),Jv(u,l,i),l.contentQueries!==null&&(n.flags|=4),(l.hostBindings!==null||l.hostAttrs!==null||l.hostVars!==0)&&(n.flags|=64);let d=l.type.prototype;!s&&(d.ngOnChanges||d.ngOnInit||d.ngDoCheck)&&((t.preOrderHooks??=[]).push(n.index),s=!0),!a&&(d.ngOnChanges||d.ngDoCheck)&&((t.preOrderCheckHooks??=[]).push(n.index),a=!0),u++}Uv(t,n,o)}function Wv(t,e,n,r,i){let o=i.hostBindings;if(o){let s=t.hostBindingOpCodes;s===null&&(s=t.hostBindingOpCodes=[]);let a=~e.index;qv(s)!=a&&s.push(a),s.push(n,r,o)}}function qv(t){let e=t.length;for(;e>0;){let n=t[--e];if(typeof n=="number"&&n<0)return n}return 0}function Zv(t,e,n,r){let i=n.directiveStart,o=n.directiveEnd;Hi(n)&&ty(e,n,t.data[i+n.componentOffset]),t.firstCreatePass||Si(n,e),mn(r,e);let s=n.initialInputs;for(let a=i;a<o;a++){let u=t.data[a],c=pn(e,t,a,n);if(mn(c,e),s!==null&&ny(e,a-i,c,u,n,s),st(u)){let l=ut(n.index,e);l[He]=pn(e,t,a,n)}}}function ff(t,e,n){let r=n.directiveStart,i=n.directiveEnd,o=n.index,s=rm();try{Nt(o);for(let a=r;a<i;a++){let u=t.data[a],c=e[a];xs(a),(u.hostBindings!==null||u.hostVars!==0||u.hostAttrs!==null)&&Yv(u,c)}}finally{Nt(-1),xs(s)}}function Yv(t,e){t.hostBindings!==null&&t.hostBindings(1,e)}function Qv(t,e){let n=t.directiveRegistry,r=null,i=null;if(n)for(let o=0;o<n.length;o++){let s=n[o];if(_g(e,s.selectors,!1))if(r||(r=[]),st(s))if(s.findHostDirectiveDefs!==null){let a=[];i=i||new Map,s.findHostDirectiveDefs(s,a,i),r.unshift(...a,s);let u=a.length;Qs(t,e,u)}else r.unshift(s),Qs(t,e,0);else i=i||new Map,s.findHostDirectiveDefs?.(s,r,i),r.push(s)}return r===null?null:[r,i]}function Qs(t,e,n){e.componentOffset=n,(t.components??=[]).push(e.index)}function Kv(t,e,n){if(e){let r=t.localNames=[];for(let i=0;i<e.length;i+=2){let o=n[e[i+1]];if(o==null)throw new C(-301,!1);r.push(e[i],o)}}}function Jv(t,e,n){if(n){if(e.exportAs)for(let r=0;r<e.exportAs.length;r++)n[e.exportAs[r]]=t;st(e)&&(n[""]=t)}}function Xv(t,e,n){t.flags|=1,t.directiveStart=e,t.directiveEnd=e+n,t.providerIndexes=e}function ey(t,e,n,r,i){t.data[r]=i;let o=i.factory||(i.factory=hn(i.type,!0)),s=new Ot(o,st(i),U);t.blueprint[r]=s,n[r]=s,Wv(t,e,r,sf(t,n,i.hostVars,Qe),i)}function ty(t,e,n){let r=Ie(e,t),i=cf(n),o=t[qn].rendererFactory,s=16;n.signals?s=4096:n.onPush&&(s=64);let a=La(t,Fa(t,i,null,s,r,e,null,o.createRenderer(r,n),null,null,null));t[e.index]=a}function ny(t,e,n,r,i,o){let s=o[e];if(s!==null)for(let a=0;a<s.length;){let u=s[a++],c=s[a++],l=s[a++];hf(r,n,u,c,l)}}function hf(t,e,n,r,i){let o=fe(null);try{let s=t.inputTransforms;s!==null&&s.hasOwnProperty(r)&&(i=s[r].call(e,i)),t.setInput!==null?t.setInput(e,i,n,r):e[r]=i}finally{fe(o)}}function ry(t,e,n){let r=null,i=0;for(;i<n.length;){let o=n[i];if(o===0){i+=4;continue}else if(o===5){i+=2;continue}if(typeof o=="number")break;if(t.hasOwnProperty(o)){r===null&&(r=[]);let s=t[o];for(let a=0;a<s.length;a+=2)if(s[a]===e){r.push(o,s[a+1],n[i+1]);break}}i+=2}return r}function iy(t,e,n,r){return[t,!0,0,e,null,r,null,n,null,null]}function pf(t,e){let n=t.contentQueries;if(n!==null){let r=fe(null);try{for(let i=0;i<n.length;i+=2){let o=n[i],s=n[i+1];if(s!==-1){let a=t.data[s];ld(o),a.contentQueries(2,e[s],s)}}}finally{fe(r)}}}function La(t,e){return t[Zn]?t[tl][Ce]=e:t[Zn]=e,t[tl]=e,e}function Ks(t,e,n){ld(0);let r=fe(null);try{e(t,n)}finally{fe(r)}}function oy(t){return t[Wn]||(t[Wn]=[])}function sy(t){return t.cleanup||(t.cleanup=[])}function gf(t,e){let n=t[dn],r=n?n.get(Ge,null):null;r&&r.handleError(e)}function Va(t,e,n,r,i){for(let o=0;o<n.length;){let s=n[o++],a=n[o++],u=e[s],c=t.data[s];hf(c,u,r,a,i)}}function mf(t,e,n){let r=ed(e,t);qm(t[ne],r,n)}var ay=100;function uy(t,e=!0){let n=t[qn],r=n.rendererFactory,i=n.afterRenderEventManager,o=!1;o||(r.begin?.(),i?.begin());try{cy(t)}catch(s){throw e&&gf(t,s),s}finally{o||(r.end?.(),n.inlineEffectRunner?.flush(),i?.end())}}function cy(t){Js(t,0);let e=0;for(;rd(t);){if(e===ay)throw new C(103,!1);e++,Js(t,1)}}function ly(t,e,n,r){let i=e[T];if((i&256)===256)return;let o=!1;!o&&e[qn].inlineEffectRunner?.flush(),ga(e);let s=null,a=null;!o&&dy(t)&&(a=_v(e),s=dc(a));try{nd(e),em(t.bindingStartIndex),n!==null&&af(t,e,n,2,r);let u=(i&3)===3;if(!o)if(u){let d=t.preOrderCheckHooks;d!==null&&pi(e,d,null)}else{let d=t.preOrderHooks;d!==null&&gi(e,d,0,null),ds(e,0)}if(fy(e),vf(e,0),t.contentQueries!==null&&pf(t,e),!o)if(u){let d=t.contentCheckHooks;d!==null&&pi(e,d)}else{let d=t.contentHooks;d!==null&&gi(e,d,1),ds(e,1)}Ov(t,e);let c=t.components;c!==null&&Df(e,c,0);let l=t.viewQuery;if(l!==null&&Ks(2,l,r),!o)if(u){let d=t.viewCheckHooks;d!==null&&pi(e,d)}else{let d=t.viewHooks;d!==null&&gi(e,d,2),ds(e,2)}if(t.firstUpdatePass===!0&&(t.firstUpdatePass=!1),e[ls]){for(let d of e[ls])d();e[ls]=null}o||(e[T]&=-73)}catch(u){throw zi(e),u}finally{a!==null&&(fc(a,s),Tv(a)),ma()}}function dy(t){return t.type!==2}function vf(t,e){for(let n=Hd(t);n!==null;n=zd(n)){n[T]&=~fn.HasChildViewsToRefresh;for(let r=me;r<n.length;r++){let i=n[r];yf(i,e)}}}function fy(t){for(let e=Hd(t);e!==null;e=zd(e)){if(!(e[T]&fn.HasTransplantedViews))continue;let n=e[Ii];for(let r=0;r<n.length;r++){let i=n[r],o=i[K];Bg(i)}}}function hy(t,e,n){let r=ut(e,t);yf(r,n)}function yf(t,e){pa(t)&&Js(t,e)}function Js(t,e){let r=t[R],i=t[T],o=t[Tt],s=!!(e===0&&i&16);if(s||=!!(i&64&&e===0),s||=!!(i&1024),s||=!!(o?.dirty&&Lo(o)),o&&(o.dirty=!1),t[T]&=-9217,s)ly(r,t,r.template,t[He]);else if(i&8192){vf(t,1);let a=r.components;a!==null&&Df(t,a,1)}}function Df(t,e,n){for(let r=0;r<e.length;r++)hy(t,e[r],n)}function ja(t){for(;t;){t[T]|=64;let e=_a(t);if(Fg(t)&&!e)return t;t=e}return null}var vn=class{get rootNodes(){let e=this._lView,n=e[R];return Ri(n,e,n.firstChild,[])}constructor(e,n,r=!0){this._lView=e,this._cdRefInjectingView=n,this.notifyErrorHandler=r,this._appRef=null,this._attachedToViewContainer=!1}get context(){return this._lView[He]}set context(e){this._lView[He]=e}get destroyed(){return(this._lView[T]&256)===256}destroy(){if(this._appRef)this._appRef.detachView(this);else if(this._attachedToViewContainer){let e=this._lView[K];if(we(e)){let n=e[bi],r=n?n.indexOf(this):-1;r>-1&&(Vs(e,r),Ti(n,r))}this._attachedToViewContainer=!1}Zd(this._lView[R],this._lView)}onDestroy(e){Hg(this._lView,e)}markForCheck(){ja(this._cdRefInjectingView||this._lView)}detach(){this._lView[T]&=-129}reattach(){id(this._lView),this._lView[T]|=128}detectChanges(){this._lView[T]|=1024,uy(this._lView,this.notifyErrorHandler)}checkNoChanges(){}attachToViewContainerRef(){if(this._appRef)throw new C(902,!1);this._attachedToViewContainer=!0}detachFromAppRef(){this._appRef=null,Qm(this._lView[R],this._lView)}attachToAppRef(e){if(this._attachedToViewContainer)throw new C(902,!1);this._appRef=e}},En=(()=>{let e=class e{};e.__NG_ELEMENT_ID__=py;let t=e;return t})();function py(t){return gy(Me(),J(),(t&16)===16)}function gy(t,e,n){if(Hi(t)&&!n){let r=ut(t.index,e);return new vn(r,r)}else if(t.type&47){let r=e[Pe];return new vn(r,e)}return null}var vl=new Set;function $a(t){vl.has(t)||(vl.add(t),performance?.mark?.("mark_feature_usage",{detail:{feature:t}}))}var Xs=class extends G{constructor(e=!1){super(),this.__isAsync=e}emit(e){super.next(e)}subscribe(e,n,r){let i=e,o=n||(()=>null),s=r;if(e&&typeof e=="object"){let u=e;i=u.next?.bind(u),o=u.error?.bind(u),s=u.complete?.bind(u)}this.__isAsync&&(o=ys(o),i&&(i=ys(i)),s&&(s=ys(s)));let a=super.subscribe({next:i,error:o,complete:s});return e instanceof q&&e.add(a),a}};function ys(t){return e=>{setTimeout(t,void 0,e)}}var oe=Xs;function yl(...t){}function my(){let t=typeof Un.requestAnimationFrame=="function",e=Un[t?"requestAnimationFrame":"setTimeout"],n=Un[t?"cancelAnimationFrame":"clearTimeout"];if(typeof Zone<"u"&&e&&n){let r=e[Zone.__symbol__("OriginalDelegate")];r&&(e=r);let i=n[Zone.__symbol__("OriginalDelegate")];i&&(n=i)}return{nativeRequestAnimationFrame:e,nativeCancelAnimationFrame:n}}var H=class t{constructor({enableLongStackTrace:e=!1,shouldCoalesceEventChangeDetection:n=!1,shouldCoalesceRunChangeDetection:r=!1}){if(this.hasPendingMacrotasks=!1,this.hasPendingMicrotasks=!1,this.isStable=!0,this.onUnstable=new oe(!1),this.onMicrotaskEmpty=new oe(!1),this.onStable=new oe(!1),this.onError=new oe(!1),typeof Zone>"u")throw new C(908,!1);Zone.assertZonePatched();let i=this;i._nesting=0,i._outer=i._inner=Zone.current,Zone.TaskTrackingZoneSpec&&(i._inner=i._inner.fork(new Zone.TaskTrackingZoneSpec)),e&&Zone.longStackTraceZoneSpec&&(i._inner=i._inner.fork(Zone.longStackTraceZoneSpec)),i.shouldCoalesceEventChangeDetection=!r&&n,i.shouldCoalesceRunChangeDetection=r,i.lastRequestAnimationFrameId=-1,i.nativeRequestAnimationFrame=my().nativeRequestAnimationFrame,Dy(i)}static isInAngularZone(){return typeof Zone<"u"&&Zone.current.get("isAngularZone")===!0}static assertInAngularZone(){if(!t.isInAngularZone())throw new C(909,!1)}static assertNotInAngularZone(){if(t.isInAngularZone())throw new C(909,!1)}run(e,n,r){return this._inner.run(e,n,r)}runTask(e,n,r,i){let o=this._inner,s=o.scheduleEventTask("NgZoneEvent: "+i,e,vy,yl,yl);try{return o.runTask(s,n,r)}finally{o.cancelTask(s)}}runGuarded(e,n,r){return this._inner.runGuarded(e,n,r)}runOutsideAngular(e){return this._outer.run(e)}},vy={};function Ua(t){if(t._nesting==0&&!t.hasPendingMicrotasks&&!t.isStable)try{t._nesting++,t.onMicrotaskEmpty.emit(null)}finally{if(t._nesting--,!t.hasPendingMicrotasks)try{t.runOutsideAngular(()=>t.onStable.emit(null))}finally{t.isStable=!0}}}function yy(t){t.isCheckStableRunning||t.lastRequestAnimationFrameId!==-1||(t.lastRequestAnimationFrameId=t.nativeRequestAnimationFrame.call(Un,()=>{t.fakeTopEventTask||(t.fakeTopEventTask=Zone.root.scheduleEventTask("fakeTopEventTask",()=>{t.lastRequestAnimationFrameId=-1,ea(t),t.isCheckStableRunning=!0,Ua(t),t.isCheckStableRunning=!1},void 0,()=>{},()=>{})),t.fakeTopEventTask.invoke()}),ea(t))}function Dy(t){let e=()=>{yy(t)};t._inner=t._inner.fork({name:"angular",properties:{isAngularZone:!0},onInvokeTask:(n,r,i,o,s,a)=>{if(Cy(a))return n.invokeTask(i,o,s,a);try{return Dl(t),n.invokeTask(i,o,s,a)}finally{(t.shouldCoalesceEventChangeDetection&&o.type==="eventTask"||t.shouldCoalesceRunChangeDetection)&&e(),Cl(t)}},onInvoke:(n,r,i,o,s,a,u)=>{try{return Dl(t),n.invoke(i,o,s,a,u)}finally{t.shouldCoalesceRunChangeDetection&&e(),Cl(t)}},onHasTask:(n,r,i,o)=>{n.hasTask(i,o),r===i&&(o.change=="microTask"?(t._hasPendingMicrotasks=o.microTask,ea(t),Ua(t)):o.change=="macroTask"&&(t.hasPendingMacrotasks=o.macroTask))},onHandleError:(n,r,i,o)=>(n.handleError(i,o),t.runOutsideAngular(()=>t.onError.emit(o)),!1)})}function ea(t){t._hasPendingMicrotasks||(t.shouldCoalesceEventChangeDetection||t.shouldCoalesceRunChangeDetection)&&t.lastRequestAnimationFrameId!==-1?t.hasPendingMicrotasks=!0:t.hasPendingMicrotasks=!1}function Dl(t){t._nesting++,t.isStable&&(t.isStable=!1,t.onUnstable.emit(null))}function Cl(t){t._nesting--,Ua(t)}var Cf=new E("",{providedIn:"root",factory:wf});function wf(){let t=p(H),e=!0,n=new S(i=>{e=t.isStable&&!t.hasPendingMacrotasks&&!t.hasPendingMicrotasks,t.runOutsideAngular(()=>{i.next(e),i.complete()})}),r=new S(i=>{let o;t.runOutsideAngular(()=>{o=t.onStable.subscribe(()=>{H.assertNotInAngularZone(),queueMicrotask(()=>{!e&&!t.hasPendingMacrotasks&&!t.hasPendingMicrotasks&&(e=!0,i.next(!0))})})});let s=t.onUnstable.subscribe(()=>{H.assertInAngularZone(),e&&(e=!1,t.runOutsideAngular(()=>{i.next(!1)}))});return()=>{o.unsubscribe(),s.unsubscribe()}});return rn(n,r.pipe(as()))}function Cy(t){return!Array.isArray(t)||t.length!==1?!1:t[0].data?.__ignore_ng_zone__===!0}var wy=(()=>{let e=class e{constructor(){this.renderDepth=0,this.handler=null,this.internalCallbacks=[]}begin(){this.handler?.validateBegin(),this.renderDepth++}end(){if(this.renderDepth--,this.renderDepth===0){for(let r of this.internalCallbacks)r();this.internalCallbacks.length=0,this.handler?.execute()}}ngOnDestroy(){this.handler?.destroy(),this.handler=null,this.internalCallbacks.length=0}};e.\u0275prov=w({token:e,providedIn:"root",factory:()=>new e});let t=e;return t})();function Ey(t,e){let n=ut(e,t),r=n[R];by(r,n);let i=n[We];i!==null&&n[Ei]===null&&(n[Ei]=xa(i,n[dn])),Ef(r,n,n[He])}function by(t,e){for(let n=e.length;n<t.blueprint.length;n++)e.push(t.blueprint[n])}function Ef(t,e,n){ga(e);try{let r=t.viewQuery;r!==null&&Ks(1,r,n);let i=t.template;i!==null&&af(t,e,i,1,n),t.firstCreatePass&&(t.firstCreatePass=!1),t.staticContentQueries&&pf(t,e),t.staticViewQueries&&Ks(2,t.viewQuery,n);let o=t.components;o!==null&&Iy(e,o)}catch(r){throw t.firstCreatePass&&(t.incompleteFirstPass=!0,t.firstCreatePass=!1),r}finally{e[T]&=-5,ma()}}function Iy(t,e){for(let n=0;n<e.length;n++)Ey(t,e[n])}function ta(t,e,n){let r=n?t.styles:null,i=n?t.classes:null,o=0;if(e!==null)for(let s=0;s<e.length;s++){let a=e[s];if(typeof a=="number")o=a;else if(o==1)i=Gc(i,a);else if(o==2){let u=a,c=e[++s];r=Gc(r,u+": "+c+";")}}n?t.styles=r:t.stylesWithoutHost=r,n?t.classes=i:t.classesWithoutHost=i}var Pi=class extends Zi{constructor(e){super(),this.ngModule=e}resolveComponentFactory(e){let n=St(e);return new Kn(n,this.ngModule)}};function wl(t){let e=[];for(let n in t)if(t.hasOwnProperty(n)){let r=t[n];e.push({propName:r,templateName:n})}return e}function My(t){let e=t.toLowerCase();return e==="svg"?jg:e==="math"?$g:null}var na=class{constructor(e,n){this.injector=e,this.parentInjector=n}get(e,n,r){r=$i(r);let i=this.injector.get(e,ms,r);return i!==ms||n===ms?i:this.parentInjector.get(e,n,r)}},Kn=class extends Ni{get inputs(){let e=this.componentDef,n=e.inputTransforms,r=wl(e.inputs);if(n!==null)for(let i of r)n.hasOwnProperty(i.propName)&&(i.transform=n[i.propName]);return r}get outputs(){return wl(this.componentDef.outputs)}constructor(e,n){super(),this.componentDef=e,this.ngModule=n,this.componentType=e.type,this.selector=xg(e.selectors),this.ngContentSelectors=e.ngContentSelectors?e.ngContentSelectors:[],this.isBoundToModule=!!n}create(e,n,r,i){i=i||this.ngModule;let o=i instanceof le?i:i?.injector;o&&this.componentDef.getStandaloneInjector!==null&&(o=this.componentDef.getStandaloneInjector(o)||o);let s=o?new na(e,o):e,a=s.get(Qn,null);if(a===null)throw new C(407,!1);let u=s.get(wv,null),c=s.get(wy,null),l={rendererFactory:a,sanitizer:u,inlineEffectRunner:null,afterRenderEventManager:c},d=a.createRenderer(null,this.componentDef),f=this.componentDef.selectors[0][0]||"div",h=r?Lv(d,r,this.componentDef.encapsulation,s):Wd(d,f,My(f)),g=4608,_=this.componentDef.onPush?576:528,b=this.componentDef.signals?g:_,v=null;h!==null&&(v=xa(h,s,!0));let z=lf(0,null,null,1,0,null,null,null,null,null,null),X=Fa(null,z,null,b,null,null,l,d,s,null,v);ga(X);let $,Se;try{let de=this.componentDef,Je,Fo=null;de.findHostDirectiveDefs?(Je=[],Fo=new Map,de.findHostDirectiveDefs(de,Je,Fo),Je.push(de)):Je=[de];let hp=_y(X,h),pp=Sy(hp,h,de,Je,X,l,d);Se=td(z,At),h&&xy(d,de,h,r),n!==void 0&&Ny(Se,this.ngContentSelectors,n),$=Ay(pp,de,Je,Fo,X,[Oy]),Ef(z,X,null)}finally{ma()}return new ra(this.componentType,$,Na(Se,X),X,Se)}},ra=class extends Us{constructor(e,n,r,i,o){super(),this.location=r,this._rootLView=i,this._tNode=o,this.previousInputValues=null,this.instance=n,this.hostView=this.changeDetectorRef=new vn(i,void 0,!1),this.componentType=e}setInput(e,n){let r=this._tNode.inputs,i;if(r!==null&&(i=r[e])){if(this.previousInputValues??=new Map,this.previousInputValues.has(e)&&Object.is(this.previousInputValues.get(e),n))return;let o=this._rootLView;Va(o[R],o,i,e,n),this.previousInputValues.set(e,n);let s=ut(this._tNode.index,o);ja(s)}}get injector(){return new _t(this._tNode,this._rootLView)}destroy(){this.hostView.destroy()}onDestroy(e){this.hostView.onDestroy(e)}};function _y(t,e){let n=t[R],r=At;return t[r]=e,ka(n,r,2,"#host",null)}function Sy(t,e,n,r,i,o,s){let a=i[R];Ty(r,t,e,s);let u=null;e!==null&&(u=xa(e,i[dn]));let c=o.rendererFactory.createRenderer(e,n),l=16;n.signals?l=4096:n.onPush&&(l=64);let d=Fa(i,cf(n),null,l,i[t.index],t,o,c,null,null,u);return a.firstCreatePass&&Qs(a,t,r.length-1),La(i,d),i[t.index]=d}function Ty(t,e,n,r){for(let i of t)e.mergedAttrs=Gn(e.mergedAttrs,i.hostAttrs);e.mergedAttrs!==null&&(ta(e,e.mergedAttrs,!0),n!==null&&Xd(r,n,e))}function Ay(t,e,n,r,i,o){let s=Me(),a=i[R],u=Ie(s,i);df(a,i,s,n,null,r);for(let l=0;l<n.length;l++){let d=s.directiveStart+l,f=pn(i,a,d,s);mn(f,i)}ff(a,i,s),u&&mn(u,i);let c=pn(i,a,s.directiveStart+s.componentOffset,s);if(t[He]=i[He]=c,o!==null)for(let l of o)l(c,e);return uf(a,s,t),c}function xy(t,e,n,r){if(r)Ts(t,n,["ng-version",Ev.full]);else{let{attrs:i,classes:o}=Ng(e.selectors[0]);i&&Ts(t,n,i),o&&o.length>0&&Jd(t,n,o.join(" "))}}function Ny(t,e,n){let r=t.projection=[];for(let i=0;i<e.length;i++){let o=n[i];r.push(o!=null?Array.from(o):null)}}function Oy(){let t=Me();Dd(J()[R],t)}function Ry(t){return Object.getPrototypeOf(t.prototype).constructor}function Vt(t){let e=Ry(t.type),n=!0,r=[t];for(;e;){let i;if(st(t))i=e.\u0275cmp||e.\u0275dir;else{if(e.\u0275cmp)throw new C(903,!1);i=e.\u0275dir}if(i){if(n){r.push(i);let s=t;s.inputs=fi(t.inputs),s.inputTransforms=fi(t.inputTransforms),s.declaredInputs=fi(t.declaredInputs),s.outputs=fi(t.outputs);let a=i.hostBindings;a&&Ly(t,a);let u=i.viewQuery,c=i.contentQueries;if(u&&Fy(t,u),c&&ky(t,c),li(t.inputs,i.inputs),li(t.declaredInputs,i.declaredInputs),li(t.outputs,i.outputs),i.inputTransforms!==null&&(s.inputTransforms===null&&(s.inputTransforms={}),li(s.inputTransforms,i.inputTransforms)),st(i)&&i.data.animation){let l=t.data;l.animation=(l.animation||[]).concat(i.data.animation)}}let o=i.features;if(o)for(let s=0;s<o.length;s++){let a=o[s];a&&a.ngInherit&&a(t),a===Vt&&(n=!1)}}e=Object.getPrototypeOf(e)}Py(r)}function Py(t){let e=0,n=null;for(let r=t.length-1;r>=0;r--){let i=t[r];i.hostVars=e+=i.hostVars,i.hostAttrs=Gn(i.hostAttrs,n=Gn(n,i.hostAttrs))}}function fi(t){return t===ln?{}:t===ge?[]:t}function Fy(t,e){let n=t.viewQuery;n?t.viewQuery=(r,i)=>{e(r,i),n(r,i)}:t.viewQuery=e}function ky(t,e){let n=t.contentQueries;n?t.contentQueries=(r,i,o)=>{e(r,i,o),n(r,i,o)}:t.contentQueries=e}function Ly(t,e){let n=t.hostBindings;n?t.hostBindings=(r,i)=>{e(r,i),n(r,i)}:t.hostBindings=e}function Vy(t,e,n){return t[e]=n}function Jn(t,e,n){let r=t[e];return Object.is(r,n)?!1:(t[e]=n,!0)}function bf(t,e,n,r){let i=Jn(t,e,n);return Jn(t,e+1,r)||i}function jy(t,e,n,r){return Jn(t,ud(),n)?e+Ci(n)+r:Qe}function $y(t,e,n,r,i,o){let s=Xg(),a=bf(t,s,n,i);return cd(2),a?e+Ci(n)+r+Ci(i)+o:Qe}function hi(t,e){return t<<17|e<<2}function Pt(t){return t>>17&32767}function Uy(t){return(t&2)==2}function By(t,e){return t&131071|e<<17}function ia(t){return t|2}function yn(t){return(t&131068)>>2}function Ds(t,e){return t&-131069|e<<2}function Hy(t){return(t&1)===1}function oa(t){return t|1}function zy(t,e,n,r,i,o){let s=o?e.classBindings:e.styleBindings,a=Pt(s),u=yn(s);t[r]=n;let c=!1,l;if(Array.isArray(n)){let d=n;l=d[1],(l===null||rr(d,l)>0)&&(c=!0)}else l=n;if(i)if(u!==0){let f=Pt(t[a+1]);t[r+1]=hi(f,a),f!==0&&(t[f+1]=Ds(t[f+1],r)),t[a+1]=By(t[a+1],r)}else t[r+1]=hi(a,0),a!==0&&(t[a+1]=Ds(t[a+1],r)),a=r;else t[r+1]=hi(u,0),a===0?a=r:t[u+1]=Ds(t[u+1],r),u=r;c&&(t[r+1]=ia(t[r+1])),El(t,l,r,!0,o),El(t,l,r,!1,o),Gy(e,l,t,r,o),s=hi(a,u),o?e.classBindings=s:e.styleBindings=s}function Gy(t,e,n,r,i){let o=i?t.residualClasses:t.residualStyles;o!=null&&typeof e=="string"&&rr(o,e)>=0&&(n[r+1]=oa(n[r+1]))}function El(t,e,n,r,i){let o=t[n+1],s=e===null,a=r?Pt(o):yn(o),u=!1;for(;a!==0&&(u===!1||s);){let c=t[a],l=t[a+1];Wy(c,e)&&(u=!0,t[a+1]=r?oa(l):ia(l)),a=r?Pt(l):yn(l)}u&&(t[n+1]=r?ia(o):oa(o))}function Wy(t,e){return t===null||e==null||(Array.isArray(t)?t[1]:t)===e?!0:Array.isArray(t)&&typeof e=="string"?rr(t,e)>=0:!1}function bn(t,e,n){let r=J(),i=ud();if(Jn(r,i,e)){let o=qe(),s=sm();Hv(o,s,r,t,e,r[ne],n,!1)}return bn}function bl(t,e,n,r,i){let o=e.inputs,s=i?"class":"style";Va(t,n,o[s],s,r)}function Ba(t,e){return qy(t,e,null,!0),Ba}function qy(t,e,n,r){let i=J(),o=qe(),s=cd(2);if(o.firstUpdatePass&&Yy(o,t,s,r),e!==Qe&&Jn(i,s,e)){let a=o.data[Ft()];eD(o,a,i,i[ne],t,i[s+1]=tD(e,n),r,s)}}function Zy(t,e){return e>=t.expandoStartIndex}function Yy(t,e,n,r){let i=t.data;if(i[n+1]===null){let o=i[Ft()],s=Zy(t,n);nD(o,r)&&e===null&&!s&&(e=!1),e=Qy(i,o,e,r),zy(i,o,e,n,s,r)}}function Qy(t,e,n,r){let i=im(t),o=r?e.residualClasses:e.residualStyles;if(i===null)(r?e.classBindings:e.styleBindings)===0&&(n=Cs(null,t,e,n,r),n=Xn(n,e.attrs,r),o=null);else{let s=e.directiveStylingLast;if(s===-1||t[s]!==i)if(n=Cs(i,t,e,n,r),o===null){let u=Ky(t,e,r);u!==void 0&&Array.isArray(u)&&(u=Cs(null,t,e,u[1],r),u=Xn(u,e.attrs,r),Jy(t,e,r,u))}else o=Xy(t,e,r)}return o!==void 0&&(r?e.residualClasses=o:e.residualStyles=o),n}function Ky(t,e,n){let r=n?e.classBindings:e.styleBindings;if(yn(r)!==0)return t[Pt(r)]}function Jy(t,e,n,r){let i=n?e.classBindings:e.styleBindings;t[Pt(i)]=r}function Xy(t,e,n){let r,i=e.directiveEnd;for(let o=1+e.directiveStylingLast;o<i;o++){let s=t[o].hostAttrs;r=Xn(r,s,n)}return Xn(r,e.attrs,n)}function Cs(t,e,n,r,i){let o=null,s=n.directiveEnd,a=n.directiveStylingLast;for(a===-1?a=n.directiveStart:a++;a<s&&(o=e[a],r=Xn(r,o.hostAttrs,i),o!==t);)a++;return t!==null&&(n.directiveStylingLast=a),r}function Xn(t,e,n){let r=n?1:2,i=-1;if(e!==null)for(let o=0;o<e.length;o++){let s=e[o];typeof s=="number"?i=s:i===r&&(Array.isArray(t)||(t=t===void 0?[]:["",t]),_m(t,s,n?!0:e[++o]))}return t===void 0?null:t}function eD(t,e,n,r,i,o,s,a){if(!(e.type&3))return;let u=t.data,c=u[a+1],l=Hy(c)?Il(u,e,n,i,yn(c),s):void 0;if(!Fi(l)){Fi(o)||Uy(c)&&(o=Il(u,null,n,i,a,s));let d=ed(Ft(),n);fv(r,s,d,i,o)}}function Il(t,e,n,r,i,o){let s=e===null,a;for(;i>0;){let u=t[i],c=Array.isArray(u),l=c?u[1]:u,d=l===null,f=n[i+1];f===Qe&&(f=d?ge:void 0);let h=d?hs(f,r):l===r?f:void 0;if(c&&!Fi(h)&&(h=hs(u,r)),Fi(h)&&(a=h,s))return a;let g=t[i+1];i=s?Pt(g):yn(g)}if(e!==null){let u=o?e.residualClasses:e.residualStyles;u!=null&&(a=hs(u,r))}return a}function Fi(t){return t!==void 0}function tD(t,e){return t==null||t===""||(typeof e=="string"?t=t+e:typeof t=="object"&&(t=se(Aa(t)))),t}function nD(t,e){return(t.flags&(e?8:16))!==0}var NA=new RegExp(`^(\\d+)*(${gv}|${pv})*(.*)`);var rD=(t,e)=>null;function Ml(t,e){return rD(t,e)}function _l(t,e){return!e||e.firstChild===null||Ud(t)}function iD(t,e,n,r=!0){let i=e[R];if(Jm(i,e,t,n),r){let s=js(n,t),a=e[ne],u=Sa(a,t[xt]);u!==null&&Ym(i,t[be],a,e,u,s)}let o=e[Ei];o!==null&&o.firstChild!==null&&(o.firstChild=null)}var Yi=(()=>{let e=class e{};e.__NG_ELEMENT_ID__=oD;let t=e;return t})();function oD(){let t=Me();return aD(t,J())}var sD=Yi,If=class extends sD{constructor(e,n,r){super(),this._lContainer=e,this._hostTNode=n,this._hostLView=r}get element(){return Na(this._hostTNode,this._hostLView)}get injector(){return new _t(this._hostTNode,this._hostLView)}get parentInjector(){let e=va(this._hostTNode,this._hostLView);if(wd(e)){let n=_i(e,this._hostLView),r=Mi(e),i=n[R].data[r+8];return new _t(i,n)}else return new _t(null,this._hostLView)}clear(){for(;this.length>0;)this.remove(this.length-1)}get(e){let n=Sl(this._lContainer);return n!==null&&n[e]||null}get length(){return this._lContainer.length-me}createEmbeddedView(e,n,r){let i,o;typeof r=="number"?i=r:r!=null&&(i=r.index,o=r.injector);let s=Ml(this._lContainer,e.ssrId),a=e.createEmbeddedViewImpl(n||{},o,s);return this.insertImpl(a,i,_l(this._hostTNode,s)),a}createComponent(e,n,r,i,o){let s=e&&!bm(e),a;if(s)a=n;else{let g=n||{};a=g.index,r=g.injector,i=g.projectableNodes,o=g.environmentInjector||g.ngModuleRef}let u=s?e:new Kn(St(e)),c=r||this.parentInjector;if(!o&&u.ngModule==null){let _=(s?c:this.parentInjector).get(le,null);_&&(o=_)}let l=St(u.componentType??{}),d=Ml(this._lContainer,l?.id??null),f=d?.firstChild??null,h=u.create(c,i,f,o);return this.insertImpl(h.hostView,a,_l(this._hostTNode,d)),h}insert(e,n){return this.insertImpl(e,n,!0)}insertImpl(e,n,r){let i=e._lView;if(Ug(i)){let a=this.indexOf(e);if(a!==-1)this.detach(a);else{let u=i[K],c=new If(u,u[be],u[K]);c.detach(c.indexOf(e))}}let o=this._adjustIndex(n),s=this._lContainer;return iD(s,i,o,r),e.attachToViewContainerRef(),Nd(ws(s),o,e),e}move(e,n){return this.insert(e,n)}indexOf(e){let n=Sl(this._lContainer);return n!==null?n.indexOf(e):-1}remove(e){let n=this._adjustIndex(e,-1),r=Vs(this._lContainer,n);r&&(Ti(ws(this._lContainer),n),Zd(r[R],r))}detach(e){let n=this._adjustIndex(e,-1),r=Vs(this._lContainer,n);return r&&Ti(ws(this._lContainer),n)!=null?new vn(r):null}_adjustIndex(e,n=0){return e??this.length+n}};function Sl(t){return t[bi]}function ws(t){return t[bi]||(t[bi]=[])}function aD(t,e){let n,r=e[t.index];return we(r)?n=r:(n=iy(r,e,null,t),e[t.index]=n,La(e,n)),cD(n,e,t,r),new If(n,t,e)}function uD(t,e){let n=t[ne],r=n.createComment(""),i=Ie(e,t),o=Sa(n,i);return xi(n,o,r,ov(n,i),!1),r}var cD=lD;function lD(t,e,n,r){if(t[xt])return;let i;n.type&8?i=Fe(r):i=uD(e,n),t[xt]=i}function dD(t,e,n,r,i,o){let s=e.consts,a=rl(s,i),u=ka(e,t,2,r,a);return Gv(e,n,u,rl(s,o)),u.attrs!==null&&ta(u,u.attrs,!1),u.mergedAttrs!==null&&ta(u,u.mergedAttrs,!0),e.queries!==null&&e.queries.elementStart(e,u),u}function dt(t,e,n,r){let i=J(),o=qe(),s=At+t,a=i[ne],u=o.firstCreatePass?dD(s,o,i,e,n,r):o.data[s],c=fD(o,i,u,a,e,t);i[s]=c;let l=Ql(u);return Gi(u,!0),Xd(a,c,u),(u.flags&32)!==32&&vd()&&Qd(o,i,c,u),zg()===0&&mn(c,i),Gg(),l&&(Pv(o,i,u),uf(o,u,i)),r!==null&&Fv(i,u),dt}function ft(){let t=Me();ad()?Kg():(t=t.parent,Gi(t,!1));let e=t;Zg(e)&&Yg(),Wg();let n=qe();return n.firstCreatePass&&(Dd(n,t),Yl(t)&&n.queries.elementEnd(t)),e.classesWithoutHost!=null&&dm(e)&&bl(n,e,J(),e.classesWithoutHost,!0),e.stylesWithoutHost!=null&&fm(e)&&bl(n,e,J(),e.stylesWithoutHost,!1),ft}function Ha(t,e,n,r){return dt(t,e,n,r),ft(),Ha}var fD=(t,e,n,r,i,o)=>(yd(!0),Wd(r,i,am()));var ki="en-US";var hD=ki;function pD(t){ag(t,"Expected localeId to be defined"),typeof t=="string"&&(hD=t.toLowerCase().replace(/_/g,"-"))}function jt(t){return!!t&&typeof t.then=="function"}function Mf(t){return!!t&&typeof t.subscribe=="function"}function ht(t,e,n,r){let i=J(),o=qe(),s=Me();return mD(o,i,i[ne],s,t,e,r),ht}function gD(t,e,n,r){let i=t.cleanup;if(i!=null)for(let o=0;o<i.length-1;o+=2){let s=i[o];if(s===n&&i[o+1]===r){let a=e[Wn],u=i[o+2];return a.length>u?a[u]:null}typeof s=="string"&&(o+=2)}return null}function mD(t,e,n,r,i,o,s){let a=Ql(r),c=t.firstCreatePass&&sy(t),l=e[He],d=oy(e),f=!0;if(r.type&3||s){let _=Ie(r,e),b=s?s(_):_,v=d.length,z=s?$=>s(Fe($[r.index])):r.index,X=null;if(!s&&a&&(X=gD(t,e,i,r.index)),X!==null){let $=X.__ngLastListenerFn__||X;$.__ngNextListenerFn__=o,X.__ngLastListenerFn__=o,f=!1}else{o=Al(r,e,l,o,!1);let $=n.listen(b,i,o);d.push(o,$),c&&c.push(i,z,v,v+1)}}else o=Al(r,e,l,o,!1);let h=r.outputs,g;if(f&&h!==null&&(g=h[i])){let _=g.length;if(_)for(let b=0;b<_;b+=2){let v=g[b],z=g[b+1],Se=e[v][z].subscribe(o),de=d.length;d.push(o,Se),c&&c.push(i,r.index,de,-(de+1))}}}function Tl(t,e,n,r){try{return Ne(6,e,n),n(r)!==!1}catch(i){return gf(t,i),!1}finally{Ne(7,e,n)}}function Al(t,e,n,r,i){return function o(s){if(s===Function)return r;let a=t.componentOffset>-1?ut(t.index,e):e;ja(a);let u=Tl(e,n,r,s),c=o.__ngNextListenerFn__;for(;c;)u=Tl(e,n,c,s)&&u,c=c.__ngNextListenerFn__;return i&&u===!1&&s.preventDefault(),u}}function sr(t,e=""){let n=J(),r=qe(),i=t+At,o=r.firstCreatePass?ka(r,i,1,e,null):r.data[i],s=vD(r,n,o,e,t);n[i]=s,vd()&&Qd(r,n,s,o),Gi(o,!1)}var vD=(t,e,n,r,i)=>(yd(!0),Wm(e[ne],r));function za(t){return Qi("",t,""),za}function Qi(t,e,n){let r=J(),i=jy(r,t,e,n);return i!==Qe&&mf(r,Ft(),i),Qi}function Ga(t,e,n,r,i){let o=J(),s=$y(o,t,e,n,r,i);return s!==Qe&&mf(o,Ft(),s),Ga}function yD(t,e,n){let r=qe();if(r.firstCreatePass){let i=st(t);sa(n,r.data,r.blueprint,i,!0),sa(e,r.data,r.blueprint,i,!1)}}function sa(t,e,n,r,i){if(t=ie(t),Array.isArray(t))for(let o=0;o<t.length;o++)sa(t[o],e,n,r,i);else{let o=qe(),s=J(),a=Me(),u=gn(t)?t:ie(t.provide),c=Ld(t),l=a.providerIndexes&1048575,d=a.directiveStart,f=a.providerIndexes>>20;if(gn(t)||!t.multi){let h=new Ot(c,i,U),g=bs(u,e,i?l:l+f,d);g===-1?(Os(Si(a,s),o,u),Es(o,t,e.length),e.push(u),a.directiveStart++,a.directiveEnd++,i&&(a.providerIndexes+=1048576),n.push(h),s.push(h)):(n[g]=h,s[g]=h)}else{let h=bs(u,e,l+f,d),g=bs(u,e,l,l+f),_=h>=0&&n[h],b=g>=0&&n[g];if(i&&!b||!i&&!_){Os(Si(a,s),o,u);let v=wD(i?CD:DD,n.length,i,r,c);!i&&b&&(n[g].providerFactory=v),Es(o,t,e.length,0),e.push(u),a.directiveStart++,a.directiveEnd++,i&&(a.providerIndexes+=1048576),n.push(v),s.push(v)}else{let v=_f(n[i?g:h],c,!i&&r);Es(o,t,h>-1?h:g,v)}!i&&r&&b&&n[g].componentProviders++}}}function Es(t,e,n,r){let i=gn(e),o=Om(e);if(i||o){let u=(o?ie(e.useClass):e).prototype.ngOnDestroy;if(u){let c=t.destroyHooks||(t.destroyHooks=[]);if(!i&&e.multi){let l=c.indexOf(n);l===-1?c.push(n,[r,u]):c[l+1].push(r,u)}else c.push(n,u)}}}function _f(t,e,n){return n&&t.componentProviders++,t.multi.push(e)-1}function bs(t,e,n,r){for(let i=n;i<r;i++)if(e[i]===t)return i;return-1}function DD(t,e,n,r){return aa(this.multi,[])}function CD(t,e,n,r){let i=this.multi,o;if(this.providerFactory){let s=this.providerFactory.componentProviders,a=pn(n,n[R],this.providerFactory.index,r);o=a.slice(0,s),aa(i,o);for(let u=s;u<a.length;u++)o.push(a[u])}else o=[],aa(i,o);return o}function aa(t,e){for(let n=0;n<t.length;n++){let r=t[n];e.push(r())}return e}function wD(t,e,n,r,i){let o=new Ot(t,n,U);return o.multi=[],o.index=e,o.componentProviders=0,_f(o,i,r&&!n),o}function Ki(t,e=[]){return n=>{n.providersResolver=(r,i)=>yD(r,i?i(t):t,e)}}var at=class{},er=class{};var ua=class extends at{constructor(e,n,r){super(),this._parent=n,this._bootstrapComponents=[],this.destroyCbs=[],this.componentFactoryResolver=new Pi(this);let i=zl(e);this._bootstrapComponents=$d(i.bootstrap),this._r3Injector=Vd(e,n,[{provide:at,useValue:this},{provide:Zi,useValue:this.componentFactoryResolver},...r],se(e),new Set(["environment"])),this._r3Injector.resolveInjectorInitializers(),this.instance=this._r3Injector.get(e)}get injector(){return this._r3Injector}destroy(){let e=this._r3Injector;!e.destroyed&&e.destroy(),this.destroyCbs.forEach(n=>n()),this.destroyCbs=null}onDestroy(e){this.destroyCbs.push(e)}},ca=class extends er{constructor(e){super(),this.moduleType=e}create(e){return new ua(this.moduleType,e,[])}};var Li=class extends at{constructor(e){super(),this.componentFactoryResolver=new Pi(this),this.instance=null;let n=new Yn([...e.providers,{provide:at,useValue:this},{provide:Zi,useValue:this.componentFactoryResolver}],e.parent||wa(),e.debugName,new Set(["environment"]));this.injector=n,e.runEnvironmentInitializers&&n.resolveInjectorInitializers()}destroy(){this.injector.destroy()}onDestroy(e){this.injector.onDestroy(e)}};function Wa(t,e,n=null){return new Li({providers:t,parent:e,debugName:n,runEnvironmentInitializers:!0}).injector}var ED=(()=>{let e=class e{constructor(r){this._injector=r,this.cachedInjectors=new Map}getOrCreateStandaloneInjector(r){if(!r.standalone)return null;if(!this.cachedInjectors.has(r)){let i=Pd(!1,r.type),o=i.length>0?Wa([i],this._injector,`Standalone[${r.type.name}]`):null;this.cachedInjectors.set(r,o)}return this.cachedInjectors.get(r)}ngOnDestroy(){try{for(let r of this.cachedInjectors.values())r!==null&&r.destroy()}finally{this.cachedInjectors.clear()}}};e.\u0275prov=w({token:e,providedIn:"environment",factory:()=>new e(I(le))});let t=e;return t})();function Ji(t){$a("NgStandalone"),t.getStandaloneInjector=e=>e.get(ED).getOrCreateStandaloneInjector(t)}function Sf(t,e,n,r,i){return ID(J(),Jg(),t,e,n,r,i)}function bD(t,e){let n=t[e];return n===Qe?void 0:n}function ID(t,e,n,r,i,o,s){let a=e+n;return bf(t,a,i,o)?Vy(t,a+2,s?r.call(s,i,o):r(i,o)):bD(t,a+2)}var Xi=(()=>{let e=class e{log(r){console.log(r)}warn(r){console.warn(r)}};e.\u0275fac=function(i){return new(i||e)},e.\u0275prov=w({token:e,factory:e.\u0275fac,providedIn:"platform"});let t=e;return t})(),ar=(()=>{let e=class e{constructor(){this.taskId=0,this.pendingTasks=new Set,this.hasPendingTasks=new ee(!1)}add(){this.hasPendingTasks.next(!0);let r=this.taskId++;return this.pendingTasks.add(r),r}remove(r){this.pendingTasks.delete(r),this.pendingTasks.size===0&&this.hasPendingTasks.next(!1)}ngOnDestroy(){this.pendingTasks.clear(),this.hasPendingTasks.next(!1)}};e.\u0275fac=function(i){return new(i||e)},e.\u0275prov=w({token:e,factory:e.\u0275fac,providedIn:"root"});let t=e;return t})(),la=class{constructor(e,n){this.ngModuleFactory=e,this.componentFactories=n}},qa=(()=>{let e=class e{compileModuleSync(r){return new ca(r)}compileModuleAsync(r){return Promise.resolve(this.compileModuleSync(r))}compileModuleAndAllComponentsSync(r){let i=this.compileModuleSync(r),o=zl(r),s=$d(o.declarations).reduce((a,u)=>{let c=St(u);return c&&a.push(new Kn(c)),a},[]);return new la(i,s)}compileModuleAndAllComponentsAsync(r){return Promise.resolve(this.compileModuleAndAllComponentsSync(r))}clearCache(){}clearCacheFor(r){}getModuleId(r){}};e.\u0275fac=function(i){return new(i||e)},e.\u0275prov=w({token:e,factory:e.\u0275fac,providedIn:"root"});let t=e;return t})();var Tf=new E("");var eo=new E("Application Initializer"),Af=(()=>{let e=class e{constructor(){this.initialized=!1,this.done=!1,this.donePromise=new Promise((r,i)=>{this.resolve=r,this.reject=i}),this.appInits=p(eo,{optional:!0})??[]}runInitializers(){if(this.initialized)return;let r=[];for(let o of this.appInits){let s=o();if(jt(s))r.push(s);else if(Mf(s)){let a=new Promise((u,c)=>{s.subscribe({complete:u,error:c})});r.push(a)}}let i=()=>{this.done=!0,this.resolve()};Promise.all(r).then(()=>{i()}).catch(o=>{this.reject(o)}),r.length===0&&i(),this.initialized=!0}};e.\u0275fac=function(i){return new(i||e)},e.\u0275prov=w({token:e,factory:e.\u0275fac,providedIn:"root"});let t=e;return t})(),to=new E("appBootstrapListener");function MD(){pc(()=>{throw new C(600,!1)})}function _D(t){return t.isBoundToModule}function SD(t,e,n){try{let r=n();return jt(r)?r.catch(i=>{throw e.runOutsideAngular(()=>t.handleError(i)),i}):r}catch(r){throw e.runOutsideAngular(()=>t.handleError(r)),r}}var pt=(()=>{let e=class e{constructor(){this._bootstrapListeners=[],this._runningTick=!1,this._destroyed=!1,this._destroyListeners=[],this._views=[],this.internalErrorHandler=p(nf),this.zoneIsStable=p(Cf),this.componentTypes=[],this.components=[],this.isStable=p(ar).hasPendingTasks.pipe(Z(r=>r?D(!1):this.zoneIsStable),ns()),this._injector=p(le)}get destroyed(){return this._destroyed}get injector(){return this._injector}bootstrap(r,i){let o=r instanceof Ni;if(!this._injector.get(Af).done){let g="Cannot bootstrap as there are still asynchronous initializers running."+(!o&&Hl(r)?"":" Bootstrap components in the `ngDoBootstrap` method of the root module.");throw new C(405,!1)}let a;o?a=r:a=this._injector.get(Zi).resolveComponentFactory(r),this.componentTypes.push(a.componentType);let u=_D(a)?void 0:this._injector.get(at),c=i||a.selector,l=a.create(Ye.NULL,[],c,u),d=l.location.nativeElement,f=l.injector.get(Tf,null);return f?.registerApplication(d),l.onDestroy(()=>{this.detachView(l.hostView),Is(this.components,l),f?.unregisterApplication(d)}),this._loadComponent(l),l}tick(){if(this._runningTick)throw new C(101,!1);try{this._runningTick=!0;for(let r of this._views)r.detectChanges()}catch(r){this.internalErrorHandler(r)}finally{this._runningTick=!1}}attachView(r){let i=r;this._views.push(i),i.attachToAppRef(this)}detachView(r){let i=r;Is(this._views,i),i.detachFromAppRef()}_loadComponent(r){this.attachView(r.hostView),this.tick(),this.components.push(r);let i=this._injector.get(to,[]);[...this._bootstrapListeners,...i].forEach(o=>o(r))}ngOnDestroy(){if(!this._destroyed)try{this._destroyListeners.forEach(r=>r()),this._views.slice().forEach(r=>r.destroy())}finally{this._destroyed=!0,this._views=[],this._bootstrapListeners=[],this._destroyListeners=[]}}onDestroy(r){return this._destroyListeners.push(r),()=>Is(this._destroyListeners,r)}destroy(){if(this._destroyed)throw new C(406,!1);let r=this._injector;r.destroy&&!r.destroyed&&r.destroy()}get viewCount(){return this._views.length}warnIfDestroyed(){}};e.\u0275fac=function(i){return new(i||e)},e.\u0275prov=w({token:e,factory:e.\u0275fac,providedIn:"root"});let t=e;return t})();function Is(t,e){let n=t.indexOf(e);n>-1&&t.splice(n,1)}var TD=(()=>{let e=class e{constructor(){this.zone=p(H),this.applicationRef=p(pt)}initialize(){this._onMicrotaskEmptySubscription||(this._onMicrotaskEmptySubscription=this.zone.onMicrotaskEmpty.subscribe({next:()=>{this.zone.run(()=>{this.applicationRef.tick()})}}))}ngOnDestroy(){this._onMicrotaskEmptySubscription?.unsubscribe()}};e.\u0275fac=function(i){return new(i||e)},e.\u0275prov=w({token:e,factory:e.\u0275fac,providedIn:"root"});let t=e;return t})();function AD(t){return[{provide:H,useFactory:t},{provide:ir,multi:!0,useFactory:()=>{let e=p(TD,{optional:!0});return()=>e.initialize()}},{provide:nf,useFactory:xD},{provide:Cf,useFactory:wf}]}function xD(){let t=p(H),e=p(Ge);return n=>t.runOutsideAngular(()=>e.handleError(n))}function ND(t){let e=AD(()=>new H(OD(t)));return ct([[],e])}function OD(t){return{enableLongStackTrace:!1,shouldCoalesceEventChangeDetection:t?.eventCoalescing??!1,shouldCoalesceRunChangeDetection:t?.runCoalescing??!1}}function RD(){return typeof $localize<"u"&&$localize.locale||ki}var Za=new E("LocaleId",{providedIn:"root",factory:()=>p(Za,O.Optional|O.SkipSelf)||RD()});var xf=new E("PlatformDestroyListeners");var yi=null;function PD(t=[],e){return Ye.create({name:e,providers:[{provide:qi,useValue:"platform"},{provide:xf,useValue:new Set([()=>yi=null])},...t]})}function FD(t=[]){if(yi)return yi;let e=PD(t);return yi=e,MD(),kD(e),e}function kD(t){t.get(ba,null)?.forEach(n=>n())}function Nf(){return!1}function Of(t){try{let{rootComponent:e,appProviders:n,platformProviders:r}=t,i=FD(r),o=[ND(),...n||[]],a=new Li({providers:o,parent:i,debugName:"",runEnvironmentInitializers:!1}).injector,u=a.get(H);return u.run(()=>{a.resolveInjectorInitializers();let c=a.get(Ge,null),l;u.runOutsideAngular(()=>{l=u.onError.subscribe({next:h=>{c.handleError(h)}})});let d=()=>a.destroy(),f=i.get(xf);return f.add(d),a.onDestroy(()=>{l.unsubscribe(),f.delete(d)}),SD(c,u,()=>{let h=a.get(Af);return h.runInitializers(),h.donePromise.then(()=>{let g=a.get(Za,ki);pD(g||ki);let _=a.get(pt);return e!==void 0&&_.bootstrap(e),_})})})}catch(e){return Promise.reject(e)}}function no(t){return typeof t=="boolean"?t:t!=null&&t!=="false"}var Qa=null;function Ke(){return Qa}function kf(t){Qa||(Qa=t)}var ro=class{},ae=new E("DocumentToken"),Lf=(()=>{let e=class e{historyGo(r){throw new Error("Not implemented")}};e.\u0275fac=function(i){return new(i||e)},e.\u0275prov=w({token:e,factory:()=>(()=>p(jD))(),providedIn:"platform"});let t=e;return t})();var jD=(()=>{let e=class e extends Lf{constructor(){super(),this._doc=p(ae),this._location=window.location,this._history=window.history}getBaseHrefFromDOM(){return Ke().getBaseHref(this._doc)}onPopState(r){let i=Ke().getGlobalEventTarget(this._doc,"window");return i.addEventListener("popstate",r,!1),()=>i.removeEventListener("popstate",r)}onHashChange(r){let i=Ke().getGlobalEventTarget(this._doc,"window");return i.addEventListener("hashchange",r,!1),()=>i.removeEventListener("hashchange",r)}get href(){return this._location.href}get protocol(){return this._location.protocol}get hostname(){return this._location.hostname}get port(){return this._location.port}get pathname(){return this._location.pathname}get search(){return this._location.search}get hash(){return this._location.hash}set pathname(r){this._location.pathname=r}pushState(r,i,o){this._history.pushState(r,i,o)}replaceState(r,i,o){this._history.replaceState(r,i,o)}forward(){this._history.forward()}back(){this._history.back()}historyGo(r=0){this._history.go(r)}getState(){return this._history.state}};e.\u0275fac=function(i){return new(i||e)},e.\u0275prov=w({token:e,factory:()=>(()=>new e)(),providedIn:"platform"});let t=e;return t})();function Vf(t,e){if(t.length==0)return e;if(e.length==0)return t;let n=0;return t.endsWith("/")&&n++,e.startsWith("/")&&n++,n==2?t+e.substring(1):n==1?t+e:t+"/"+e}function Rf(t){let e=t.match(/#|\?|$/),n=e&&e.index||t.length,r=n-(t[n-1]==="/"?1:0);return t.slice(0,r)+t.slice(n)}function Ut(t){return t&&t[0]!=="?"?"?"+t:t}var io=(()=>{let e=class e{historyGo(r){throw new Error("Not implemented")}};e.\u0275fac=function(i){return new(i||e)},e.\u0275prov=w({token:e,factory:()=>(()=>p(jf))(),providedIn:"root"});let t=e;return t})(),$D=new E("appBaseHref"),jf=(()=>{let e=class e extends io{constructor(r,i){super(),this._platformLocation=r,this._removeListenerFns=[],this._baseHref=i??this._platformLocation.getBaseHrefFromDOM()??p(ae).location?.origin??""}ngOnDestroy(){for(;this._removeListenerFns.length;)this._removeListenerFns.pop()()}onPopState(r){this._removeListenerFns.push(this._platformLocation.onPopState(r),this._platformLocation.onHashChange(r))}getBaseHref(){return this._baseHref}prepareExternalUrl(r){return Vf(this._baseHref,r)}path(r=!1){let i=this._platformLocation.pathname+Ut(this._platformLocation.search),o=this._platformLocation.hash;return o&&r?`${i}${o}`:i}pushState(r,i,o,s){let a=this.prepareExternalUrl(o+Ut(s));this._platformLocation.pushState(r,i,a)}replaceState(r,i,o,s){let a=this.prepareExternalUrl(o+Ut(s));this._platformLocation.replaceState(r,i,a)}forward(){this._platformLocation.forward()}back(){this._platformLocation.back()}getState(){return this._platformLocation.getState()}historyGo(r=0){this._platformLocation.historyGo?.(r)}};e.\u0275fac=function(i){return new(i||e)(I(Lf),I($D,8))},e.\u0275prov=w({token:e,factory:e.\u0275fac,providedIn:"root"});let t=e;return t})();var ur=(()=>{let e=class e{constructor(r){this._subject=new oe,this._urlChangeListeners=[],this._urlChangeSubscription=null,this._locationStrategy=r;let i=this._locationStrategy.getBaseHref();this._basePath=HD(Rf(Pf(i))),this._locationStrategy.onPopState(o=>{this._subject.emit({url:this.path(!0),pop:!0,state:o.state,type:o.type})})}ngOnDestroy(){this._urlChangeSubscription?.unsubscribe(),this._urlChangeListeners=[]}path(r=!1){return this.normalize(this._locationStrategy.path(r))}getState(){return this._locationStrategy.getState()}isCurrentPathEqualTo(r,i=""){return this.path()==this.normalize(r+Ut(i))}normalize(r){return e.stripTrailingSlash(BD(this._basePath,Pf(r)))}prepareExternalUrl(r){return r&&r[0]!=="/"&&(r="/"+r),this._locationStrategy.prepareExternalUrl(r)}go(r,i="",o=null){this._locationStrategy.pushState(o,"",r,i),this._notifyUrlChangeListeners(this.prepareExternalUrl(r+Ut(i)),o)}replaceState(r,i="",o=null){this._locationStrategy.replaceState(o,"",r,i),this._notifyUrlChangeListeners(this.prepareExternalUrl(r+Ut(i)),o)}forward(){this._locationStrategy.forward()}back(){this._locationStrategy.back()}historyGo(r=0){this._locationStrategy.historyGo?.(r)}onUrlChange(r){return this._urlChangeListeners.push(r),this._urlChangeSubscription||(this._urlChangeSubscription=this.subscribe(i=>{this._notifyUrlChangeListeners(i.url,i.state)})),()=>{let i=this._urlChangeListeners.indexOf(r);this._urlChangeListeners.splice(i,1),this._urlChangeListeners.length===0&&(this._urlChangeSubscription?.unsubscribe(),this._urlChangeSubscription=null)}}_notifyUrlChangeListeners(r="",i){this._urlChangeListeners.forEach(o=>o(r,i))}subscribe(r,i,o){return this._subject.subscribe({next:r,error:i,complete:o})}};e.normalizeQueryParams=Ut,e.joinWithSlash=Vf,e.stripTrailingSlash=Rf,e.\u0275fac=function(i){return new(i||e)(I(io))},e.\u0275prov=w({token:e,factory:()=>UD(),providedIn:"root"});let t=e;return t})();function UD(){return new ur(I(io))}function BD(t,e){if(!t||!e.startsWith(t))return e;let n=e.substring(t.length);return n===""||["/",";","?","#"].includes(n[0])?n:e}function Pf(t){return t.replace(/\/index.html$/,"")}function HD(t){if(new RegExp("^(https?:)?//").test(t)){let[,n]=t.split(/\/\/[^\/]+/);return n}return t}function oo(t,e){e=encodeURIComponent(e);for(let n of t.split(";")){let r=n.indexOf("="),[i,o]=r==-1?[n,""]:[n.slice(0,r),n.slice(r+1)];if(i.trim()===e)return decodeURIComponent(o)}return null}var Ya=/\s+/,Ff=[],$f=(()=>{let e=class e{constructor(r,i,o,s){this._iterableDiffers=r,this._keyValueDiffers=i,this._ngEl=o,this._renderer=s,this.initialClasses=Ff,this.stateMap=new Map}set klass(r){this.initialClasses=r!=null?r.trim().split(Ya):Ff}set ngClass(r){this.rawClass=typeof r=="string"?r.trim().split(Ya):r}ngDoCheck(){for(let i of this.initialClasses)this._updateState(i,!0);let r=this.rawClass;if(Array.isArray(r)||r instanceof Set)for(let i of r)this._updateState(i,!0);else if(r!=null)for(let i of Object.keys(r))this._updateState(i,!!r[i]);this._applyStateDiff()}_updateState(r,i){let o=this.stateMap.get(r);o!==void 0?(o.enabled!==i&&(o.changed=!0,o.enabled=i),o.touched=!0):this.stateMap.set(r,{enabled:i,changed:!0,touched:!0})}_applyStateDiff(){for(let r of this.stateMap){let i=r[0],o=r[1];o.changed?(this._toggleClass(i,o.enabled),o.changed=!1):o.touched||(o.enabled&&this._toggleClass(i,!1),this.stateMap.delete(i)),o.touched=!1}}_toggleClass(r,i){r=r.trim(),r.length>0&&r.split(Ya).forEach(o=>{i?this._renderer.addClass(this._ngEl.nativeElement,o):this._renderer.removeClass(this._ngEl.nativeElement,o)})}};e.\u0275fac=function(i){return new(i||e)(U(Ra),U(Pa),U(lt),U(kt))},e.\u0275dir=Ee({type:e,selectors:[["","ngClass",""]],inputs:{klass:["class","klass"],ngClass:"ngClass"},standalone:!0});let t=e;return t})();var Ka=(()=>{let e=class e{};e.\u0275fac=function(i){return new(i||e)},e.\u0275mod=Le({type:e}),e.\u0275inj=ke({});let t=e;return t})(),Ja="browser",zD="server";function Xa(t){return t===Ja}function eu(t){return t===zD}var In=class{};var lr=class{},ao=class{},Bt=class t{constructor(e){this.normalizedNames=new Map,this.lazyUpdate=null,e?typeof e=="string"?this.lazyInit=()=>{this.headers=new Map,e.split(`
-`).forEach(n=>{let r=n.indexOf(":");if(r>0){let i=n.slice(0,r),o=i.toLowerCase(),s=n.slice(r+1).trim();this.maybeSetNormalizedName(i,o),this.headers.has(o)?this.headers.get(o).push(s):this.headers.set(o,[s])}})}:typeof Headers<"u"&&e instanceof Headers?(this.headers=new Map,e.forEach((n,r)=>{this.setHeaderEntries(r,n)})):this.lazyInit=()=>{this.headers=new Map,Object.entries(e).forEach(([n,r])=>{this.setHeaderEntries(n,r)})}:this.headers=new Map}has(e){return this.init(),this.headers.has(e.toLowerCase())}get(e){this.init();let n=this.headers.get(e.toLowerCase());return n&&n.length>0?n[0]:null}keys(){return this.init(),Array.from(this.normalizedNames.values())}getAll(e){return this.init(),this.headers.get(e.toLowerCase())||null}append(e,n){return this.clone({name:e,value:n,op:"a"})}set(e,n){return this.clone({name:e,value:n,op:"s"})}delete(e,n){return this.clone({name:e,value:n,op:"d"})}maybeSetNormalizedName(e,n){this.normalizedNames.has(n)||this.normalizedNames.set(n,e)}init(){this.lazyInit&&(this.lazyInit instanceof t?this.copyFrom(this.lazyInit):this.lazyInit(),this.lazyInit=null,this.lazyUpdate&&(this.lazyUpdate.forEach(e=>this.applyUpdate(e)),this.lazyUpdate=null))}copyFrom(e){e.init(),Array.from(e.headers.keys()).forEach(n=>{this.headers.set(n,e.headers.get(n)),this.normalizedNames.set(n,e.normalizedNames.get(n))})}clone(e){let n=new t;return n.lazyInit=this.lazyInit&&this.lazyInit instanceof t?this.lazyInit:this,n.lazyUpdate=(this.lazyUpdate||[]).concat([e]),n}applyUpdate(e){let n=e.name.toLowerCase();switch(e.op){case"a":case"s":let r=e.value;if(typeof r=="string"&&(r=[r]),r.length===0)return;this.maybeSetNormalizedName(e.name,n);let i=(e.op==="a"?this.headers.get(n):void 0)||[];i.push(...r),this.headers.set(n,i);break;case"d":let o=e.value;if(!o)this.headers.delete(n),this.normalizedNames.delete(n);else{let s=this.headers.get(n);if(!s)return;s=s.filter(a=>o.indexOf(a)===-1),s.length===0?(this.headers.delete(n),this.normalizedNames.delete(n)):this.headers.set(n,s)}break}}setHeaderEntries(e,n){let r=(Array.isArray(n)?n:[n]).map(o=>o.toString()),i=e.toLowerCase();this.headers.set(i,r),this.maybeSetNormalizedName(e,i)}forEach(e){this.init(),Array.from(this.normalizedNames.keys()).forEach(n=>e(this.normalizedNames.get(n),this.headers.get(n)))}};var nu=class{encodeKey(e){return Bf(e)}encodeValue(e){return Bf(e)}decodeKey(e){return decodeURIComponent(e)}decodeValue(e){return decodeURIComponent(e)}};function qD(t,e){let n=new Map;return t.length>0&&t.replace(/^\?/,"").split("&").forEach(i=>{let o=i.indexOf("="),[s,a]=o==-1?[e.decodeKey(i),""]:[e.decodeKey(i.slice(0,o)),e.decodeValue(i.slice(o+1))],u=n.get(s)||[];u.push(a),n.set(s,u)}),n}var ZD=/%(\d[a-f0-9])/gi,YD={40:"@","3A":":",24:"$","2C":",","3B":";","3D":"=","3F":"?","2F":"/"};function Bf(t){return encodeURIComponent(t).replace(ZD,(e,n)=>YD[n]??e)}function so(t){return`${t}`}var gt=class t{constructor(e={}){if(this.updates=null,this.cloneFrom=null,this.encoder=e.encoder||new nu,e.fromString){if(e.fromObject)throw new Error("Cannot specify both fromString and fromObject.");this.map=qD(e.fromString,this.encoder)}else e.fromObject?(this.map=new Map,Object.keys(e.fromObject).forEach(n=>{let r=e.fromObject[n],i=Array.isArray(r)?r.map(so):[so(r)];this.map.set(n,i)})):this.map=null}has(e){return this.init(),this.map.has(e)}get(e){this.init();let n=this.map.get(e);return n?n[0]:null}getAll(e){return this.init(),this.map.get(e)||null}keys(){return this.init(),Array.from(this.map.keys())}append(e,n){return this.clone({param:e,value:n,op:"a"})}appendAll(e){let n=[];return Object.keys(e).forEach(r=>{let i=e[r];Array.isArray(i)?i.forEach(o=>{n.push({param:r,value:o,op:"a"})}):n.push({param:r,value:i,op:"a"})}),this.clone(n)}set(e,n){return this.clone({param:e,value:n,op:"s"})}delete(e,n){return this.clone({param:e,value:n,op:"d"})}toString(){return this.init(),this.keys().map(e=>{let n=this.encoder.encodeKey(e);return this.map.get(e).map(r=>n+"="+this.encoder.encodeValue(r)).join("&")}).filter(e=>e!=="").join("&")}clone(e){let n=new t({encoder:this.encoder});return n.cloneFrom=this.cloneFrom||this,n.updates=(this.updates||[]).concat(e),n}init(){this.map===null&&(this.map=new Map),this.cloneFrom!==null&&(this.cloneFrom.init(),this.cloneFrom.keys().forEach(e=>this.map.set(e,this.cloneFrom.map.get(e))),this.updates.forEach(e=>{switch(e.op){case"a":case"s":let n=(e.op==="a"?this.map.get(e.param):void 0)||[];n.push(so(e.value)),this.map.set(e.param,n);break;case"d":if(e.value!==void 0){let r=this.map.get(e.param)||[],i=r.indexOf(so(e.value));i!==-1&&r.splice(i,1),r.length>0?this.map.set(e.param,r):this.map.delete(e.param)}else{this.map.delete(e.param);break}}}),this.cloneFrom=this.updates=null)}};var ru=class{constructor(){this.map=new Map}set(e,n){return this.map.set(e,n),this}get(e){return this.map.has(e)||this.map.set(e,e.defaultValue()),this.map.get(e)}delete(e){return this.map.delete(e),this}has(e){return this.map.has(e)}keys(){return this.map.keys()}};function QD(t){switch(t){case"DELETE":case"GET":case"HEAD":case"OPTIONS":case"JSONP":return!1;default:return!0}}function Hf(t){return typeof ArrayBuffer<"u"&&t instanceof ArrayBuffer}function zf(t){return typeof Blob<"u"&&t instanceof Blob}function Gf(t){return typeof FormData<"u"&&t instanceof FormData}function KD(t){return typeof URLSearchParams<"u"&&t instanceof URLSearchParams}var cr=class t{constructor(e,n,r,i){this.url=n,this.body=null,this.reportProgress=!1,this.withCredentials=!1,this.responseType="json",this.method=e.toUpperCase();let o;if(QD(this.method)||i?(this.body=r!==void 0?r:null,o=i):o=r,o&&(this.reportProgress=!!o.reportProgress,this.withCredentials=!!o.withCredentials,o.responseType&&(this.responseType=o.responseType),o.headers&&(this.headers=o.headers),o.context&&(this.context=o.context),o.params&&(this.params=o.params),this.transferCache=o.transferCache),this.headers||(this.headers=new Bt),this.context||(this.context=new ru),!this.params)this.params=new gt,this.urlWithParams=n;else{let s=this.params.toString();if(s.length===0)this.urlWithParams=n;else{let a=n.indexOf("?"),u=a===-1?"?":a<n.length-1?"&":"";this.urlWithParams=n+u+s}}}serializeBody(){return this.body===null?null:Hf(this.body)||zf(this.body)||Gf(this.body)||KD(this.body)||typeof this.body=="string"?this.body:this.body instanceof gt?this.body.toString():typeof this.body=="object"||typeof this.body=="boolean"||Array.isArray(this.body)?JSON.stringify(this.body):this.body.toString()}detectContentTypeHeader(){return this.body===null||Gf(this.body)?null:zf(this.body)?this.body.type||null:Hf(this.body)?null:typeof this.body=="string"?"text/plain":this.body instanceof gt?"application/x-www-form-urlencoded;charset=UTF-8":typeof this.body=="object"||typeof this.body=="number"||typeof this.body=="boolean"?"application/json":null}clone(e={}){let n=e.method||this.method,r=e.url||this.url,i=e.responseType||this.responseType,o=e.body!==void 0?e.body:this.body,s=e.withCredentials!==void 0?e.withCredentials:this.withCredentials,a=e.reportProgress!==void 0?e.reportProgress:this.reportProgress,u=e.headers||this.headers,c=e.params||this.params,l=e.context??this.context;return e.setHeaders!==void 0&&(u=Object.keys(e.setHeaders).reduce((d,f)=>d.set(f,e.setHeaders[f]),u)),e.setParams&&(c=Object.keys(e.setParams).reduce((d,f)=>d.set(f,e.setParams[f]),c)),new t(n,r,o,{params:c,headers:u,context:l,reportProgress:a,responseType:i,withCredentials:s})}},Mn=function(t){return t[t.Sent=0]="Sent",t[t.UploadProgress=1]="UploadProgress",t[t.ResponseHeader=2]="ResponseHeader",t[t.DownloadProgress=3]="DownloadProgress",t[t.Response=4]="Response",t[t.User=5]="User",t}(Mn||{}),dr=class{constructor(e,n=200,r="OK"){this.headers=e.headers||new Bt,this.status=e.status!==void 0?e.status:n,this.statusText=e.statusText||r,this.url=e.url||null,this.ok=this.status>=200&&this.status<300}},iu=class t extends dr{constructor(e={}){super(e),this.type=Mn.ResponseHeader}clone(e={}){return new t({headers:e.headers||this.headers,status:e.status!==void 0?e.status:this.status,statusText:e.statusText||this.statusText,url:e.url||this.url||void 0})}},uo=class t extends dr{constructor(e={}){super(e),this.type=Mn.Response,this.body=e.body!==void 0?e.body:null}clone(e={}){return new t({body:e.body!==void 0?e.body:this.body,headers:e.headers||this.headers,status:e.status!==void 0?e.status:this.status,statusText:e.statusText||this.statusText,url:e.url||this.url||void 0})}},co=class extends dr{constructor(e){super(e,0,"Unknown Error"),this.name="HttpErrorResponse",this.ok=!1,this.status>=200&&this.status<300?this.message=`Http failure during parsing for ${e.url||"(unknown url)"}`:this.message=`Http failure response for ${e.url||"(unknown url)"}: ${e.status} ${e.statusText}`,this.error=e.error||null}};function tu(t,e){return{body:e,headers:t.headers,context:t.context,observe:t.observe,params:t.params,reportProgress:t.reportProgress,responseType:t.responseType,withCredentials:t.withCredentials,transferCache:t.transferCache}}var ou=(()=>{let e=class e{constructor(r){this.handler=r}request(r,i,o={}){let s;if(r instanceof cr)s=r;else{let c;o.headers instanceof Bt?c=o.headers:c=new Bt(o.headers);let l;o.params&&(o.params instanceof gt?l=o.params:l=new gt({fromObject:o.params})),s=new cr(r,i,o.body!==void 0?o.body:null,{headers:c,context:o.context,params:l,reportProgress:o.reportProgress,responseType:o.responseType||"json",withCredentials:o.withCredentials,transferCache:o.transferCache})}let a=D(s).pipe(nt(c=>this.handler.handle(c)));if(r instanceof cr||o.observe==="events")return a;let u=a.pipe(Y(c=>c instanceof uo));switch(o.observe||"body"){case"body":switch(s.responseType){case"arraybuffer":return u.pipe(M(c=>{if(c.body!==null&&!(c.body instanceof ArrayBuffer))throw new Error("Response is not an ArrayBuffer.");return c.body}));case"blob":return u.pipe(M(c=>{if(c.body!==null&&!(c.body instanceof Blob))throw new Error("Response is not a Blob.");return c.body}));case"text":return u.pipe(M(c=>{if(c.body!==null&&typeof c.body!="string")throw new Error("Response is not a string.");return c.body}));case"json":default:return u.pipe(M(c=>c.body))}case"response":return u;default:throw new Error(`Unreachable: unhandled observe type ${o.observe}}`)}}delete(r,i={}){return this.request("DELETE",r,i)}get(r,i={}){return this.request("GET",r,i)}head(r,i={}){return this.request("HEAD",r,i)}jsonp(r,i){return this.request("JSONP",r,{params:new gt().append(i,"JSONP_CALLBACK"),observe:"body",responseType:"json"})}options(r,i={}){return this.request("OPTIONS",r,i)}patch(r,i,o={}){return this.request("PATCH",r,tu(o,i))}post(r,i,o={}){return this.request("POST",r,tu(o,i))}put(r,i,o={}){return this.request("PUT",r,tu(o,i))}};e.\u0275fac=function(i){return new(i||e)(I(lr))},e.\u0275prov=w({token:e,factory:e.\u0275fac});let t=e;return t})();function JD(t,e){return e(t)}function XD(t,e,n){return(r,i)=>Ze(n,()=>e(r,o=>t(o,i)))}var Zf=new E(""),eC=new E(""),tC=new E("");var Wf=(()=>{let e=class e extends lr{constructor(r,i){super(),this.backend=r,this.injector=i,this.chain=null,this.pendingTasks=p(ar);let o=p(tC,{optional:!0});this.backend=o??r}handle(r){if(this.chain===null){let o=Array.from(new Set([...this.injector.get(Zf),...this.injector.get(eC,[])]));this.chain=o.reduceRight((s,a)=>XD(s,a,this.injector),JD)}let i=this.pendingTasks.add();return this.chain(r,o=>this.backend.handle(o)).pipe(Mt(()=>this.pendingTasks.remove(i)))}};e.\u0275fac=function(i){return new(i||e)(I(ao),I(le))},e.\u0275prov=w({token:e,factory:e.\u0275fac});let t=e;return t})();var nC=/^\)\]\}',?\n/;function rC(t){return"responseURL"in t&&t.responseURL?t.responseURL:/^X-Request-URL:/m.test(t.getAllResponseHeaders())?t.getResponseHeader("X-Request-URL"):null}var qf=(()=>{let e=class e{constructor(r){this.xhrFactory=r}handle(r){if(r.method==="JSONP")throw new C(-2800,!1);let i=this.xhrFactory;return(i.\u0275loadImpl?j(i.\u0275loadImpl()):D(null)).pipe(Z(()=>new S(s=>{let a=i.build();if(a.open(r.method,r.urlWithParams),r.withCredentials&&(a.withCredentials=!0),r.headers.forEach((b,v)=>a.setRequestHeader(b,v.join(","))),r.headers.has("Accept")||a.setRequestHeader("Accept","application/json, text/plain, */*"),!r.headers.has("Content-Type")){let b=r.detectContentTypeHeader();b!==null&&a.setRequestHeader("Content-Type",b)}if(r.responseType){let b=r.responseType.toLowerCase();a.responseType=b!=="json"?b:"text"}let u=r.serializeBody(),c=null,l=()=>{if(c!==null)return c;let b=a.statusText||"OK",v=new Bt(a.getAllResponseHeaders()),z=rC(a)||r.url;return c=new iu({headers:v,status:a.status,statusText:b,url:z}),c},d=()=>{let{headers:b,status:v,statusText:z,url:X}=l(),$=null;v!==204&&($=typeof a.response>"u"?a.responseText:a.response),v===0&&(v=$?200:0);let Se=v>=200&&v<300;if(r.responseType==="json"&&typeof $=="string"){let de=$;$=$.replace(nC,"");try{$=$!==""?JSON.parse($):null}catch(Je){$=de,Se&&(Se=!1,$={error:Je,text:$})}}Se?(s.next(new uo({body:$,headers:b,status:v,statusText:z,url:X||void 0})),s.complete()):s.error(new co({error:$,headers:b,status:v,statusText:z,url:X||void 0}))},f=b=>{let{url:v}=l(),z=new co({error:b,status:a.status||0,statusText:a.statusText||"Unknown Error",url:v||void 0});s.error(z)},h=!1,g=b=>{h||(s.next(l()),h=!0);let v={type:Mn.DownloadProgress,loaded:b.loaded};b.lengthComputable&&(v.total=b.total),r.responseType==="text"&&a.responseText&&(v.partialText=a.responseText),s.next(v)},_=b=>{let v={type:Mn.UploadProgress,loaded:b.loaded};b.lengthComputable&&(v.total=b.total),s.next(v)};return a.addEventListener("load",d),a.addEventListener("error",f),a.addEventListener("timeout",f),a.addEventListener("abort",f),r.reportProgress&&(a.addEventListener("progress",g),u!==null&&a.upload&&a.upload.addEventListener("progress",_)),a.send(u),s.next({type:Mn.Sent}),()=>{a.removeEventListener("error",f),a.removeEventListener("abort",f),a.removeEventListener("load",d),a.removeEventListener("timeout",f),r.reportProgress&&(a.removeEventListener("progress",g),u!==null&&a.upload&&a.upload.removeEventListener("progress",_)),a.readyState!==a.DONE&&a.abort()}})))}};e.\u0275fac=function(i){return new(i||e)(I(In))},e.\u0275prov=w({token:e,factory:e.\u0275fac});let t=e;return t})(),Yf=new E("XSRF_ENABLED"),iC="XSRF-TOKEN",oC=new E("XSRF_COOKIE_NAME",{providedIn:"root",factory:()=>iC}),sC="X-XSRF-TOKEN",aC=new E("XSRF_HEADER_NAME",{providedIn:"root",factory:()=>sC}),lo=class{},uC=(()=>{let e=class e{constructor(r,i,o){this.doc=r,this.platform=i,this.cookieName=o,this.lastCookieString="",this.lastToken=null,this.parseCount=0}getToken(){if(this.platform==="server")return null;let r=this.doc.cookie||"";return r!==this.lastCookieString&&(this.parseCount++,this.lastToken=oo(r,this.cookieName),this.lastCookieString=r),this.lastToken}};e.\u0275fac=function(i){return new(i||e)(I(ae),I(_e),I(oC))},e.\u0275prov=w({token:e,factory:e.\u0275fac});let t=e;return t})();function cC(t,e){let n=t.url.toLowerCase();if(!p(Yf)||t.method==="GET"||t.method==="HEAD"||n.startsWith("http://")||n.startsWith("https://"))return e(t);let r=p(lo).getToken(),i=p(aC);return r!=null&&!t.headers.has(i)&&(t=t.clone({headers:t.headers.set(i,r)})),e(t)}function Qf(...t){let e=[ou,qf,Wf,{provide:lr,useExisting:Wf},{provide:ao,useExisting:qf},{provide:Zf,useValue:cC,multi:!0},{provide:Yf,useValue:!0},{provide:lo,useClass:uC}];for(let n of t)e.push(...n.\u0275providers);return ct(e)}var uu=class extends ro{constructor(){super(...arguments),this.supportsDOMEvents=!0}},cu=class t extends uu{static makeCurrent(){kf(new t)}onAndCancel(e,n,r){return e.addEventListener(n,r),()=>{e.removeEventListener(n,r)}}dispatchEvent(e,n){e.dispatchEvent(n)}remove(e){e.parentNode&&e.parentNode.removeChild(e)}createElement(e,n){return n=n||this.getDefaultDocument(),n.createElement(e)}createHtmlDocument(){return document.implementation.createHTMLDocument("fakeTitle")}getDefaultDocument(){return document}isElementNode(e){return e.nodeType===Node.ELEMENT_NODE}isShadowRoot(e){return e instanceof DocumentFragment}getGlobalEventTarget(e,n){return n==="window"?window:n==="document"?e:n==="body"?e.body:null}getBaseHref(e){let n=dC();return n==null?null:fC(n)}resetBaseElement(){fr=null}getUserAgent(){return window.navigator.userAgent}getCookie(e){return oo(document.cookie,e)}},fr=null;function dC(){return fr=fr||document.querySelector("base"),fr?fr.getAttribute("href"):null}function fC(t){return new URL(t,document.baseURI).pathname}var hC=(()=>{let e=class e{build(){return new XMLHttpRequest}};e.\u0275fac=function(i){return new(i||e)},e.\u0275prov=w({token:e,factory:e.\u0275fac});let t=e;return t})(),lu=new E("EventManagerPlugins"),eh=(()=>{let e=class e{constructor(r,i){this._zone=i,this._eventNameToPlugin=new Map,r.forEach(o=>{o.manager=this}),this._plugins=r.slice().reverse()}addEventListener(r,i,o){return this._findPluginFor(i).addEventListener(r,i,o)}getZone(){return this._zone}_findPluginFor(r){let i=this._eventNameToPlugin.get(r);if(i)return i;if(i=this._plugins.find(s=>s.supports(r)),!i)throw new C(5101,!1);return this._eventNameToPlugin.set(r,i),i}};e.\u0275fac=function(i){return new(i||e)(I(lu),I(H))},e.\u0275prov=w({token:e,factory:e.\u0275fac});let t=e;return t})(),fo=class{constructor(e){this._doc=e}},su="ng-app-id",th=(()=>{let e=class e{constructor(r,i,o,s={}){this.doc=r,this.appId=i,this.nonce=o,this.platformId=s,this.styleRef=new Map,this.hostNodes=new Set,this.styleNodesInDOM=this.collectServerRenderedStyles(),this.platformIsServer=eu(s),this.resetHostNodes()}addStyles(r){for(let i of r)this.changeUsageCount(i,1)===1&&this.onStyleAdded(i)}removeStyles(r){for(let i of r)this.changeUsageCount(i,-1)<=0&&this.onStyleRemoved(i)}ngOnDestroy(){let r=this.styleNodesInDOM;r&&(r.forEach(i=>i.remove()),r.clear());for(let i of this.getAllStyles())this.onStyleRemoved(i);this.resetHostNodes()}addHost(r){this.hostNodes.add(r);for(let i of this.getAllStyles())this.addStyleToHost(r,i)}removeHost(r){this.hostNodes.delete(r)}getAllStyles(){return this.styleRef.keys()}onStyleAdded(r){for(let i of this.hostNodes)this.addStyleToHost(i,r)}onStyleRemoved(r){let i=this.styleRef;i.get(r)?.elements?.forEach(o=>o.remove()),i.delete(r)}collectServerRenderedStyles(){let r=this.doc.head?.querySelectorAll(`style[${su}="${this.appId}"]`);if(r?.length){let i=new Map;return r.forEach(o=>{o.textContent!=null&&i.set(o.textContent,o)}),i}return null}changeUsageCount(r,i){let o=this.styleRef;if(o.has(r)){let s=o.get(r);return s.usage+=i,s.usage}return o.set(r,{usage:i,elements:[]}),i}getStyleElement(r,i){let o=this.styleNodesInDOM,s=o?.get(i);if(s?.parentNode===r)return o.delete(i),s.removeAttribute(su),s;{let a=this.doc.createElement("style");return this.nonce&&a.setAttribute("nonce",this.nonce),a.textContent=i,this.platformIsServer&&a.setAttribute(su,this.appId),r.appendChild(a),a}}addStyleToHost(r,i){let o=this.getStyleElement(r,i),s=this.styleRef,a=s.get(i)?.elements;a?a.push(o):s.set(i,{elements:[o],usage:1})}resetHostNodes(){let r=this.hostNodes;r.clear(),r.add(this.doc.head)}};e.\u0275fac=function(i){return new(i||e)(I(ae),I(Ea),I(Ia,8),I(_e))},e.\u0275prov=w({token:e,factory:e.\u0275fac});let t=e;return t})(),au={svg:"http://www.w3.org/2000/svg",xhtml:"http://www.w3.org/1999/xhtml",xlink:"http://www.w3.org/1999/xlink",xml:"http://www.w3.org/XML/1998/namespace",xmlns:"http://www.w3.org/2000/xmlns/",math:"http://www.w3.org/1998/MathML/"},fu=/%COMP%/g,nh="%COMP%",pC=`_nghost-${nh}`,gC=`_ngcontent-${nh}`,mC=!0,vC=new E("RemoveStylesOnCompDestroy",{providedIn:"root",factory:()=>mC});function yC(t){return gC.replace(fu,t)}function DC(t){return pC.replace(fu,t)}function rh(t,e){return e.map(n=>n.replace(fu,t))}var Kf=(()=>{let e=class e{constructor(r,i,o,s,a,u,c,l=null){this.eventManager=r,this.sharedStylesHost=i,this.appId=o,this.removeStylesOnCompDestroy=s,this.doc=a,this.platformId=u,this.ngZone=c,this.nonce=l,this.rendererByCompId=new Map,this.platformIsServer=eu(u),this.defaultRenderer=new hr(r,a,c,this.platformIsServer)}createRenderer(r,i){if(!r||!i)return this.defaultRenderer;this.platformIsServer&&i.encapsulation===Re.ShadowDom&&(i=V(m({},i),{encapsulation:Re.Emulated}));let o=this.getOrCreateRenderer(r,i);return o instanceof ho?o.applyToHost(r):o instanceof pr&&o.applyStyles(),o}getOrCreateRenderer(r,i){let o=this.rendererByCompId,s=o.get(i.id);if(!s){let a=this.doc,u=this.ngZone,c=this.eventManager,l=this.sharedStylesHost,d=this.removeStylesOnCompDestroy,f=this.platformIsServer;switch(i.encapsulation){case Re.Emulated:s=new ho(c,l,i,this.appId,d,a,u,f);break;case Re.ShadowDom:return new du(c,l,r,i,a,u,this.nonce,f);default:s=new pr(c,l,i,d,a,u,f);break}o.set(i.id,s)}return s}ngOnDestroy(){this.rendererByCompId.clear()}};e.\u0275fac=function(i){return new(i||e)(I(eh),I(th),I(Ea),I(vC),I(ae),I(_e),I(H),I(Ia))},e.\u0275prov=w({token:e,factory:e.\u0275fac});let t=e;return t})(),hr=class{constructor(e,n,r,i){this.eventManager=e,this.doc=n,this.ngZone=r,this.platformIsServer=i,this.data=Object.create(null),this.throwOnSyntheticProps=!0,this.destroyNode=null}destroy(){}createElement(e,n){return n?this.doc.createElementNS(au[n]||n,e):this.doc.createElement(e)}createComment(e){return this.doc.createComment(e)}createText(e){return this.doc.createTextNode(e)}appendChild(e,n){(Jf(e)?e.content:e).appendChild(n)}insertBefore(e,n,r){e&&(Jf(e)?e.content:e).insertBefore(n,r)}removeChild(e,n){e&&e.removeChild(n)}selectRootElement(e,n){let r=typeof e=="string"?this.doc.querySelector(e):e;if(!r)throw new C(-5104,!1);return n||(r.textContent=""),r}parentNode(e){return e.parentNode}nextSibling(e){return e.nextSibling}setAttribute(e,n,r,i){if(i){n=i+":"+n;let o=au[i];o?e.setAttributeNS(o,n,r):e.setAttribute(n,r)}else e.setAttribute(n,r)}removeAttribute(e,n,r){if(r){let i=au[r];i?e.removeAttributeNS(i,n):e.removeAttribute(`${r}:${n}`)}else e.removeAttribute(n)}addClass(e,n){e.classList.add(n)}removeClass(e,n){e.classList.remove(n)}setStyle(e,n,r,i){i&(ze.DashCase|ze.Important)?e.style.setProperty(n,r,i&ze.Important?"important":""):e.style[n]=r}removeStyle(e,n,r){r&ze.DashCase?e.style.removeProperty(n):e.style[n]=""}setProperty(e,n,r){e!=null&&(e[n]=r)}setValue(e,n){e.nodeValue=n}listen(e,n,r){if(typeof e=="string"&&(e=Ke().getGlobalEventTarget(this.doc,e),!e))throw new Error(`Unsupported event target ${e} for event ${n}`);return this.eventManager.addEventListener(e,n,this.decoratePreventDefault(r))}decoratePreventDefault(e){return n=>{if(n==="__ngUnwrap__")return e;(this.platformIsServer?this.ngZone.runGuarded(()=>e(n)):e(n))===!1&&n.preventDefault()}}};function Jf(t){return t.tagName==="TEMPLATE"&&t.content!==void 0}var du=class extends hr{constructor(e,n,r,i,o,s,a,u){super(e,o,s,u),this.sharedStylesHost=n,this.hostEl=r,this.shadowRoot=r.attachShadow({mode:"open"}),this.sharedStylesHost.addHost(this.shadowRoot);let c=rh(i.id,i.styles);for(let l of c){let d=document.createElement("style");a&&d.setAttribute("nonce",a),d.textContent=l,this.shadowRoot.appendChild(d)}}nodeOrShadowRoot(e){return e===this.hostEl?this.shadowRoot:e}appendChild(e,n){return super.appendChild(this.nodeOrShadowRoot(e),n)}insertBefore(e,n,r){return super.insertBefore(this.nodeOrShadowRoot(e),n,r)}removeChild(e,n){return super.removeChild(this.nodeOrShadowRoot(e),n)}parentNode(e){return this.nodeOrShadowRoot(super.parentNode(this.nodeOrShadowRoot(e)))}destroy(){this.sharedStylesHost.removeHost(this.shadowRoot)}},pr=class extends hr{constructor(e,n,r,i,o,s,a,u){super(e,o,s,a),this.sharedStylesHost=n,this.removeStylesOnCompDestroy=i,this.styles=u?rh(u,r.styles):r.styles}applyStyles(){this.sharedStylesHost.addStyles(this.styles)}destroy(){this.removeStylesOnCompDestroy&&this.sharedStylesHost.removeStyles(this.styles)}},ho=class extends pr{constructor(e,n,r,i,o,s,a,u){let c=i+"-"+r.id;super(e,n,r,o,s,a,u,c),this.contentAttr=yC(c),this.hostAttr=DC(c)}applyToHost(e){this.applyStyles(),this.setAttribute(e,this.hostAttr,"")}createElement(e,n){let r=super.createElement(e,n);return super.setAttribute(r,this.contentAttr,""),r}},CC=(()=>{let e=class e extends fo{constructor(r){super(r)}supports(r){return!0}addEventListener(r,i,o){return r.addEventListener(i,o,!1),()=>this.removeEventListener(r,i,o)}removeEventListener(r,i,o){return r.removeEventListener(i,o)}};e.\u0275fac=function(i){return new(i||e)(I(ae))},e.\u0275prov=w({token:e,factory:e.\u0275fac});let t=e;return t})(),Xf=["alt","control","meta","shift"],wC={"\b":"Backspace","	":"Tab","\x7F":"Delete","\x1B":"Escape",Del:"Delete",Esc:"Escape",Left:"ArrowLeft",Right:"ArrowRight",Up:"ArrowUp",Down:"ArrowDown",Menu:"ContextMenu",Scroll:"ScrollLock",Win:"OS"},EC={alt:t=>t.altKey,control:t=>t.ctrlKey,meta:t=>t.metaKey,shift:t=>t.shiftKey},bC=(()=>{let e=class e extends fo{constructor(r){super(r)}supports(r){return e.parseEventName(r)!=null}addEventListener(r,i,o){let s=e.parseEventName(i),a=e.eventCallback(s.fullKey,o,this.manager.getZone());return this.manager.getZone().runOutsideAngular(()=>Ke().onAndCancel(r,s.domEventName,a))}static parseEventName(r){let i=r.toLowerCase().split("."),o=i.shift();if(i.length===0||!(o==="keydown"||o==="keyup"))return null;let s=e._normalizeKey(i.pop()),a="",u=i.indexOf("code");if(u>-1&&(i.splice(u,1),a="code."),Xf.forEach(l=>{let d=i.indexOf(l);d>-1&&(i.splice(d,1),a+=l+".")}),a+=s,i.length!=0||s.length===0)return null;let c={};return c.domEventName=o,c.fullKey=a,c}static matchEventFullKeyCode(r,i){let o=wC[r.key]||r.key,s="";return i.indexOf("code.")>-1&&(o=r.code,s="code."),o==null||!o?!1:(o=o.toLowerCase(),o===" "?o="space":o==="."&&(o="dot"),Xf.forEach(a=>{if(a!==o){let u=EC[a];u(r)&&(s+=a+".")}}),s+=o,s===i)}static eventCallback(r,i,o){return s=>{e.matchEventFullKeyCode(s,r)&&o.runGuarded(()=>i(s))}}static _normalizeKey(r){return r==="esc"?"escape":r}};e.\u0275fac=function(i){return new(i||e)(I(ae))},e.\u0275prov=w({token:e,factory:e.\u0275fac});let t=e;return t})();function ih(t,e){return Of(m({rootComponent:t},IC(e)))}function IC(t){return{appProviders:[...AC,...t?.providers??[]],platformProviders:TC}}function MC(){cu.makeCurrent()}function _C(){return new Ge}function SC(){return jd(document),document}var TC=[{provide:_e,useValue:Ja},{provide:ba,useValue:MC,multi:!0},{provide:ae,useFactory:SC,deps:[]}];var AC=[{provide:qi,useValue:"root"},{provide:Ge,useFactory:_C,deps:[]},{provide:lu,useClass:CC,multi:!0,deps:[ae,H,_e]},{provide:lu,useClass:bC,multi:!0,deps:[ae]},Kf,th,eh,{provide:Qn,useExisting:Kf},{provide:In,useClass:hC,deps:[]},[]];function xC(){return new hu(I(ae))}var hu=(()=>{let e=class e{constructor(r){this._doc=r}getTitle(){return this._doc.title}setTitle(r){this._doc.title=r||""}};e.\u0275fac=function(i){return new(i||e)(I(ae))},e.\u0275prov=w({token:e,factory:function(i){let o=null;return i?o=new i:o=xC(),o},providedIn:"root"});let t=e;return t})();var x="primary",Ar=Symbol("RouteTitle"),yu=class{constructor(e){this.params=e||{}}has(e){return Object.prototype.hasOwnProperty.call(this.params,e)}get(e){if(this.has(e)){let n=this.params[e];return Array.isArray(n)?n[0]:n}return null}getAll(e){if(this.has(e)){let n=this.params[e];return Array.isArray(n)?n:[n]}return[]}get keys(){return Object.keys(this.params)}};function xn(t){return new yu(t)}function RC(t,e,n){let r=n.path.split("/");if(r.length>t.length||n.pathMatch==="full"&&(e.hasChildren()||r.length<t.length))return null;let i={};for(let o=0;o<r.length;o++){let s=r[o],a=t[o];if(s.startsWith(":"))i[s.substring(1)]=a;else if(s!==a.path)return null}return{consumed:t.slice(0,r.length),posParams:i}}function PC(t,e){if(t.length!==e.length)return!1;for(let n=0;n<t.length;++n)if(!Ve(t[n],e[n]))return!1;return!0}function Ve(t,e){let n=t?Du(t):void 0,r=e?Du(e):void 0;if(!n||!r||n.length!=r.length)return!1;let i;for(let o=0;o<n.length;o++)if(i=n[o],!lh(t[i],e[i]))return!1;return!0}function Du(t){return[...Object.keys(t),...Object.getOwnPropertySymbols(t)]}function lh(t,e){if(Array.isArray(t)&&Array.isArray(e)){if(t.length!==e.length)return!1;let n=[...t].sort(),r=[...e].sort();return n.every((i,o)=>r[o]===i)}else return t===e}function dh(t){return t.length>0?t[t.length-1]:null}function yt(t){return Jo(t)?t:jt(t)?j(Promise.resolve(t)):D(t)}var FC={exact:hh,subset:ph},fh={exact:kC,subset:LC,ignored:()=>!0};function oh(t,e,n){return FC[n.paths](t.root,e.root,n.matrixParams)&&fh[n.queryParams](t.queryParams,e.queryParams)&&!(n.fragment==="exact"&&t.fragment!==e.fragment)}function kC(t,e){return Ve(t,e)}function hh(t,e,n){if(!zt(t.segments,e.segments)||!mo(t.segments,e.segments,n)||t.numberOfChildren!==e.numberOfChildren)return!1;for(let r in e.children)if(!t.children[r]||!hh(t.children[r],e.children[r],n))return!1;return!0}function LC(t,e){return Object.keys(e).length<=Object.keys(t).length&&Object.keys(e).every(n=>lh(t[n],e[n]))}function ph(t,e,n){return gh(t,e,e.segments,n)}function gh(t,e,n,r){if(t.segments.length>n.length){let i=t.segments.slice(0,n.length);return!(!zt(i,n)||e.hasChildren()||!mo(i,n,r))}else if(t.segments.length===n.length){if(!zt(t.segments,n)||!mo(t.segments,n,r))return!1;for(let i in e.children)if(!t.children[i]||!ph(t.children[i],e.children[i],r))return!1;return!0}else{let i=n.slice(0,t.segments.length),o=n.slice(t.segments.length);return!zt(t.segments,i)||!mo(t.segments,i,r)||!t.children[x]?!1:gh(t.children[x],e,o,r)}}function mo(t,e,n){return e.every((r,i)=>fh[n](t[i].parameters,r.parameters))}var mt=class{constructor(e=new k([],{}),n={},r=null){this.root=e,this.queryParams=n,this.fragment=r}get queryParamMap(){return this._queryParamMap||(this._queryParamMap=xn(this.queryParams)),this._queryParamMap}toString(){return $C.serialize(this)}},k=class{constructor(e,n){this.segments=e,this.children=n,this.parent=null,Object.values(n).forEach(r=>r.parent=this)}hasChildren(){return this.numberOfChildren>0}get numberOfChildren(){return Object.keys(this.children).length}toString(){return vo(this)}},Ht=class{constructor(e,n){this.path=e,this.parameters=n}get parameterMap(){return this._parameterMap||(this._parameterMap=xn(this.parameters)),this._parameterMap}toString(){return vh(this)}};function VC(t,e){return zt(t,e)&&t.every((n,r)=>Ve(n.parameters,e[r].parameters))}function zt(t,e){return t.length!==e.length?!1:t.every((n,r)=>n.path===e[r].path)}function jC(t,e){let n=[];return Object.entries(t.children).forEach(([r,i])=>{r===x&&(n=n.concat(e(i,r)))}),Object.entries(t.children).forEach(([r,i])=>{r!==x&&(n=n.concat(e(i,r)))}),n}var zu=(()=>{let e=class e{};e.\u0275fac=function(i){return new(i||e)},e.\u0275prov=w({token:e,factory:()=>(()=>new Do)(),providedIn:"root"});let t=e;return t})(),Do=class{parse(e){let n=new wu(e);return new mt(n.parseRootSegment(),n.parseQueryParams(),n.parseFragment())}serialize(e){let n=`/${gr(e.root,!0)}`,r=HC(e.queryParams),i=typeof e.fragment=="string"?`#${UC(e.fragment)}`:"";return`${n}${r}${i}`}},$C=new Do;function vo(t){return t.segments.map(e=>vh(e)).join("/")}function gr(t,e){if(!t.hasChildren())return vo(t);if(e){let n=t.children[x]?gr(t.children[x],!1):"",r=[];return Object.entries(t.children).forEach(([i,o])=>{i!==x&&r.push(`${i}:${gr(o,!1)}`)}),r.length>0?`${n}(${r.join("//")})`:n}else{let n=jC(t,(r,i)=>i===x?[gr(t.children[x],!1)]:[`${i}:${gr(r,!1)}`]);return Object.keys(t.children).length===1&&t.children[x]!=null?`${vo(t)}/${n[0]}`:`${vo(t)}/(${n.join("//")})`}}function mh(t){return encodeURIComponent(t).replace(/%40/g,"@").replace(/%3A/gi,":").replace(/%24/g,"$").replace(/%2C/gi,",")}function po(t){return mh(t).replace(/%3B/gi,";")}function UC(t){return encodeURI(t)}function Cu(t){return mh(t).replace(/\(/g,"%28").replace(/\)/g,"%29").replace(/%26/gi,"&")}function yo(t){return decodeURIComponent(t)}function sh(t){return yo(t.replace(/\+/g,"%20"))}function vh(t){return`${Cu(t.path)}${BC(t.parameters)}`}function BC(t){return Object.keys(t).map(e=>`;${Cu(e)}=${Cu(t[e])}`).join("")}function HC(t){let e=Object.keys(t).map(n=>{let r=t[n];return Array.isArray(r)?r.map(i=>`${po(n)}=${po(i)}`).join("&"):`${po(n)}=${po(r)}`}).filter(n=>!!n);return e.length?`?${e.join("&")}`:""}var zC=/^[^\/()?;#]+/;function pu(t){let e=t.match(zC);return e?e[0]:""}var GC=/^[^\/()?;=#]+/;function WC(t){let e=t.match(GC);return e?e[0]:""}var qC=/^[^=?&#]+/;function ZC(t){let e=t.match(qC);return e?e[0]:""}var YC=/^[^&#]+/;function QC(t){let e=t.match(YC);return e?e[0]:""}var wu=class{constructor(e){this.url=e,this.remaining=e}parseRootSegment(){return this.consumeOptional("/"),this.remaining===""||this.peekStartsWith("?")||this.peekStartsWith("#")?new k([],{}):new k([],this.parseChildren())}parseQueryParams(){let e={};if(this.consumeOptional("?"))do this.parseQueryParam(e);while(this.consumeOptional("&"));return e}parseFragment(){return this.consumeOptional("#")?decodeURIComponent(this.remaining):null}parseChildren(){if(this.remaining==="")return{};this.consumeOptional("/");let e=[];for(this.peekStartsWith("(")||e.push(this.parseSegment());this.peekStartsWith("/")&&!this.peekStartsWith("//")&&!this.peekStartsWith("/(");)this.capture("/"),e.push(this.parseSegment());let n={};this.peekStartsWith("/(")&&(this.capture("/"),n=this.parseParens(!0));let r={};return this.peekStartsWith("(")&&(r=this.parseParens(!1)),(e.length>0||Object.keys(n).length>0)&&(r[x]=new k(e,n)),r}parseSegment(){let e=pu(this.remaining);if(e===""&&this.peekStartsWith(";"))throw new C(4009,!1);return this.capture(e),new Ht(yo(e),this.parseMatrixParams())}parseMatrixParams(){let e={};for(;this.consumeOptional(";");)this.parseParam(e);return e}parseParam(e){let n=WC(this.remaining);if(!n)return;this.capture(n);let r="";if(this.consumeOptional("=")){let i=pu(this.remaining);i&&(r=i,this.capture(r))}e[yo(n)]=yo(r)}parseQueryParam(e){let n=ZC(this.remaining);if(!n)return;this.capture(n);let r="";if(this.consumeOptional("=")){let s=QC(this.remaining);s&&(r=s,this.capture(r))}let i=sh(n),o=sh(r);if(e.hasOwnProperty(i)){let s=e[i];Array.isArray(s)||(s=[s],e[i]=s),s.push(o)}else e[i]=o}parseParens(e){let n={};for(this.capture("(");!this.consumeOptional(")")&&this.remaining.length>0;){let r=pu(this.remaining),i=this.remaining[r.length];if(i!=="/"&&i!==")"&&i!==";")throw new C(4010,!1);let o;r.indexOf(":")>-1?(o=r.slice(0,r.indexOf(":")),this.capture(o),this.capture(":")):e&&(o=x);let s=this.parseChildren();n[o]=Object.keys(s).length===1?s[x]:new k([],s),this.consumeOptional("//")}return n}peekStartsWith(e){return this.remaining.startsWith(e)}consumeOptional(e){return this.peekStartsWith(e)?(this.remaining=this.remaining.substring(e.length),!0):!1}capture(e){if(!this.consumeOptional(e))throw new C(4011,!1)}};function yh(t){return t.segments.length>0?new k([],{[x]:t}):t}function Dh(t){let e={};for(let r of Object.keys(t.children)){let i=t.children[r],o=Dh(i);if(r===x&&o.segments.length===0&&o.hasChildren())for(let[s,a]of Object.entries(o.children))e[s]=a;else(o.segments.length>0||o.hasChildren())&&(e[r]=o)}let n=new k(t.segments,e);return KC(n)}function KC(t){if(t.numberOfChildren===1&&t.children[x]){let e=t.children[x];return new k(t.segments.concat(e.segments),e.children)}return t}function Nn(t){return t instanceof mt}function JC(t,e,n=null,r=null){let i=Ch(t);return wh(i,e,n,r)}function Ch(t){let e;function n(o){let s={};for(let u of o.children){let c=n(u);s[u.outlet]=c}let a=new k(o.url,s);return o===t&&(e=a),a}let r=n(t.root),i=yh(r);return e??i}function wh(t,e,n,r){let i=t;for(;i.parent;)i=i.parent;if(e.length===0)return gu(i,i,i,n,r);let o=XC(e);if(o.toRoot())return gu(i,i,new k([],{}),n,r);let s=ew(o,i,t),a=s.processChildren?yr(s.segmentGroup,s.index,o.commands):bh(s.segmentGroup,s.index,o.commands);return gu(i,s.segmentGroup,a,n,r)}function Co(t){return typeof t=="object"&&t!=null&&!t.outlets&&!t.segmentPath}function wr(t){return typeof t=="object"&&t!=null&&t.outlets}function gu(t,e,n,r,i){let o={};r&&Object.entries(r).forEach(([u,c])=>{o[u]=Array.isArray(c)?c.map(l=>`${l}`):`${c}`});let s;t===e?s=n:s=Eh(t,e,n);let a=yh(Dh(s));return new mt(a,o,i)}function Eh(t,e,n){let r={};return Object.entries(t.children).forEach(([i,o])=>{o===e?r[i]=n:r[i]=Eh(o,e,n)}),new k(t.segments,r)}var wo=class{constructor(e,n,r){if(this.isAbsolute=e,this.numberOfDoubleDots=n,this.commands=r,e&&r.length>0&&Co(r[0]))throw new C(4003,!1);let i=r.find(wr);if(i&&i!==dh(r))throw new C(4004,!1)}toRoot(){return this.isAbsolute&&this.commands.length===1&&this.commands[0]=="/"}};function XC(t){if(typeof t[0]=="string"&&t.length===1&&t[0]==="/")return new wo(!0,0,t);let e=0,n=!1,r=t.reduce((i,o,s)=>{if(typeof o=="object"&&o!=null){if(o.outlets){let a={};return Object.entries(o.outlets).forEach(([u,c])=>{a[u]=typeof c=="string"?c.split("/"):c}),[...i,{outlets:a}]}if(o.segmentPath)return[...i,o.segmentPath]}return typeof o!="string"?[...i,o]:s===0?(o.split("/").forEach((a,u)=>{u==0&&a==="."||(u==0&&a===""?n=!0:a===".."?e++:a!=""&&i.push(a))}),i):[...i,o]},[]);return new wo(n,e,r)}var Tn=class{constructor(e,n,r){this.segmentGroup=e,this.processChildren=n,this.index=r}};function ew(t,e,n){if(t.isAbsolute)return new Tn(e,!0,0);if(!n)return new Tn(e,!1,NaN);if(n.parent===null)return new Tn(n,!0,0);let r=Co(t.commands[0])?0:1,i=n.segments.length-1+r;return tw(n,i,t.numberOfDoubleDots)}function tw(t,e,n){let r=t,i=e,o=n;for(;o>i;){if(o-=i,r=r.parent,!r)throw new C(4005,!1);i=r.segments.length}return new Tn(r,!1,i-o)}function nw(t){return wr(t[0])?t[0].outlets:{[x]:t}}function bh(t,e,n){if(t||(t=new k([],{})),t.segments.length===0&&t.hasChildren())return yr(t,e,n);let r=rw(t,e,n),i=n.slice(r.commandIndex);if(r.match&&r.pathIndex<t.segments.length){let o=new k(t.segments.slice(0,r.pathIndex),{});return o.children[x]=new k(t.segments.slice(r.pathIndex),t.children),yr(o,0,i)}else return r.match&&i.length===0?new k(t.segments,{}):r.match&&!t.hasChildren()?Eu(t,e,n):r.match?yr(t,0,i):Eu(t,e,n)}function yr(t,e,n){if(n.length===0)return new k(t.segments,{});{let r=nw(n),i={};if(Object.keys(r).some(o=>o!==x)&&t.children[x]&&t.numberOfChildren===1&&t.children[x].segments.length===0){let o=yr(t.children[x],e,n);return new k(t.segments,o.children)}return Object.entries(r).forEach(([o,s])=>{typeof s=="string"&&(s=[s]),s!==null&&(i[o]=bh(t.children[o],e,s))}),Object.entries(t.children).forEach(([o,s])=>{r[o]===void 0&&(i[o]=s)}),new k(t.segments,i)}}function rw(t,e,n){let r=0,i=e,o={match:!1,pathIndex:0,commandIndex:0};for(;i<t.segments.length;){if(r>=n.length)return o;let s=t.segments[i],a=n[r];if(wr(a))break;let u=`${a}`,c=r<n.length-1?n[r+1]:null;if(i>0&&u===void 0)break;if(u&&c&&typeof c=="object"&&c.outlets===void 0){if(!uh(u,c,s))return o;r+=2}else{if(!uh(u,{},s))return o;r++}i++}return{match:!0,pathIndex:i,commandIndex:r}}function Eu(t,e,n){let r=t.segments.slice(0,e),i=0;for(;i<n.length;){let o=n[i];if(wr(o)){let u=iw(o.outlets);return new k(r,u)}if(i===0&&Co(n[0])){let u=t.segments[e];r.push(new Ht(u.path,ah(n[0]))),i++;continue}let s=wr(o)?o.outlets[x]:`${o}`,a=i<n.length-1?n[i+1]:null;s&&a&&Co(a)?(r.push(new Ht(s,ah(a))),i+=2):(r.push(new Ht(s,{})),i++)}return new k(r,{})}function iw(t){let e={};return Object.entries(t).forEach(([n,r])=>{typeof r=="string"&&(r=[r]),r!==null&&(e[n]=Eu(new k([],{}),0,r))}),e}function ah(t){let e={};return Object.entries(t).forEach(([n,r])=>e[n]=`${r}`),e}function uh(t,e,n){return t==n.path&&Ve(e,n.parameters)}var Dr="imperative",ve=class{constructor(e,n){this.id=e,this.url=n}},Er=class extends ve{constructor(e,n,r="imperative",i=null){super(e,n),this.type=0,this.navigationTrigger=r,this.restoredState=i}toString(){return`NavigationStart(id: ${this.id}, url: '${this.url}')`}},Gt=class extends ve{constructor(e,n,r){super(e,n),this.urlAfterRedirects=r,this.type=1}toString(){return`NavigationEnd(id: ${this.id}, url: '${this.url}', urlAfterRedirects: '${this.urlAfterRedirects}')`}},vt=class extends ve{constructor(e,n,r,i){super(e,n),this.reason=r,this.code=i,this.type=2}toString(){return`NavigationCancel(id: ${this.id}, url: '${this.url}')`}},Wt=class extends ve{constructor(e,n,r,i){super(e,n),this.reason=r,this.code=i,this.type=16}},br=class extends ve{constructor(e,n,r,i){super(e,n),this.error=r,this.target=i,this.type=3}toString(){return`NavigationError(id: ${this.id}, url: '${this.url}', error: ${this.error})`}},Eo=class extends ve{constructor(e,n,r,i){super(e,n),this.urlAfterRedirects=r,this.state=i,this.type=4}toString(){return`RoutesRecognized(id: ${this.id}, url: '${this.url}', urlAfterRedirects: '${this.urlAfterRedirects}', state: ${this.state})`}},bu=class extends ve{constructor(e,n,r,i){super(e,n),this.urlAfterRedirects=r,this.state=i,this.type=7}toString(){return`GuardsCheckStart(id: ${this.id}, url: '${this.url}', urlAfterRedirects: '${this.urlAfterRedirects}', state: ${this.state})`}},Iu=class extends ve{constructor(e,n,r,i,o){super(e,n),this.urlAfterRedirects=r,this.state=i,this.shouldActivate=o,this.type=8}toString(){return`GuardsCheckEnd(id: ${this.id}, url: '${this.url}', urlAfterRedirects: '${this.urlAfterRedirects}', state: ${this.state}, shouldActivate: ${this.shouldActivate})`}},Mu=class extends ve{constructor(e,n,r,i){super(e,n),this.urlAfterRedirects=r,this.state=i,this.type=5}toString(){return`ResolveStart(id: ${this.id}, url: '${this.url}', urlAfterRedirects: '${this.urlAfterRedirects}', state: ${this.state})`}},_u=class extends ve{constructor(e,n,r,i){super(e,n),this.urlAfterRedirects=r,this.state=i,this.type=6}toString(){return`ResolveEnd(id: ${this.id}, url: '${this.url}', urlAfterRedirects: '${this.urlAfterRedirects}', state: ${this.state})`}},Su=class{constructor(e){this.route=e,this.type=9}toString(){return`RouteConfigLoadStart(path: ${this.route.path})`}},Tu=class{constructor(e){this.route=e,this.type=10}toString(){return`RouteConfigLoadEnd(path: ${this.route.path})`}},Au=class{constructor(e){this.snapshot=e,this.type=11}toString(){return`ChildActivationStart(path: '${this.snapshot.routeConfig&&this.snapshot.routeConfig.path||""}')`}},xu=class{constructor(e){this.snapshot=e,this.type=12}toString(){return`ChildActivationEnd(path: '${this.snapshot.routeConfig&&this.snapshot.routeConfig.path||""}')`}},Nu=class{constructor(e){this.snapshot=e,this.type=13}toString(){return`ActivationStart(path: '${this.snapshot.routeConfig&&this.snapshot.routeConfig.path||""}')`}},Ou=class{constructor(e){this.snapshot=e,this.type=14}toString(){return`ActivationEnd(path: '${this.snapshot.routeConfig&&this.snapshot.routeConfig.path||""}')`}};var Ir=class{},Mr=class{constructor(e){this.url=e}};var Ru=class{constructor(){this.outlet=null,this.route=null,this.injector=null,this.children=new To,this.attachRef=null}},To=(()=>{let e=class e{constructor(){this.contexts=new Map}onChildOutletCreated(r,i){let o=this.getOrCreateContext(r);o.outlet=i,this.contexts.set(r,o)}onChildOutletDestroyed(r){let i=this.getContext(r);i&&(i.outlet=null,i.attachRef=null)}onOutletDeactivated(){let r=this.contexts;return this.contexts=new Map,r}onOutletReAttached(r){this.contexts=r}getOrCreateContext(r){let i=this.getContext(r);return i||(i=new Ru,this.contexts.set(r,i)),i}getContext(r){return this.contexts.get(r)||null}};e.\u0275fac=function(i){return new(i||e)},e.\u0275prov=w({token:e,factory:e.\u0275fac,providedIn:"root"});let t=e;return t})(),bo=class{constructor(e){this._root=e}get root(){return this._root.value}parent(e){let n=this.pathFromRoot(e);return n.length>1?n[n.length-2]:null}children(e){let n=Pu(e,this._root);return n?n.children.map(r=>r.value):[]}firstChild(e){let n=Pu(e,this._root);return n&&n.children.length>0?n.children[0].value:null}siblings(e){let n=Fu(e,this._root);return n.length<2?[]:n[n.length-2].children.map(i=>i.value).filter(i=>i!==e)}pathFromRoot(e){return Fu(e,this._root).map(n=>n.value)}};function Pu(t,e){if(t===e.value)return e;for(let n of e.children){let r=Pu(t,n);if(r)return r}return null}function Fu(t,e){if(t===e.value)return[e];for(let n of e.children){let r=Fu(t,n);if(r.length)return r.unshift(e),r}return[]}var he=class{constructor(e,n){this.value=e,this.children=n}toString(){return`TreeNode(${this.value})`}};function Sn(t){let e={};return t&&t.children.forEach(n=>e[n.value.outlet]=n),e}var Io=class extends bo{constructor(e,n){super(e),this.snapshot=n,Wu(this,e)}toString(){return this.snapshot.toString()}};function Ih(t,e){let n=ow(t,e),r=new ee([new Ht("",{})]),i=new ee({}),o=new ee({}),s=new ee({}),a=new ee(""),u=new On(r,i,s,a,o,x,e,n.root);return u.snapshot=n.root,new Io(new he(u,[]),n)}function ow(t,e){let n={},r={},i={},o="",s=new _r([],n,i,o,r,x,e,null,{});return new Mo("",new he(s,[]))}var On=class{constructor(e,n,r,i,o,s,a,u){this.urlSubject=e,this.paramsSubject=n,this.queryParamsSubject=r,this.fragmentSubject=i,this.dataSubject=o,this.outlet=s,this.component=a,this._futureSnapshot=u,this.title=this.dataSubject?.pipe(M(c=>c[Ar]))??D(void 0),this.url=e,this.params=n,this.queryParams=r,this.fragment=i,this.data=o}get routeConfig(){return this._futureSnapshot.routeConfig}get root(){return this._routerState.root}get parent(){return this._routerState.parent(this)}get firstChild(){return this._routerState.firstChild(this)}get children(){return this._routerState.children(this)}get pathFromRoot(){return this._routerState.pathFromRoot(this)}get paramMap(){return this._paramMap||(this._paramMap=this.params.pipe(M(e=>xn(e)))),this._paramMap}get queryParamMap(){return this._queryParamMap||(this._queryParamMap=this.queryParams.pipe(M(e=>xn(e)))),this._queryParamMap}toString(){return this.snapshot?this.snapshot.toString():`Future(${this._futureSnapshot})`}};function Gu(t,e,n="emptyOnly"){let r,{routeConfig:i}=t;return e!==null&&(n==="always"||i?.path===""||!e.component&&!e.routeConfig?.loadComponent)?r={params:m(m({},e.params),t.params),data:m(m({},e.data),t.data),resolve:m(m(m(m({},t.data),e.data),i?.data),t._resolvedData)}:r={params:t.params,data:t.data,resolve:m(m({},t.data),t._resolvedData??{})},i&&_h(i)&&(r.resolve[Ar]=i.title),r}var _r=class{get title(){return this.data?.[Ar]}constructor(e,n,r,i,o,s,a,u,c){this.url=e,this.params=n,this.queryParams=r,this.fragment=i,this.data=o,this.outlet=s,this.component=a,this.routeConfig=u,this._resolve=c}get root(){return this._routerState.root}get parent(){return this._routerState.parent(this)}get firstChild(){return this._routerState.firstChild(this)}get children(){return this._routerState.children(this)}get pathFromRoot(){return this._routerState.pathFromRoot(this)}get paramMap(){return this._paramMap||(this._paramMap=xn(this.params)),this._paramMap}get queryParamMap(){return this._queryParamMap||(this._queryParamMap=xn(this.queryParams)),this._queryParamMap}toString(){let e=this.url.map(r=>r.toString()).join("/"),n=this.routeConfig?this.routeConfig.path:"";return`Route(url:'${e}', path:'${n}')`}},Mo=class extends bo{constructor(e,n){super(n),this.url=e,Wu(this,n)}toString(){return Mh(this._root)}};function Wu(t,e){e.value._routerState=t,e.children.forEach(n=>Wu(t,n))}function Mh(t){let e=t.children.length>0?` { ${t.children.map(Mh).join(", ")} } `:"";return`${t.value}${e}`}function mu(t){if(t.snapshot){let e=t.snapshot,n=t._futureSnapshot;t.snapshot=n,Ve(e.queryParams,n.queryParams)||t.queryParamsSubject.next(n.queryParams),e.fragment!==n.fragment&&t.fragmentSubject.next(n.fragment),Ve(e.params,n.params)||t.paramsSubject.next(n.params),PC(e.url,n.url)||t.urlSubject.next(n.url),Ve(e.data,n.data)||t.dataSubject.next(n.data)}else t.snapshot=t._futureSnapshot,t.dataSubject.next(t._futureSnapshot.data)}function ku(t,e){let n=Ve(t.params,e.params)&&VC(t.url,e.url),r=!t.parent!=!e.parent;return n&&!r&&(!t.parent||ku(t.parent,e.parent))}function _h(t){return typeof t.title=="string"||t.title===null}var sw=(()=>{let e=class e{constructor(){this.activated=null,this._activatedRoute=null,this.name=x,this.activateEvents=new oe,this.deactivateEvents=new oe,this.attachEvents=new oe,this.detachEvents=new oe,this.parentContexts=p(To),this.location=p(Yi),this.changeDetector=p(En),this.environmentInjector=p(le),this.inputBinder=p(qu,{optional:!0}),this.supportsBindingToComponentInputs=!0}get activatedComponentRef(){return this.activated}ngOnChanges(r){if(r.name){let{firstChange:i,previousValue:o}=r.name;if(i)return;this.isTrackedInParentContexts(o)&&(this.deactivate(),this.parentContexts.onChildOutletDestroyed(o)),this.initializeOutletWithName()}}ngOnDestroy(){this.isTrackedInParentContexts(this.name)&&this.parentContexts.onChildOutletDestroyed(this.name),this.inputBinder?.unsubscribeFromRouteData(this)}isTrackedInParentContexts(r){return this.parentContexts.getContext(r)?.outlet===this}ngOnInit(){this.initializeOutletWithName()}initializeOutletWithName(){if(this.parentContexts.onChildOutletCreated(this.name,this),this.activated)return;let r=this.parentContexts.getContext(this.name);r?.route&&(r.attachRef?this.attach(r.attachRef,r.route):this.activateWith(r.route,r.injector))}get isActivated(){return!!this.activated}get component(){if(!this.activated)throw new C(4012,!1);return this.activated.instance}get activatedRoute(){if(!this.activated)throw new C(4012,!1);return this._activatedRoute}get activatedRouteData(){return this._activatedRoute?this._activatedRoute.snapshot.data:{}}detach(){if(!this.activated)throw new C(4012,!1);this.location.detach();let r=this.activated;return this.activated=null,this._activatedRoute=null,this.detachEvents.emit(r.instance),r}attach(r,i){this.activated=r,this._activatedRoute=i,this.location.insert(r.hostView),this.inputBinder?.bindActivatedRouteToOutletComponent(this),this.attachEvents.emit(r.instance)}deactivate(){if(this.activated){let r=this.component;this.activated.destroy(),this.activated=null,this._activatedRoute=null,this.deactivateEvents.emit(r)}}activateWith(r,i){if(this.isActivated)throw new C(4013,!1);this._activatedRoute=r;let o=this.location,a=r.snapshot.component,u=this.parentContexts.getOrCreateContext(this.name).children,c=new Lu(r,u,o.injector);this.activated=o.createComponent(a,{index:o.length,injector:c,environmentInjector:i??this.environmentInjector}),this.changeDetector.markForCheck(),this.inputBinder?.bindActivatedRouteToOutletComponent(this),this.activateEvents.emit(this.activated.instance)}};e.\u0275fac=function(i){return new(i||e)},e.\u0275dir=Ee({type:e,selectors:[["router-outlet"]],inputs:{name:"name"},outputs:{activateEvents:"activate",deactivateEvents:"deactivate",attachEvents:"attach",detachEvents:"detach"},exportAs:["outlet"],standalone:!0,features:[Cn]});let t=e;return t})(),Lu=class{constructor(e,n,r){this.route=e,this.childContexts=n,this.parent=r}get(e,n){return e===On?this.route:e===To?this.childContexts:this.parent.get(e,n)}},qu=new E("");function aw(t,e,n){let r=Sr(t,e._root,n?n._root:void 0);return new Io(r,e)}function Sr(t,e,n){if(n&&t.shouldReuseRoute(e.value,n.value.snapshot)){let r=n.value;r._futureSnapshot=e.value;let i=uw(t,e,n);return new he(r,i)}else{if(t.shouldAttach(e.value)){let o=t.retrieve(e.value);if(o!==null){let s=o.route;return s.value._futureSnapshot=e.value,s.children=e.children.map(a=>Sr(t,a)),s}}let r=cw(e.value),i=e.children.map(o=>Sr(t,o));return new he(r,i)}}function uw(t,e,n){return e.children.map(r=>{for(let i of n.children)if(t.shouldReuseRoute(r.value,i.value.snapshot))return Sr(t,r,i);return Sr(t,r)})}function cw(t){return new On(new ee(t.url),new ee(t.params),new ee(t.queryParams),new ee(t.fragment),new ee(t.data),t.outlet,t.component,t)}var Sh="ngNavigationCancelingError";function Th(t,e){let{redirectTo:n,navigationBehaviorOptions:r}=Nn(e)?{redirectTo:e,navigationBehaviorOptions:void 0}:e,i=Ah(!1,0,e);return i.url=n,i.navigationBehaviorOptions=r,i}function Ah(t,e,n){let r=new Error("NavigationCancelingError: "+(t||""));return r[Sh]=!0,r.cancellationCode=e,n&&(r.url=n),r}function lw(t){return xh(t)&&Nn(t.url)}function xh(t){return t&&t[Sh]}var dw=(()=>{let e=class e{};e.\u0275fac=function(i){return new(i||e)},e.\u0275cmp=Ui({type:e,selectors:[["ng-component"]],standalone:!0,features:[Ji],decls:1,vars:0,template:function(i,o){i&1&&Ha(0,"router-outlet")},dependencies:[sw],encapsulation:2});let t=e;return t})();function fw(t,e){return t.providers&&!t._injector&&(t._injector=Wa(t.providers,e,`Route: ${t.path}`)),t._injector??e}function Zu(t){let e=t.children&&t.children.map(Zu),n=e?V(m({},t),{children:e}):m({},t);return!n.component&&!n.loadComponent&&(e||n.loadChildren)&&n.outlet&&n.outlet!==x&&(n.component=dw),n}function je(t){return t.outlet||x}function hw(t,e){let n=t.filter(r=>je(r)===e);return n.push(...t.filter(r=>je(r)!==e)),n}function xr(t){if(!t)return null;if(t.routeConfig?._injector)return t.routeConfig._injector;for(let e=t.parent;e;e=e.parent){let n=e.routeConfig;if(n?._loadedInjector)return n._loadedInjector;if(n?._injector)return n._injector}return null}var pw=(t,e,n,r)=>M(i=>(new Vu(e,i.targetRouterState,i.currentRouterState,n,r).activate(t),i)),Vu=class{constructor(e,n,r,i,o){this.routeReuseStrategy=e,this.futureState=n,this.currState=r,this.forwardEvent=i,this.inputBindingEnabled=o}activate(e){let n=this.futureState._root,r=this.currState?this.currState._root:null;this.deactivateChildRoutes(n,r,e),mu(this.futureState.root),this.activateChildRoutes(n,r,e)}deactivateChildRoutes(e,n,r){let i=Sn(n);e.children.forEach(o=>{let s=o.value.outlet;this.deactivateRoutes(o,i[s],r),delete i[s]}),Object.values(i).forEach(o=>{this.deactivateRouteAndItsChildren(o,r)})}deactivateRoutes(e,n,r){let i=e.value,o=n?n.value:null;if(i===o)if(i.component){let s=r.getContext(i.outlet);s&&this.deactivateChildRoutes(e,n,s.children)}else this.deactivateChildRoutes(e,n,r);else o&&this.deactivateRouteAndItsChildren(n,r)}deactivateRouteAndItsChildren(e,n){e.value.component&&this.routeReuseStrategy.shouldDetach(e.value.snapshot)?this.detachAndStoreRouteSubtree(e,n):this.deactivateRouteAndOutlet(e,n)}detachAndStoreRouteSubtree(e,n){let r=n.getContext(e.value.outlet),i=r&&e.value.component?r.children:n,o=Sn(e);for(let s of Object.keys(o))this.deactivateRouteAndItsChildren(o[s],i);if(r&&r.outlet){let s=r.outlet.detach(),a=r.children.onOutletDeactivated();this.routeReuseStrategy.store(e.value.snapshot,{componentRef:s,route:e,contexts:a})}}deactivateRouteAndOutlet(e,n){let r=n.getContext(e.value.outlet),i=r&&e.value.component?r.children:n,o=Sn(e);for(let s of Object.keys(o))this.deactivateRouteAndItsChildren(o[s],i);r&&(r.outlet&&(r.outlet.deactivate(),r.children.onOutletDeactivated()),r.attachRef=null,r.route=null)}activateChildRoutes(e,n,r){let i=Sn(n);e.children.forEach(o=>{this.activateRoutes(o,i[o.value.outlet],r),this.forwardEvent(new Ou(o.value.snapshot))}),e.children.length&&this.forwardEvent(new xu(e.value.snapshot))}activateRoutes(e,n,r){let i=e.value,o=n?n.value:null;if(mu(i),i===o)if(i.component){let s=r.getOrCreateContext(i.outlet);this.activateChildRoutes(e,n,s.children)}else this.activateChildRoutes(e,n,r);else if(i.component){let s=r.getOrCreateContext(i.outlet);if(this.routeReuseStrategy.shouldAttach(i.snapshot)){let a=this.routeReuseStrategy.retrieve(i.snapshot);this.routeReuseStrategy.store(i.snapshot,null),s.children.onOutletReAttached(a.contexts),s.attachRef=a.componentRef,s.route=a.route.value,s.outlet&&s.outlet.attach(a.componentRef,a.route.value),mu(a.route.value),this.activateChildRoutes(e,null,s.children)}else{let a=xr(i.snapshot);s.attachRef=null,s.route=i,s.injector=a,s.outlet&&s.outlet.activateWith(i,s.injector),this.activateChildRoutes(e,null,s.children)}}else this.activateChildRoutes(e,null,r)}},_o=class{constructor(e){this.path=e,this.route=this.path[this.path.length-1]}},An=class{constructor(e,n){this.component=e,this.route=n}};function gw(t,e,n){let r=t._root,i=e?e._root:null;return mr(r,i,n,[r.value])}function mw(t){let e=t.routeConfig?t.routeConfig.canActivateChild:null;return!e||e.length===0?null:{node:t,guards:e}}function Pn(t,e){let n=Symbol(),r=e.get(t,n);return r===n?typeof t=="function"&&!Ol(t)?t:e.get(t):r}function mr(t,e,n,r,i={canDeactivateChecks:[],canActivateChecks:[]}){let o=Sn(e);return t.children.forEach(s=>{vw(s,o[s.value.outlet],n,r.concat([s.value]),i),delete o[s.value.outlet]}),Object.entries(o).forEach(([s,a])=>Cr(a,n.getContext(s),i)),i}function vw(t,e,n,r,i={canDeactivateChecks:[],canActivateChecks:[]}){let o=t.value,s=e?e.value:null,a=n?n.getContext(t.value.outlet):null;if(s&&o.routeConfig===s.routeConfig){let u=yw(s,o,o.routeConfig.runGuardsAndResolvers);u?i.canActivateChecks.push(new _o(r)):(o.data=s.data,o._resolvedData=s._resolvedData),o.component?mr(t,e,a?a.children:null,r,i):mr(t,e,n,r,i),u&&a&&a.outlet&&a.outlet.isActivated&&i.canDeactivateChecks.push(new An(a.outlet.component,s))}else s&&Cr(e,a,i),i.canActivateChecks.push(new _o(r)),o.component?mr(t,null,a?a.children:null,r,i):mr(t,null,n,r,i);return i}function yw(t,e,n){if(typeof n=="function")return n(t,e);switch(n){case"pathParamsChange":return!zt(t.url,e.url);case"pathParamsOrQueryParamsChange":return!zt(t.url,e.url)||!Ve(t.queryParams,e.queryParams);case"always":return!0;case"paramsOrQueryParamsChange":return!ku(t,e)||!Ve(t.queryParams,e.queryParams);case"paramsChange":default:return!ku(t,e)}}function Cr(t,e,n){let r=Sn(t),i=t.value;Object.entries(r).forEach(([o,s])=>{i.component?e?Cr(s,e.children.getContext(o),n):Cr(s,null,n):Cr(s,e,n)}),i.component?e&&e.outlet&&e.outlet.isActivated?n.canDeactivateChecks.push(new An(e.outlet.component,i)):n.canDeactivateChecks.push(new An(null,i)):n.canDeactivateChecks.push(new An(null,i))}function Nr(t){return typeof t=="function"}function Dw(t){return typeof t=="boolean"}function Cw(t){return t&&Nr(t.canLoad)}function ww(t){return t&&Nr(t.canActivate)}function Ew(t){return t&&Nr(t.canActivateChild)}function bw(t){return t&&Nr(t.canDeactivate)}function Iw(t){return t&&Nr(t.canMatch)}function Nh(t){return t instanceof Be||t?.name==="EmptyError"}var go=Symbol("INITIAL_VALUE");function Rn(){return Z(t=>ai(t.map(e=>e.pipe(Q(1),us(go)))).pipe(M(e=>{for(let n of e)if(n!==!0){if(n===go)return go;if(n===!1||n instanceof mt)return n}return!0}),Y(e=>e!==go),Q(1)))}function Mw(t,e){return B(n=>{let{targetSnapshot:r,currentSnapshot:i,guards:{canActivateChecks:o,canDeactivateChecks:s}}=n;return s.length===0&&o.length===0?D(V(m({},n),{guardsResult:!0})):_w(s,r,i,t).pipe(B(a=>a&&Dw(a)?Sw(r,o,t,e):D(a)),M(a=>V(m({},n),{guardsResult:a})))})}function _w(t,e,n,r){return j(t).pipe(B(i=>Ow(i.component,i.route,n,e,r)),xe(i=>i!==!0,!0))}function Sw(t,e,n,r){return j(e).pipe(nt(i=>Ae(Aw(i.route.parent,r),Tw(i.route,r),Nw(t,i.path,n),xw(t,i.route,n))),xe(i=>i!==!0,!0))}function Tw(t,e){return t!==null&&e&&e(new Nu(t)),D(!0)}function Aw(t,e){return t!==null&&e&&e(new Au(t)),D(!0)}function xw(t,e,n){let r=e.routeConfig?e.routeConfig.canActivate:null;if(!r||r.length===0)return D(!0);let i=r.map(o=>bt(()=>{let s=xr(e)??n,a=Pn(o,s),u=ww(a)?a.canActivate(e,t):Ze(s,()=>a(e,t));return yt(u).pipe(xe())}));return D(i).pipe(Rn())}function Nw(t,e,n){let r=e[e.length-1],o=e.slice(0,e.length-1).reverse().map(s=>mw(s)).filter(s=>s!==null).map(s=>bt(()=>{let a=s.guards.map(u=>{let c=xr(s.node)??n,l=Pn(u,c),d=Ew(l)?l.canActivateChild(r,t):Ze(c,()=>l(r,t));return yt(d).pipe(xe())});return D(a).pipe(Rn())}));return D(o).pipe(Rn())}function Ow(t,e,n,r,i){let o=e&&e.routeConfig?e.routeConfig.canDeactivate:null;if(!o||o.length===0)return D(!0);let s=o.map(a=>{let u=xr(e)??i,c=Pn(a,u),l=bw(c)?c.canDeactivate(t,e,n,r):Ze(u,()=>c(t,e,n,r));return yt(l).pipe(xe())});return D(s).pipe(Rn())}function Rw(t,e,n,r){let i=e.canLoad;if(i===void 0||i.length===0)return D(!0);let o=i.map(s=>{let a=Pn(s,t),u=Cw(a)?a.canLoad(e,n):Ze(t,()=>a(e,n));return yt(u)});return D(o).pipe(Rn(),Oh(r))}function Oh(t){return Go(W(e=>{if(Nn(e))throw Th(t,e)}),M(e=>e===!0))}function Pw(t,e,n,r){let i=e.canMatch;if(!i||i.length===0)return D(!0);let o=i.map(s=>{let a=Pn(s,t),u=Iw(a)?a.canMatch(e,n):Ze(t,()=>a(e,n));return yt(u)});return D(o).pipe(Rn(),Oh(r))}var Tr=class{constructor(e){this.segmentGroup=e||null}},So=class extends Error{constructor(e){super(),this.urlTree=e}};function _n(t){return et(new Tr(t))}function Fw(t){return et(new C(4e3,!1))}function kw(t){return et(Ah(!1,3))}var ju=class{constructor(e,n){this.urlSerializer=e,this.urlTree=n}lineralizeSegments(e,n){let r=[],i=n.root;for(;;){if(r=r.concat(i.segments),i.numberOfChildren===0)return D(r);if(i.numberOfChildren>1||!i.children[x])return Fw(e.redirectTo);i=i.children[x]}}applyRedirectCommands(e,n,r){let i=this.applyRedirectCreateUrlTree(n,this.urlSerializer.parse(n),e,r);if(n.startsWith("/"))throw new So(i);return i}applyRedirectCreateUrlTree(e,n,r,i){let o=this.createSegmentGroup(e,n.root,r,i);return new mt(o,this.createQueryParams(n.queryParams,this.urlTree.queryParams),n.fragment)}createQueryParams(e,n){let r={};return Object.entries(e).forEach(([i,o])=>{if(typeof o=="string"&&o.startsWith(":")){let a=o.substring(1);r[i]=n[a]}else r[i]=o}),r}createSegmentGroup(e,n,r,i){let o=this.createSegments(e,n.segments,r,i),s={};return Object.entries(n.children).forEach(([a,u])=>{s[a]=this.createSegmentGroup(e,u,r,i)}),new k(o,s)}createSegments(e,n,r,i){return n.map(o=>o.path.startsWith(":")?this.findPosParam(e,o,i):this.findOrReturn(o,r))}findPosParam(e,n,r){let i=r[n.path.substring(1)];if(!i)throw new C(4001,!1);return i}findOrReturn(e,n){let r=0;for(let i of n){if(i.path===e.path)return n.splice(r),i;r++}return e}},$u={matched:!1,consumedSegments:[],remainingSegments:[],parameters:{},positionalParamSegments:{}};function Lw(t,e,n,r,i){let o=Yu(t,e,n);return o.matched?(r=fw(e,r),Pw(r,e,n,i).pipe(M(s=>s===!0?o:m({},$u)))):D(o)}function Yu(t,e,n){if(e.path==="**")return Vw(n);if(e.path==="")return e.pathMatch==="full"&&(t.hasChildren()||n.length>0)?m({},$u):{matched:!0,consumedSegments:[],remainingSegments:n,parameters:{},positionalParamSegments:{}};let i=(e.matcher||RC)(n,t,e);if(!i)return m({},$u);let o={};Object.entries(i.posParams??{}).forEach(([a,u])=>{o[a]=u.path});let s=i.consumed.length>0?m(m({},o),i.consumed[i.consumed.length-1].parameters):o;return{matched:!0,consumedSegments:i.consumed,remainingSegments:n.slice(i.consumed.length),parameters:s,positionalParamSegments:i.posParams??{}}}function Vw(t){return{matched:!0,parameters:t.length>0?dh(t).parameters:{},consumedSegments:t,remainingSegments:[],positionalParamSegments:{}}}function ch(t,e,n,r){return n.length>0&&Uw(t,n,r)?{segmentGroup:new k(e,$w(r,new k(n,t.children))),slicedSegments:[]}:n.length===0&&Bw(t,n,r)?{segmentGroup:new k(t.segments,jw(t,e,n,r,t.children)),slicedSegments:n}:{segmentGroup:new k(t.segments,t.children),slicedSegments:n}}function jw(t,e,n,r,i){let o={};for(let s of r)if(Ao(t,n,s)&&!i[je(s)]){let a=new k([],{});o[je(s)]=a}return m(m({},i),o)}function $w(t,e){let n={};n[x]=e;for(let r of t)if(r.path===""&&je(r)!==x){let i=new k([],{});n[je(r)]=i}return n}function Uw(t,e,n){return n.some(r=>Ao(t,e,r)&&je(r)!==x)}function Bw(t,e,n){return n.some(r=>Ao(t,e,r))}function Ao(t,e,n){return(t.hasChildren()||e.length>0)&&n.pathMatch==="full"?!1:n.path===""}function Hw(t,e,n,r){return je(t)!==r&&(r===x||!Ao(e,n,t))?!1:Yu(e,t,n).matched}function zw(t,e,n){return e.length===0&&!t.children[n]}var Uu=class{};function Gw(t,e,n,r,i,o,s="emptyOnly"){return new Bu(t,e,n,r,i,s,o).recognize()}var Ww=31,Bu=class{constructor(e,n,r,i,o,s,a){this.injector=e,this.configLoader=n,this.rootComponentType=r,this.config=i,this.urlTree=o,this.paramsInheritanceStrategy=s,this.urlSerializer=a,this.applyRedirects=new ju(this.urlSerializer,this.urlTree),this.absoluteRedirectCount=0,this.allowRedirects=!0}noMatchError(e){return new C(4002,`'${e.segmentGroup}'`)}recognize(){let e=ch(this.urlTree.root,[],[],this.config).segmentGroup;return this.match(e).pipe(M(n=>{let r=new _r([],Object.freeze({}),Object.freeze(m({},this.urlTree.queryParams)),this.urlTree.fragment,{},x,this.rootComponentType,null,{}),i=new he(r,n),o=new Mo("",i),s=JC(r,[],this.urlTree.queryParams,this.urlTree.fragment);return s.queryParams=this.urlTree.queryParams,o.url=this.urlSerializer.serialize(s),this.inheritParamsAndData(o._root,null),{state:o,tree:s}}))}match(e){return this.processSegmentGroup(this.injector,this.config,e,x).pipe(tt(r=>{if(r instanceof So)return this.urlTree=r.urlTree,this.match(r.urlTree.root);throw r instanceof Tr?this.noMatchError(r):r}))}inheritParamsAndData(e,n){let r=e.value,i=Gu(r,n,this.paramsInheritanceStrategy);r.params=Object.freeze(i.params),r.data=Object.freeze(i.data),e.children.forEach(o=>this.inheritParamsAndData(o,r))}processSegmentGroup(e,n,r,i){return r.segments.length===0&&r.hasChildren()?this.processChildren(e,n,r):this.processSegment(e,n,r,r.segments,i,!0).pipe(M(o=>o instanceof he?[o]:[]))}processChildren(e,n,r){let i=[];for(let o of Object.keys(r.children))o==="primary"?i.unshift(o):i.push(o);return j(i).pipe(nt(o=>{let s=r.children[o],a=hw(n,o);return this.processSegmentGroup(e,a,s,o)}),os((o,s)=>(o.push(...s),o)),rt(null),rs(),B(o=>{if(o===null)return _n(r);let s=Rh(o);return qw(s),D(s)}))}processSegment(e,n,r,i,o,s){return j(n).pipe(nt(a=>this.processSegmentAgainstRoute(a._injector??e,n,a,r,i,o,s).pipe(tt(u=>{if(u instanceof Tr)return D(null);throw u}))),xe(a=>!!a),tt(a=>{if(Nh(a))return zw(r,i,o)?D(new Uu):_n(r);throw a}))}processSegmentAgainstRoute(e,n,r,i,o,s,a){return Hw(r,i,o,s)?r.redirectTo===void 0?this.matchSegmentAgainstRoute(e,i,r,o,s):this.allowRedirects&&a?this.expandSegmentAgainstRouteUsingRedirect(e,i,n,r,o,s):_n(i):_n(i)}expandSegmentAgainstRouteUsingRedirect(e,n,r,i,o,s){let{matched:a,consumedSegments:u,positionalParamSegments:c,remainingSegments:l}=Yu(n,i,o);if(!a)return _n(n);i.redirectTo.startsWith("/")&&(this.absoluteRedirectCount++,this.absoluteRedirectCount>Ww&&(this.allowRedirects=!1));let d=this.applyRedirects.applyRedirectCommands(u,i.redirectTo,c);return this.applyRedirects.lineralizeSegments(i,d).pipe(B(f=>this.processSegment(e,r,n,f.concat(l),s,!1)))}matchSegmentAgainstRoute(e,n,r,i,o){let s=Lw(n,r,i,e,this.urlSerializer);return r.path==="**"&&(n.children={}),s.pipe(Z(a=>a.matched?(e=r._injector??e,this.getChildConfig(e,r,i).pipe(Z(({routes:u})=>{let c=r._loadedInjector??e,{consumedSegments:l,remainingSegments:d,parameters:f}=a,h=new _r(l,f,Object.freeze(m({},this.urlTree.queryParams)),this.urlTree.fragment,Yw(r),je(r),r.component??r._loadedComponent??null,r,Qw(r)),{segmentGroup:g,slicedSegments:_}=ch(n,l,d,u);if(_.length===0&&g.hasChildren())return this.processChildren(c,u,g).pipe(M(v=>v===null?null:new he(h,v)));if(u.length===0&&_.length===0)return D(new he(h,[]));let b=je(r)===o;return this.processSegment(c,u,g,_,b?x:o,!0).pipe(M(v=>new he(h,v instanceof he?[v]:[])))}))):_n(n)))}getChildConfig(e,n,r){return n.children?D({routes:n.children,injector:e}):n.loadChildren?n._loadedRoutes!==void 0?D({routes:n._loadedRoutes,injector:n._loadedInjector}):Rw(e,n,r,this.urlSerializer).pipe(B(i=>i?this.configLoader.loadChildren(e,n).pipe(W(o=>{n._loadedRoutes=o.routes,n._loadedInjector=o.injector})):kw(n))):D({routes:[],injector:e})}};function qw(t){t.sort((e,n)=>e.value.outlet===x?-1:n.value.outlet===x?1:e.value.outlet.localeCompare(n.value.outlet))}function Zw(t){let e=t.value.routeConfig;return e&&e.path===""}function Rh(t){let e=[],n=new Set;for(let r of t){if(!Zw(r)){e.push(r);continue}let i=e.find(o=>r.value.routeConfig===o.value.routeConfig);i!==void 0?(i.children.push(...r.children),n.add(i)):e.push(r)}for(let r of n){let i=Rh(r.children);e.push(new he(r.value,i))}return e.filter(r=>!n.has(r))}function Yw(t){return t.data||{}}function Qw(t){return t.resolve||{}}function Kw(t,e,n,r,i,o){return B(s=>Gw(t,e,n,r,s.extractedUrl,i,o).pipe(M(({state:a,tree:u})=>V(m({},s),{targetSnapshot:a,urlAfterRedirects:u}))))}function Jw(t,e){return B(n=>{let{targetSnapshot:r,guards:{canActivateChecks:i}}=n;if(!i.length)return D(n);let o=new Set(i.map(u=>u.route)),s=new Set;for(let u of o)if(!s.has(u))for(let c of Ph(u))s.add(c);let a=0;return j(s).pipe(nt(u=>o.has(u)?Xw(u,r,t,e):(u.data=Gu(u,u.parent,t).resolve,D(void 0))),W(()=>a++),on(1),B(u=>a===s.size?D(n):ue))})}function Ph(t){let e=t.children.map(n=>Ph(n)).flat();return[t,...e]}function Xw(t,e,n,r){let i=t.routeConfig,o=t._resolve;return i?.title!==void 0&&!_h(i)&&(o[Ar]=i.title),eE(o,t,e,r).pipe(M(s=>(t._resolvedData=s,t.data=Gu(t,t.parent,n).resolve,null)))}function eE(t,e,n,r){let i=Du(t);if(i.length===0)return D({});let o={};return j(i).pipe(B(s=>tE(t[s],e,n,r).pipe(xe(),W(a=>{o[s]=a}))),on(1),jn(o),tt(s=>Nh(s)?ue:et(s)))}function tE(t,e,n,r){let i=xr(e)??r,o=Pn(t,i),s=o.resolve?o.resolve(e,n):Ze(i,()=>o(e,n));return yt(s)}function vu(t){return Z(e=>{let n=t(e);return n?j(n).pipe(M(()=>e)):D(e)})}var Fh=(()=>{let e=class e{buildTitle(r){let i,o=r.root;for(;o!==void 0;)i=this.getResolvedTitleForRoute(o)??i,o=o.children.find(s=>s.outlet===x);return i}getResolvedTitleForRoute(r){return r.data[Ar]}};e.\u0275fac=function(i){return new(i||e)},e.\u0275prov=w({token:e,factory:()=>(()=>p(nE))(),providedIn:"root"});let t=e;return t})(),nE=(()=>{let e=class e extends Fh{constructor(r){super(),this.title=r}updateTitle(r){let i=this.buildTitle(r);i!==void 0&&this.title.setTitle(i)}};e.\u0275fac=function(i){return new(i||e)(I(hu))},e.\u0275prov=w({token:e,factory:e.\u0275fac,providedIn:"root"});let t=e;return t})(),Qu=new E("",{providedIn:"root",factory:()=>({})}),Ku=new E("ROUTES"),rE=(()=>{let e=class e{constructor(){this.componentLoaders=new WeakMap,this.childrenLoaders=new WeakMap,this.compiler=p(qa)}loadComponent(r){if(this.componentLoaders.get(r))return this.componentLoaders.get(r);if(r._loadedComponent)return D(r._loadedComponent);this.onLoadStartListener&&this.onLoadStartListener(r);let i=yt(r.loadComponent()).pipe(M(kh),W(s=>{this.onLoadEndListener&&this.onLoadEndListener(r),r._loadedComponent=s}),Mt(()=>{this.componentLoaders.delete(r)})),o=new Xe(i,()=>new G).pipe(Jt());return this.componentLoaders.set(r,o),o}loadChildren(r,i){if(this.childrenLoaders.get(i))return this.childrenLoaders.get(i);if(i._loadedRoutes)return D({routes:i._loadedRoutes,injector:i._loadedInjector});this.onLoadStartListener&&this.onLoadStartListener(i);let s=iE(i,this.compiler,r,this.onLoadEndListener).pipe(Mt(()=>{this.childrenLoaders.delete(i)})),a=new Xe(s,()=>new G).pipe(Jt());return this.childrenLoaders.set(i,a),a}};e.\u0275fac=function(i){return new(i||e)},e.\u0275prov=w({token:e,factory:e.\u0275fac,providedIn:"root"});let t=e;return t})();function iE(t,e,n,r){return yt(t.loadChildren()).pipe(M(kh),B(i=>i instanceof er||Array.isArray(i)?D(i):j(e.compileModuleAsync(i))),M(i=>{r&&r(t);let o,s,a=!1;return Array.isArray(i)?(s=i,a=!0):(o=i.create(n).injector,s=o.get(Ku,[],{optional:!0,self:!0}).flat()),{routes:s.map(Zu),injector:o}}))}function oE(t){return t&&typeof t=="object"&&"default"in t}function kh(t){return oE(t)?t.default:t}var Ju=(()=>{let e=class e{};e.\u0275fac=function(i){return new(i||e)},e.\u0275prov=w({token:e,factory:()=>(()=>p(sE))(),providedIn:"root"});let t=e;return t})(),sE=(()=>{let e=class e{shouldProcessUrl(r){return!0}extract(r){return r}merge(r,i){return r}};e.\u0275fac=function(i){return new(i||e)},e.\u0275prov=w({token:e,factory:e.\u0275fac,providedIn:"root"});let t=e;return t})(),aE=new E("");var uE=(()=>{let e=class e{get hasRequestedNavigation(){return this.navigationId!==0}constructor(){this.currentNavigation=null,this.currentTransition=null,this.lastSuccessfulNavigation=null,this.events=new G,this.transitionAbortSubject=new G,this.configLoader=p(rE),this.environmentInjector=p(le),this.urlSerializer=p(zu),this.rootContexts=p(To),this.location=p(ur),this.inputBindingEnabled=p(qu,{optional:!0})!==null,this.titleStrategy=p(Fh),this.options=p(Qu,{optional:!0})||{},this.paramsInheritanceStrategy=this.options.paramsInheritanceStrategy||"emptyOnly",this.urlHandlingStrategy=p(Ju),this.createViewTransition=p(aE,{optional:!0}),this.navigationId=0,this.afterPreactivation=()=>D(void 0),this.rootComponentType=null;let r=o=>this.events.next(new Su(o)),i=o=>this.events.next(new Tu(o));this.configLoader.onLoadEndListener=i,this.configLoader.onLoadStartListener=r}complete(){this.transitions?.complete()}handleNavigationRequest(r){let i=++this.navigationId;this.transitions?.next(V(m(m({},this.transitions.value),r),{id:i}))}setupNavigations(r,i,o){return this.transitions=new ee({id:0,currentUrlTree:i,currentRawUrl:i,extractedUrl:this.urlHandlingStrategy.extract(i),urlAfterRedirects:this.urlHandlingStrategy.extract(i),rawUrl:i,extras:{},resolve:null,reject:null,promise:Promise.resolve(!0),source:Dr,restoredState:null,currentSnapshot:o.snapshot,targetSnapshot:null,currentRouterState:o,targetRouterState:null,guards:{canActivateChecks:[],canDeactivateChecks:[]},guardsResult:null}),this.transitions.pipe(Y(s=>s.id!==0),M(s=>V(m({},s),{extractedUrl:this.urlHandlingStrategy.extract(s.rawUrl)})),Z(s=>{this.currentTransition=s;let a=!1,u=!1;return D(s).pipe(W(c=>{this.currentNavigation={id:c.id,initialUrl:c.rawUrl,extractedUrl:c.extractedUrl,trigger:c.source,extras:c.extras,previousNavigation:this.lastSuccessfulNavigation?V(m({},this.lastSuccessfulNavigation),{previousNavigation:null}):null}}),Z(c=>{let l=!r.navigated||this.isUpdatingInternalState()||this.isUpdatedBrowserUrl(),d=c.extras.onSameUrlNavigation??r.onSameUrlNavigation;if(!l&&d!=="reload"){let f="";return this.events.next(new Wt(c.id,this.urlSerializer.serialize(c.rawUrl),f,0)),c.resolve(null),ue}if(this.urlHandlingStrategy.shouldProcessUrl(c.rawUrl))return D(c).pipe(Z(f=>{let h=this.transitions?.getValue();return this.events.next(new Er(f.id,this.urlSerializer.serialize(f.extractedUrl),f.source,f.restoredState)),h!==this.transitions?.getValue()?ue:Promise.resolve(f)}),Kw(this.environmentInjector,this.configLoader,this.rootComponentType,r.config,this.urlSerializer,this.paramsInheritanceStrategy),W(f=>{s.targetSnapshot=f.targetSnapshot,s.urlAfterRedirects=f.urlAfterRedirects,this.currentNavigation=V(m({},this.currentNavigation),{finalUrl:f.urlAfterRedirects});let h=new Eo(f.id,this.urlSerializer.serialize(f.extractedUrl),this.urlSerializer.serialize(f.urlAfterRedirects),f.targetSnapshot);this.events.next(h)}));if(l&&this.urlHandlingStrategy.shouldProcessUrl(c.currentRawUrl)){let{id:f,extractedUrl:h,source:g,restoredState:_,extras:b}=c,v=new Er(f,this.urlSerializer.serialize(h),g,_);this.events.next(v);let z=Ih(h,this.rootComponentType).snapshot;return this.currentTransition=s=V(m({},c),{targetSnapshot:z,urlAfterRedirects:h,extras:V(m({},b),{skipLocationChange:!1,replaceUrl:!1})}),this.currentNavigation.finalUrl=h,D(s)}else{let f="";return this.events.next(new Wt(c.id,this.urlSerializer.serialize(c.extractedUrl),f,1)),c.resolve(null),ue}}),W(c=>{let l=new bu(c.id,this.urlSerializer.serialize(c.extractedUrl),this.urlSerializer.serialize(c.urlAfterRedirects),c.targetSnapshot);this.events.next(l)}),M(c=>(this.currentTransition=s=V(m({},c),{guards:gw(c.targetSnapshot,c.currentSnapshot,this.rootContexts)}),s)),Mw(this.environmentInjector,c=>this.events.next(c)),W(c=>{if(s.guardsResult=c.guardsResult,Nn(c.guardsResult))throw Th(this.urlSerializer,c.guardsResult);let l=new Iu(c.id,this.urlSerializer.serialize(c.extractedUrl),this.urlSerializer.serialize(c.urlAfterRedirects),c.targetSnapshot,!!c.guardsResult);this.events.next(l)}),Y(c=>c.guardsResult?!0:(this.cancelNavigationTransition(c,"",3),!1)),vu(c=>{if(c.guards.canActivateChecks.length)return D(c).pipe(W(l=>{let d=new Mu(l.id,this.urlSerializer.serialize(l.extractedUrl),this.urlSerializer.serialize(l.urlAfterRedirects),l.targetSnapshot);this.events.next(d)}),Z(l=>{let d=!1;return D(l).pipe(Jw(this.paramsInheritanceStrategy,this.environmentInjector),W({next:()=>d=!0,complete:()=>{d||this.cancelNavigationTransition(l,"",2)}}))}),W(l=>{let d=new _u(l.id,this.urlSerializer.serialize(l.extractedUrl),this.urlSerializer.serialize(l.urlAfterRedirects),l.targetSnapshot);this.events.next(d)}))}),vu(c=>{let l=d=>{let f=[];d.routeConfig?.loadComponent&&!d.routeConfig._loadedComponent&&f.push(this.configLoader.loadComponent(d.routeConfig).pipe(W(h=>{d.component=h}),M(()=>{})));for(let h of d.children)f.push(...l(h));return f};return ai(l(c.targetSnapshot.root)).pipe(rt(),Q(1))}),vu(()=>this.afterPreactivation()),Z(()=>{let{currentSnapshot:c,targetSnapshot:l}=s,d=this.createViewTransition?.(this.environmentInjector,c.root,l.root);return d?j(d).pipe(M(()=>s)):D(s)}),M(c=>{let l=aw(r.routeReuseStrategy,c.targetSnapshot,c.currentRouterState);return this.currentTransition=s=V(m({},c),{targetRouterState:l}),this.currentNavigation.targetRouterState=l,s}),W(()=>{this.events.next(new Ir)}),pw(this.rootContexts,r.routeReuseStrategy,c=>this.events.next(c),this.inputBindingEnabled),Q(1),W({next:c=>{a=!0,this.lastSuccessfulNavigation=this.currentNavigation,this.events.next(new Gt(c.id,this.urlSerializer.serialize(c.extractedUrl),this.urlSerializer.serialize(c.urlAfterRedirects))),this.titleStrategy?.updateTitle(c.targetRouterState.snapshot),c.resolve(!0)},complete:()=>{a=!0}}),cs(this.transitionAbortSubject.pipe(W(c=>{throw c}))),Mt(()=>{if(!a&&!u){let c="";this.cancelNavigationTransition(s,c,1)}this.currentNavigation?.id===s.id&&(this.currentNavigation=null)}),tt(c=>{if(u=!0,xh(c))this.events.next(new vt(s.id,this.urlSerializer.serialize(s.extractedUrl),c.message,c.cancellationCode)),lw(c)?this.events.next(new Mr(c.url)):s.resolve(!1);else{this.events.next(new br(s.id,this.urlSerializer.serialize(s.extractedUrl),c,s.targetSnapshot??void 0));try{s.resolve(r.errorHandler(c))}catch(l){s.reject(l)}}return ue}))}))}cancelNavigationTransition(r,i,o){let s=new vt(r.id,this.urlSerializer.serialize(r.extractedUrl),i,o);this.events.next(s),r.resolve(!1)}isUpdatingInternalState(){return this.currentTransition?.extractedUrl.toString()!==this.currentTransition?.currentUrlTree.toString()}isUpdatedBrowserUrl(){return this.urlHandlingStrategy.extract(this.urlSerializer.parse(this.location.path(!0))).toString()!==this.currentTransition?.extractedUrl.toString()&&!this.currentTransition?.extras.skipLocationChange}};e.\u0275fac=function(i){return new(i||e)},e.\u0275prov=w({token:e,factory:e.\u0275fac,providedIn:"root"});let t=e;return t})();function cE(t){return t!==Dr}var lE=(()=>{let e=class e{};e.\u0275fac=function(i){return new(i||e)},e.\u0275prov=w({token:e,factory:()=>(()=>p(dE))(),providedIn:"root"});let t=e;return t})(),Hu=class{shouldDetach(e){return!1}store(e,n){}shouldAttach(e){return!1}retrieve(e){return null}shouldReuseRoute(e,n){return e.routeConfig===n.routeConfig}},dE=(()=>{let e=class e extends Hu{};e.\u0275fac=(()=>{let r;return function(o){return(r||(r=wn(e)))(o||e)}})(),e.\u0275prov=w({token:e,factory:e.\u0275fac,providedIn:"root"});let t=e;return t})(),Lh=(()=>{let e=class e{};e.\u0275fac=function(i){return new(i||e)},e.\u0275prov=w({token:e,factory:()=>(()=>p(fE))(),providedIn:"root"});let t=e;return t})(),fE=(()=>{let e=class e extends Lh{constructor(){super(...arguments),this.location=p(ur),this.urlSerializer=p(zu),this.options=p(Qu,{optional:!0})||{},this.canceledNavigationResolution=this.options.canceledNavigationResolution||"replace",this.urlHandlingStrategy=p(Ju),this.urlUpdateStrategy=this.options.urlUpdateStrategy||"deferred",this.currentUrlTree=new mt,this.rawUrlTree=this.currentUrlTree,this.currentPageId=0,this.lastSuccessfulId=-1,this.routerState=Ih(this.currentUrlTree,null),this.stateMemento=this.createStateMemento()}getCurrentUrlTree(){return this.currentUrlTree}getRawUrlTree(){return this.rawUrlTree}restoredState(){return this.location.getState()}get browserPageId(){return this.canceledNavigationResolution!=="computed"?this.currentPageId:this.restoredState()?.\u0275routerPageId??this.currentPageId}getRouterState(){return this.routerState}createStateMemento(){return{rawUrlTree:this.rawUrlTree,currentUrlTree:this.currentUrlTree,routerState:this.routerState}}registerNonRouterCurrentEntryChangeListener(r){return this.location.subscribe(i=>{i.type==="popstate"&&r(i.url,i.state)})}handleRouterEvent(r,i){if(r instanceof Er)this.stateMemento=this.createStateMemento();else if(r instanceof Wt)this.rawUrlTree=i.initialUrl;else if(r instanceof Eo){if(this.urlUpdateStrategy==="eager"&&!i.extras.skipLocationChange){let o=this.urlHandlingStrategy.merge(i.finalUrl,i.initialUrl);this.setBrowserUrl(o,i)}}else r instanceof Ir?(this.currentUrlTree=i.finalUrl,this.rawUrlTree=this.urlHandlingStrategy.merge(i.finalUrl,i.initialUrl),this.routerState=i.targetRouterState,this.urlUpdateStrategy==="deferred"&&(i.extras.skipLocationChange||this.setBrowserUrl(this.rawUrlTree,i))):r instanceof vt&&(r.code===3||r.code===2)?this.restoreHistory(i):r instanceof br?this.restoreHistory(i,!0):r instanceof Gt&&(this.lastSuccessfulId=r.id,this.currentPageId=this.browserPageId)}setBrowserUrl(r,i){let o=this.urlSerializer.serialize(r);if(this.location.isCurrentPathEqualTo(o)||i.extras.replaceUrl){let s=this.browserPageId,a=m(m({},i.extras.state),this.generateNgRouterState(i.id,s));this.location.replaceState(o,"",a)}else{let s=m(m({},i.extras.state),this.generateNgRouterState(i.id,this.browserPageId+1));this.location.go(o,"",s)}}restoreHistory(r,i=!1){if(this.canceledNavigationResolution==="computed"){let o=this.browserPageId,s=this.currentPageId-o;s!==0?this.location.historyGo(s):this.currentUrlTree===r.finalUrl&&s===0&&(this.resetState(r),this.resetUrlToCurrentUrlTree())}else this.canceledNavigationResolution==="replace"&&(i&&this.resetState(r),this.resetUrlToCurrentUrlTree())}resetState(r){this.routerState=this.stateMemento.routerState,this.currentUrlTree=this.stateMemento.currentUrlTree,this.rawUrlTree=this.urlHandlingStrategy.merge(this.currentUrlTree,r.finalUrl??this.rawUrlTree)}resetUrlToCurrentUrlTree(){this.location.replaceState(this.urlSerializer.serialize(this.rawUrlTree),"",this.generateNgRouterState(this.lastSuccessfulId,this.currentPageId))}generateNgRouterState(r,i){return this.canceledNavigationResolution==="computed"?{navigationId:r,\u0275routerPageId:i}:{navigationId:r}}};e.\u0275fac=(()=>{let r;return function(o){return(r||(r=wn(e)))(o||e)}})(),e.\u0275prov=w({token:e,factory:e.\u0275fac,providedIn:"root"});let t=e;return t})(),vr=function(t){return t[t.COMPLETE=0]="COMPLETE",t[t.FAILED=1]="FAILED",t[t.REDIRECTING=2]="REDIRECTING",t}(vr||{});function hE(t,e){t.events.pipe(Y(n=>n instanceof Gt||n instanceof vt||n instanceof br||n instanceof Wt),M(n=>n instanceof Gt||n instanceof Wt?vr.COMPLETE:(n instanceof vt?n.code===0||n.code===1:!1)?vr.REDIRECTING:vr.FAILED),Y(n=>n!==vr.REDIRECTING),Q(1)).subscribe(()=>{e()})}function pE(t){throw t}var gE={paths:"exact",fragment:"ignored",matrixParams:"ignored",queryParams:"exact"},mE={paths:"subset",fragment:"ignored",matrixParams:"ignored",queryParams:"subset"},Vh=(()=>{let e=class e{get currentUrlTree(){return this.stateManager.getCurrentUrlTree()}get rawUrlTree(){return this.stateManager.getRawUrlTree()}get events(){return this._events}get routerState(){return this.stateManager.getRouterState()}constructor(){this.disposed=!1,this.isNgZoneEnabled=!1,this.console=p(Xi),this.stateManager=p(Lh),this.options=p(Qu,{optional:!0})||{},this.pendingTasks=p(ar),this.urlUpdateStrategy=this.options.urlUpdateStrategy||"deferred",this.navigationTransitions=p(uE),this.urlSerializer=p(zu),this.location=p(ur),this.urlHandlingStrategy=p(Ju),this._events=new G,this.errorHandler=this.options.errorHandler||pE,this.navigated=!1,this.routeReuseStrategy=p(lE),this.onSameUrlNavigation=this.options.onSameUrlNavigation||"ignore",this.config=p(Ku,{optional:!0})?.flat()??[],this.componentInputBindingEnabled=!!p(qu,{optional:!0}),this.eventsSubscription=new q,this.isNgZoneEnabled=p(H)instanceof H&&H.isInAngularZone(),this.resetConfig(this.config),this.navigationTransitions.setupNavigations(this,this.currentUrlTree,this.routerState).subscribe({error:r=>{this.console.warn(r)}}),this.subscribeToNavigationEvents()}subscribeToNavigationEvents(){let r=this.navigationTransitions.events.subscribe(i=>{try{let o=this.navigationTransitions.currentTransition,s=this.navigationTransitions.currentNavigation;if(o!==null&&s!==null){if(this.stateManager.handleRouterEvent(i,s),i instanceof vt&&i.code!==0&&i.code!==1)this.navigated=!0;else if(i instanceof Gt)this.navigated=!0;else if(i instanceof Mr){let a=this.urlHandlingStrategy.merge(i.url,o.currentRawUrl),u={skipLocationChange:o.extras.skipLocationChange,replaceUrl:this.urlUpdateStrategy==="eager"||cE(o.source)};this.scheduleNavigation(a,Dr,null,u,{resolve:o.resolve,reject:o.reject,promise:o.promise})}}yE(i)&&this._events.next(i)}catch(o){this.navigationTransitions.transitionAbortSubject.next(o)}});this.eventsSubscription.add(r)}resetRootComponentType(r){this.routerState.root.component=r,this.navigationTransitions.rootComponentType=r}initialNavigation(){this.setUpLocationChangeListener(),this.navigationTransitions.hasRequestedNavigation||this.navigateToSyncWithBrowser(this.location.path(!0),Dr,this.stateManager.restoredState())}setUpLocationChangeListener(){this.nonRouterCurrentEntryChangeSubscription||(this.nonRouterCurrentEntryChangeSubscription=this.stateManager.registerNonRouterCurrentEntryChangeListener((r,i)=>{setTimeout(()=>{this.navigateToSyncWithBrowser(r,"popstate",i)},0)}))}navigateToSyncWithBrowser(r,i,o){let s={replaceUrl:!0},a=o?.navigationId?o:null;if(o){let c=m({},o);delete c.navigationId,delete c.\u0275routerPageId,Object.keys(c).length!==0&&(s.state=c)}let u=this.parseUrl(r);this.scheduleNavigation(u,i,a,s)}get url(){return this.serializeUrl(this.currentUrlTree)}getCurrentNavigation(){return this.navigationTransitions.currentNavigation}get lastSuccessfulNavigation(){return this.navigationTransitions.lastSuccessfulNavigation}resetConfig(r){this.config=r.map(Zu),this.navigated=!1}ngOnDestroy(){this.dispose()}dispose(){this.navigationTransitions.complete(),this.nonRouterCurrentEntryChangeSubscription&&(this.nonRouterCurrentEntryChangeSubscription.unsubscribe(),this.nonRouterCurrentEntryChangeSubscription=void 0),this.disposed=!0,this.eventsSubscription.unsubscribe()}createUrlTree(r,i={}){let{relativeTo:o,queryParams:s,fragment:a,queryParamsHandling:u,preserveFragment:c}=i,l=c?this.currentUrlTree.fragment:a,d=null;switch(u){case"merge":d=m(m({},this.currentUrlTree.queryParams),s);break;case"preserve":d=this.currentUrlTree.queryParams;break;default:d=s||null}d!==null&&(d=this.removeEmptyProps(d));let f;try{let h=o?o.snapshot:this.routerState.snapshot.root;f=Ch(h)}catch{(typeof r[0]!="string"||!r[0].startsWith("/"))&&(r=[]),f=this.currentUrlTree.root}return wh(f,r,d,l??null)}navigateByUrl(r,i={skipLocationChange:!1}){let o=Nn(r)?r:this.parseUrl(r),s=this.urlHandlingStrategy.merge(o,this.rawUrlTree);return this.scheduleNavigation(s,Dr,null,i)}navigate(r,i={skipLocationChange:!1}){return vE(r),this.navigateByUrl(this.createUrlTree(r,i),i)}serializeUrl(r){return this.urlSerializer.serialize(r)}parseUrl(r){try{return this.urlSerializer.parse(r)}catch{return this.urlSerializer.parse("/")}}isActive(r,i){let o;if(i===!0?o=m({},gE):i===!1?o=m({},mE):o=i,Nn(r))return oh(this.currentUrlTree,r,o);let s=this.parseUrl(r);return oh(this.currentUrlTree,s,o)}removeEmptyProps(r){return Object.keys(r).reduce((i,o)=>{let s=r[o];return s!=null&&(i[o]=s),i},{})}scheduleNavigation(r,i,o,s,a){if(this.disposed)return Promise.resolve(!1);let u,c,l;a?(u=a.resolve,c=a.reject,l=a.promise):l=new Promise((f,h)=>{u=f,c=h});let d=this.pendingTasks.add();return hE(this,()=>{queueMicrotask(()=>this.pendingTasks.remove(d))}),this.navigationTransitions.handleNavigationRequest({source:i,restoredState:o,currentUrlTree:this.currentUrlTree,currentRawUrl:this.currentUrlTree,rawUrl:r,extras:s,resolve:u,reject:c,promise:l,currentSnapshot:this.routerState.snapshot,currentRouterState:this.routerState}),l.catch(f=>Promise.reject(f))}};e.\u0275fac=function(i){return new(i||e)},e.\u0275prov=w({token:e,factory:e.\u0275fac,providedIn:"root"});let t=e;return t})();function vE(t){for(let e=0;e<t.length;e++)if(t[e]==null)throw new C(4008,!1)}function yE(t){return!(t instanceof Ir)&&!(t instanceof Mr)}var DE=new E("");function jh(t,...e){return ct([{provide:Ku,multi:!0,useValue:t},[],{provide:On,useFactory:CE,deps:[Vh]},{provide:to,multi:!0,useFactory:wE},e.map(n=>n.\u0275providers)])}function CE(t){return t.routerState.root}function wE(){let t=p(Ye);return e=>{let n=t.get(pt);if(e!==n.components[0])return;let r=t.get(Vh),i=t.get(EE);t.get(bE)===1&&r.initialNavigation(),t.get(IE,null,O.Optional)?.setUpPreloading(),t.get(DE,null,O.Optional)?.init(),r.resetRootComponentType(n.componentTypes[0]),i.closed||(i.next(),i.complete(),i.unsubscribe())}}var EE=new E("",{factory:()=>new G}),bE=new E("",{providedIn:"root",factory:()=>1});var IE=new E("");var $h=[];var Rr="Service workers are disabled or not supported by this browser";function ME(t){return bt(()=>et(new Error(t)))}var Fn=class{constructor(e){if(this.serviceWorker=e,!e)this.worker=this.events=this.registration=ME(Rr);else{let r=nn(e,"controllerchange").pipe(M(()=>e.controller)),i=bt(()=>D(e.controller)),o=Ae(i,r);this.worker=o.pipe(Y(l=>!!l)),this.registration=this.worker.pipe(Z(()=>e.getRegistration()));let c=nn(e,"message").pipe(M(l=>l.data)).pipe(Y(l=>l&&l.type)).pipe(is());c.connect(),this.events=c}}postMessage(e,n){return this.worker.pipe(Q(1),W(r=>{r.postMessage(m({action:e},n))})).toPromise().then(()=>{})}postMessageWithOperation(e,n,r){let i=this.waitForOperationCompleted(r),o=this.postMessage(e,n);return Promise.all([o,i]).then(([,s])=>s)}generateNonce(){return Math.round(Math.random()*1e7)}eventsOfType(e){let n;return typeof e=="string"?n=r=>r.type===e:n=r=>e.includes(r.type),this.events.pipe(Y(n))}nextEventOfType(e){return this.eventsOfType(e).pipe(Q(1))}waitForOperationCompleted(e){return this.eventsOfType("OPERATION_COMPLETED").pipe(Y(n=>n.nonce===e),Q(1),M(n=>{if(n.result!==void 0)return n.result;throw new Error(n.error)})).toPromise()}get isEnabled(){return!!this.serviceWorker}},_E=(()=>{let e=class e{get isEnabled(){return this.sw.isEnabled}constructor(r){if(this.sw=r,this.pushManager=null,this.subscriptionChanges=new G,!r.isEnabled){this.messages=It,this.notificationClicks=It,this.subscription=It;return}this.messages=this.sw.eventsOfType("PUSH").pipe(M(o=>o.data)),this.notificationClicks=this.sw.eventsOfType("NOTIFICATION_CLICK").pipe(M(o=>o.data)),this.pushManager=this.sw.registration.pipe(M(o=>o.pushManager));let i=this.pushManager.pipe(Z(o=>o.getSubscription()));this.subscription=rn(i,this.subscriptionChanges)}requestSubscription(r){if(!this.sw.isEnabled||this.pushManager===null)return Promise.reject(new Error(Rr));let i={userVisibleOnly:!0},o=this.decodeBase64(r.serverPublicKey.replace(/_/g,"/").replace(/-/g,"+")),s=new Uint8Array(new ArrayBuffer(o.length));for(let a=0;a<o.length;a++)s[a]=o.charCodeAt(a);return i.applicationServerKey=s,this.pushManager.pipe(Z(a=>a.subscribe(i)),Q(1)).toPromise().then(a=>(this.subscriptionChanges.next(a),a))}unsubscribe(){if(!this.sw.isEnabled)return Promise.reject(new Error(Rr));let r=i=>{if(i===null)throw new Error("Not subscribed to push notifications.");return i.unsubscribe().then(o=>{if(!o)throw new Error("Unsubscribe failed!");this.subscriptionChanges.next(null)})};return this.subscription.pipe(Q(1),Z(r)).toPromise()}decodeBase64(r){return atob(r)}};e.\u0275fac=function(i){return new(i||e)(I(Fn))},e.\u0275prov=w({token:e,factory:e.\u0275fac});let t=e;return t})(),SE=(()=>{let e=class e{get isEnabled(){return this.sw.isEnabled}constructor(r){if(this.sw=r,!r.isEnabled){this.versionUpdates=It,this.unrecoverable=It;return}this.versionUpdates=this.sw.eventsOfType(["VERSION_DETECTED","VERSION_INSTALLATION_FAILED","VERSION_READY","NO_NEW_VERSION_DETECTED"]),this.unrecoverable=this.sw.eventsOfType("UNRECOVERABLE_STATE")}checkForUpdate(){if(!this.sw.isEnabled)return Promise.reject(new Error(Rr));let r=this.sw.generateNonce();return this.sw.postMessageWithOperation("CHECK_FOR_UPDATES",{nonce:r},r)}activateUpdate(){if(!this.sw.isEnabled)return Promise.reject(new Error(Rr));let r=this.sw.generateNonce();return this.sw.postMessageWithOperation("ACTIVATE_UPDATE",{nonce:r},r)}};e.\u0275fac=function(i){return new(i||e)(I(Fn))},e.\u0275prov=w({token:e,factory:e.\u0275fac});let t=e;return t})();var Uh=new E("NGSW_REGISTER_SCRIPT");function TE(t,e,n,r){return()=>{if(!(Xa(r)&&"serviceWorker"in navigator&&n.enabled!==!1))return;navigator.serviceWorker.addEventListener("controllerchange",()=>{navigator.serviceWorker.controller!==null&&navigator.serviceWorker.controller.postMessage({action:"INITIALIZE"})});let i;if(typeof n.registrationStrategy=="function")i=n.registrationStrategy();else{let[s,...a]=(n.registrationStrategy||"registerWhenStable:30000").split(":");switch(s){case"registerImmediately":i=D(null);break;case"registerWithDelay":i=Bh(+a[0]||0);break;case"registerWhenStable":i=a[0]?rn(Hh(t),Bh(+a[0])):Hh(t);break;default:throw new Error(`Unknown ServiceWorker registration strategy: ${n.registrationStrategy}`)}}t.get(H).runOutsideAngular(()=>i.pipe(Q(1)).subscribe(()=>navigator.serviceWorker.register(e,{scope:n.scope}).catch(s=>console.error("Service worker registration failed with:",s))))}}function Bh(t){return D(null).pipe(ts(t))}function Hh(t){return t.get(pt).isStable.pipe(Y(n=>n))}function AE(t,e){return new Fn(Xa(e)&&t.enabled!==!1?navigator.serviceWorker:void 0)}var Or=class{};function zh(t,e={}){return ct([_E,SE,{provide:Uh,useValue:t},{provide:Or,useValue:e},{provide:Fn,useFactory:AE,deps:[Or,_e]},{provide:eo,useFactory:TE,deps:[Ye,Uh,Or,_e],multi:!0}])}var Gh={providers:[jh($h),Qf(),zh("ngsw-worker.js",{enabled:!Nf(),registrationStrategy:"registerWhenStable:30000"})]};var Xh=(()=>{let e=class e{constructor(r,i){this._renderer=r,this._elementRef=i,this.onChange=o=>{},this.onTouched=()=>{}}setProperty(r,i){this._renderer.setProperty(this._elementRef.nativeElement,r,i)}registerOnTouched(r){this.onTouched=r}registerOnChange(r){this.onChange=r}setDisabledState(r){this.setProperty("disabled",r)}};e.\u0275fac=function(i){return new(i||e)(U(kt),U(lt))},e.\u0275dir=Ee({type:e});let t=e;return t})(),ep=(()=>{let e=class e extends Xh{};e.\u0275fac=(()=>{let r;return function(o){return(r||(r=wn(e)))(o||e)}})(),e.\u0275dir=Ee({type:e,features:[Vt]});let t=e;return t})(),rc=new E("NgValueAccessor");var xE={provide:rc,useExisting:Dn(()=>Ro),multi:!0};function NE(){let t=Ke()?Ke().getUserAgent():"";return/android (\d+)/.test(t.toLowerCase())}var OE=new E("CompositionEventMode"),Ro=(()=>{let e=class e extends Xh{constructor(r,i,o){super(r,i),this._compositionMode=o,this._composing=!1,this._compositionMode==null&&(this._compositionMode=!NE())}writeValue(r){let i=r??"";this.setProperty("value",i)}_handleInput(r){(!this._compositionMode||this._compositionMode&&!this._composing)&&this.onChange(r)}_compositionStart(){this._composing=!0}_compositionEnd(r){this._composing=!1,this._compositionMode&&this.onChange(r)}};e.\u0275fac=function(i){return new(i||e)(U(kt),U(lt),U(OE,8))},e.\u0275dir=Ee({type:e,selectors:[["input","formControlName","",3,"type","checkbox"],["textarea","formControlName",""],["input","formControl","",3,"type","checkbox"],["textarea","formControl",""],["input","ngModel","",3,"type","checkbox"],["textarea","ngModel",""],["","ngDefaultControl",""]],hostBindings:function(i,o){i&1&&ht("input",function(a){return o._handleInput(a.target.value)})("blur",function(){return o.onTouched()})("compositionstart",function(){return o._compositionStart()})("compositionend",function(a){return o._compositionEnd(a.target.value)})},features:[Ki([xE]),Vt]});let t=e;return t})();var RE=new E("NgValidators"),PE=new E("NgAsyncValidators");function tp(t){return t!=null}function np(t){return jt(t)?j(t):t}function rp(t){let e={};return t.forEach(n=>{e=n!=null?m(m({},e),n):e}),Object.keys(e).length===0?null:e}function ip(t,e){return e.map(n=>n(t))}function FE(t){return!t.validate}function op(t){return t.map(e=>FE(e)?e:n=>e.validate(n))}function kE(t){if(!t)return null;let e=t.filter(tp);return e.length==0?null:function(n){return rp(ip(n,e))}}function sp(t){return t!=null?kE(op(t)):null}function LE(t){if(!t)return null;let e=t.filter(tp);return e.length==0?null:function(n){let r=ip(n,e).map(np);return Xo(r).pipe(M(rp))}}function ap(t){return t!=null?LE(op(t)):null}function Wh(t,e){return t===null?[e]:Array.isArray(t)?[...t,e]:[t,e]}function VE(t){return t._rawValidators}function jE(t){return t._rawAsyncValidators}function Xu(t){return t?Array.isArray(t)?t:[t]:[]}function No(t,e){return Array.isArray(t)?t.includes(e):t===e}function qh(t,e){let n=Xu(e);return Xu(t).forEach(i=>{No(n,i)||n.push(i)}),n}function Zh(t,e){return Xu(e).filter(n=>!No(t,n))}var Oo=class{constructor(){this._rawValidators=[],this._rawAsyncValidators=[],this._onDestroyCallbacks=[]}get value(){return this.control?this.control.value:null}get valid(){return this.control?this.control.valid:null}get invalid(){return this.control?this.control.invalid:null}get pending(){return this.control?this.control.pending:null}get disabled(){return this.control?this.control.disabled:null}get enabled(){return this.control?this.control.enabled:null}get errors(){return this.control?this.control.errors:null}get pristine(){return this.control?this.control.pristine:null}get dirty(){return this.control?this.control.dirty:null}get touched(){return this.control?this.control.touched:null}get status(){return this.control?this.control.status:null}get untouched(){return this.control?this.control.untouched:null}get statusChanges(){return this.control?this.control.statusChanges:null}get valueChanges(){return this.control?this.control.valueChanges:null}get path(){return null}_setValidators(e){this._rawValidators=e||[],this._composedValidatorFn=sp(this._rawValidators)}_setAsyncValidators(e){this._rawAsyncValidators=e||[],this._composedAsyncValidatorFn=ap(this._rawAsyncValidators)}get validator(){return this._composedValidatorFn||null}get asyncValidator(){return this._composedAsyncValidatorFn||null}_registerOnDestroy(e){this._onDestroyCallbacks.push(e)}_invokeOnDestroyCallbacks(){this._onDestroyCallbacks.forEach(e=>e()),this._onDestroyCallbacks=[]}reset(e=void 0){this.control&&this.control.reset(e)}hasError(e,n){return this.control?this.control.hasError(e,n):!1}getError(e,n){return this.control?this.control.getError(e,n):null}},ec=class extends Oo{get formDirective(){return null}get path(){return null}},kr=class extends Oo{constructor(){super(...arguments),this._parent=null,this.name=null,this.valueAccessor=null}},tc=class{constructor(e){this._cd=e}get isTouched(){return!!this._cd?.control?.touched}get isUntouched(){return!!this._cd?.control?.untouched}get isPristine(){return!!this._cd?.control?.pristine}get isDirty(){return!!this._cd?.control?.dirty}get isValid(){return!!this._cd?.control?.valid}get isInvalid(){return!!this._cd?.control?.invalid}get isPending(){return!!this._cd?.control?.pending}get isSubmitted(){return!!this._cd?.submitted}},$E={"[class.ng-untouched]":"isUntouched","[class.ng-touched]":"isTouched","[class.ng-pristine]":"isPristine","[class.ng-dirty]":"isDirty","[class.ng-valid]":"isValid","[class.ng-invalid]":"isInvalid","[class.ng-pending]":"isPending"},ZN=V(m({},$E),{"[class.ng-submitted]":"isSubmitted"}),up=(()=>{let e=class e extends tc{constructor(r){super(r)}};e.\u0275fac=function(i){return new(i||e)(U(kr,2))},e.\u0275dir=Ee({type:e,selectors:[["","formControlName",""],["","ngModel",""],["","formControl",""]],hostVars:14,hostBindings:function(i,o){i&2&&Ba("ng-untouched",o.isUntouched)("ng-touched",o.isTouched)("ng-pristine",o.isPristine)("ng-dirty",o.isDirty)("ng-valid",o.isValid)("ng-invalid",o.isInvalid)("ng-pending",o.isPending)},features:[Vt]});let t=e;return t})();var Pr="VALID",xo="INVALID",kn="PENDING",Fr="DISABLED";function UE(t){return(Po(t)?t.validators:t)||null}function BE(t){return Array.isArray(t)?sp(t):t||null}function HE(t,e){return(Po(e)?e.asyncValidators:t)||null}function zE(t){return Array.isArray(t)?ap(t):t||null}function Po(t){return t!=null&&!Array.isArray(t)&&typeof t=="object"}var nc=class{constructor(e,n){this._pendingDirty=!1,this._hasOwnPendingAsyncValidator=!1,this._pendingTouched=!1,this._onCollectionChange=()=>{},this._parent=null,this.pristine=!0,this.touched=!1,this._onDisabledChange=[],this._assignValidators(e),this._assignAsyncValidators(n)}get validator(){return this._composedValidatorFn}set validator(e){this._rawValidators=this._composedValidatorFn=e}get asyncValidator(){return this._composedAsyncValidatorFn}set asyncValidator(e){this._rawAsyncValidators=this._composedAsyncValidatorFn=e}get parent(){return this._parent}get valid(){return this.status===Pr}get invalid(){return this.status===xo}get pending(){return this.status==kn}get disabled(){return this.status===Fr}get enabled(){return this.status!==Fr}get dirty(){return!this.pristine}get untouched(){return!this.touched}get updateOn(){return this._updateOn?this._updateOn:this.parent?this.parent.updateOn:"change"}setValidators(e){this._assignValidators(e)}setAsyncValidators(e){this._assignAsyncValidators(e)}addValidators(e){this.setValidators(qh(e,this._rawValidators))}addAsyncValidators(e){this.setAsyncValidators(qh(e,this._rawAsyncValidators))}removeValidators(e){this.setValidators(Zh(e,this._rawValidators))}removeAsyncValidators(e){this.setAsyncValidators(Zh(e,this._rawAsyncValidators))}hasValidator(e){return No(this._rawValidators,e)}hasAsyncValidator(e){return No(this._rawAsyncValidators,e)}clearValidators(){this.validator=null}clearAsyncValidators(){this.asyncValidator=null}markAsTouched(e={}){this.touched=!0,this._parent&&!e.onlySelf&&this._parent.markAsTouched(e)}markAllAsTouched(){this.markAsTouched({onlySelf:!0}),this._forEachChild(e=>e.markAllAsTouched())}markAsUntouched(e={}){this.touched=!1,this._pendingTouched=!1,this._forEachChild(n=>{n.markAsUntouched({onlySelf:!0})}),this._parent&&!e.onlySelf&&this._parent._updateTouched(e)}markAsDirty(e={}){this.pristine=!1,this._parent&&!e.onlySelf&&this._parent.markAsDirty(e)}markAsPristine(e={}){this.pristine=!0,this._pendingDirty=!1,this._forEachChild(n=>{n.markAsPristine({onlySelf:!0})}),this._parent&&!e.onlySelf&&this._parent._updatePristine(e)}markAsPending(e={}){this.status=kn,e.emitEvent!==!1&&this.statusChanges.emit(this.status),this._parent&&!e.onlySelf&&this._parent.markAsPending(e)}disable(e={}){let n=this._parentMarkedDirty(e.onlySelf);this.status=Fr,this.errors=null,this._forEachChild(r=>{r.disable(V(m({},e),{onlySelf:!0}))}),this._updateValue(),e.emitEvent!==!1&&(this.valueChanges.emit(this.value),this.statusChanges.emit(this.status)),this._updateAncestors(V(m({},e),{skipPristineCheck:n})),this._onDisabledChange.forEach(r=>r(!0))}enable(e={}){let n=this._parentMarkedDirty(e.onlySelf);this.status=Pr,this._forEachChild(r=>{r.enable(V(m({},e),{onlySelf:!0}))}),this.updateValueAndValidity({onlySelf:!0,emitEvent:e.emitEvent}),this._updateAncestors(V(m({},e),{skipPristineCheck:n})),this._onDisabledChange.forEach(r=>r(!1))}_updateAncestors(e){this._parent&&!e.onlySelf&&(this._parent.updateValueAndValidity(e),e.skipPristineCheck||this._parent._updatePristine(),this._parent._updateTouched())}setParent(e){this._parent=e}getRawValue(){return this.value}updateValueAndValidity(e={}){this._setInitialStatus(),this._updateValue(),this.enabled&&(this._cancelExistingSubscription(),this.errors=this._runValidator(),this.status=this._calculateStatus(),(this.status===Pr||this.status===kn)&&this._runAsyncValidator(e.emitEvent)),e.emitEvent!==!1&&(this.valueChanges.emit(this.value),this.statusChanges.emit(this.status)),this._parent&&!e.onlySelf&&this._parent.updateValueAndValidity(e)}_updateTreeValidity(e={emitEvent:!0}){this._forEachChild(n=>n._updateTreeValidity(e)),this.updateValueAndValidity({onlySelf:!0,emitEvent:e.emitEvent})}_setInitialStatus(){this.status=this._allControlsDisabled()?Fr:Pr}_runValidator(){return this.validator?this.validator(this):null}_runAsyncValidator(e){if(this.asyncValidator){this.status=kn,this._hasOwnPendingAsyncValidator=!0;let n=np(this.asyncValidator(this));this._asyncValidationSubscription=n.subscribe(r=>{this._hasOwnPendingAsyncValidator=!1,this.setErrors(r,{emitEvent:e})})}}_cancelExistingSubscription(){this._asyncValidationSubscription&&(this._asyncValidationSubscription.unsubscribe(),this._hasOwnPendingAsyncValidator=!1)}setErrors(e,n={}){this.errors=e,this._updateControlsErrors(n.emitEvent!==!1)}get(e){let n=e;return n==null||(Array.isArray(n)||(n=n.split(".")),n.length===0)?null:n.reduce((r,i)=>r&&r._find(i),this)}getError(e,n){let r=n?this.get(n):this;return r&&r.errors?r.errors[e]:null}hasError(e,n){return!!this.getError(e,n)}get root(){let e=this;for(;e._parent;)e=e._parent;return e}_updateControlsErrors(e){this.status=this._calculateStatus(),e&&this.statusChanges.emit(this.status),this._parent&&this._parent._updateControlsErrors(e)}_initObservables(){this.valueChanges=new oe,this.statusChanges=new oe}_calculateStatus(){return this._allControlsDisabled()?Fr:this.errors?xo:this._hasOwnPendingAsyncValidator||this._anyControlsHaveStatus(kn)?kn:this._anyControlsHaveStatus(xo)?xo:Pr}_anyControlsHaveStatus(e){return this._anyControls(n=>n.status===e)}_anyControlsDirty(){return this._anyControls(e=>e.dirty)}_anyControlsTouched(){return this._anyControls(e=>e.touched)}_updatePristine(e={}){this.pristine=!this._anyControlsDirty(),this._parent&&!e.onlySelf&&this._parent._updatePristine(e)}_updateTouched(e={}){this.touched=this._anyControlsTouched(),this._parent&&!e.onlySelf&&this._parent._updateTouched(e)}_registerOnCollectionChange(e){this._onCollectionChange=e}_setUpdateStrategy(e){Po(e)&&e.updateOn!=null&&(this._updateOn=e.updateOn)}_parentMarkedDirty(e){let n=this._parent&&this._parent.dirty;return!e&&!!n&&!this._parent._anyControlsDirty()}_find(e){return null}_assignValidators(e){this._rawValidators=Array.isArray(e)?e.slice():e,this._composedValidatorFn=BE(this._rawValidators)}_assignAsyncValidators(e){this._rawAsyncValidators=Array.isArray(e)?e.slice():e,this._composedAsyncValidatorFn=zE(this._rawAsyncValidators)}};var cp=new E("CallSetDisabledState",{providedIn:"root",factory:()=>ic}),ic="always";function GE(t,e){return[...e.path,t]}function WE(t,e,n=ic){ZE(t,e),e.valueAccessor.writeValue(t.value),(t.disabled||n==="always")&&e.valueAccessor.setDisabledState?.(t.disabled),YE(t,e),KE(t,e),QE(t,e),qE(t,e)}function Yh(t,e){t.forEach(n=>{n.registerOnValidatorChange&&n.registerOnValidatorChange(e)})}function qE(t,e){if(e.valueAccessor.setDisabledState){let n=r=>{e.valueAccessor.setDisabledState(r)};t.registerOnDisabledChange(n),e._registerOnDestroy(()=>{t._unregisterOnDisabledChange(n)})}}function ZE(t,e){let n=VE(t);e.validator!==null?t.setValidators(Wh(n,e.validator)):typeof n=="function"&&t.setValidators([n]);let r=jE(t);e.asyncValidator!==null?t.setAsyncValidators(Wh(r,e.asyncValidator)):typeof r=="function"&&t.setAsyncValidators([r]);let i=()=>t.updateValueAndValidity();Yh(e._rawValidators,i),Yh(e._rawAsyncValidators,i)}function YE(t,e){e.valueAccessor.registerOnChange(n=>{t._pendingValue=n,t._pendingChange=!0,t._pendingDirty=!0,t.updateOn==="change"&&lp(t,e)})}function QE(t,e){e.valueAccessor.registerOnTouched(()=>{t._pendingTouched=!0,t.updateOn==="blur"&&t._pendingChange&&lp(t,e),t.updateOn!=="submit"&&t.markAsTouched()})}function lp(t,e){t._pendingDirty&&t.markAsDirty(),t.setValue(t._pendingValue,{emitModelToViewChange:!1}),e.viewToModelUpdate(t._pendingValue),t._pendingChange=!1}function KE(t,e){let n=(r,i)=>{e.valueAccessor.writeValue(r),i&&e.viewToModelUpdate(r)};t.registerOnChange(n),e._registerOnDestroy(()=>{t._unregisterOnChange(n)})}function JE(t,e){if(!t.hasOwnProperty("model"))return!1;let n=t.model;return n.isFirstChange()?!0:!Object.is(e,n.currentValue)}function XE(t){return Object.getPrototypeOf(t.constructor)===ep}function eb(t,e){if(!e)return null;Array.isArray(e);let n,r,i;return e.forEach(o=>{o.constructor===Ro?n=o:XE(o)?r=o:i=o}),i||r||n||null}function Qh(t,e){let n=t.indexOf(e);n>-1&&t.splice(n,1)}function Kh(t){return typeof t=="object"&&t!==null&&Object.keys(t).length===2&&"value"in t&&"disabled"in t}var tb=class extends nc{constructor(e=null,n,r){super(UE(n),HE(r,n)),this.defaultValue=null,this._onChange=[],this._pendingChange=!1,this._applyFormState(e),this._setUpdateStrategy(n),this._initObservables(),this.updateValueAndValidity({onlySelf:!0,emitEvent:!!this.asyncValidator}),Po(n)&&(n.nonNullable||n.initialValueIsDefault)&&(Kh(e)?this.defaultValue=e.value:this.defaultValue=e)}setValue(e,n={}){this.value=this._pendingValue=e,this._onChange.length&&n.emitModelToViewChange!==!1&&this._onChange.forEach(r=>r(this.value,n.emitViewToModelChange!==!1)),this.updateValueAndValidity(n)}patchValue(e,n={}){this.setValue(e,n)}reset(e=this.defaultValue,n={}){this._applyFormState(e),this.markAsPristine(n),this.markAsUntouched(n),this.setValue(this.value,n),this._pendingChange=!1}_updateValue(){}_anyControls(e){return!1}_allControlsDisabled(){return this.disabled}registerOnChange(e){this._onChange.push(e)}_unregisterOnChange(e){Qh(this._onChange,e)}registerOnDisabledChange(e){this._onDisabledChange.push(e)}_unregisterOnDisabledChange(e){Qh(this._onDisabledChange,e)}_forEachChild(e){}_syncPendingControls(){return this.updateOn==="submit"&&(this._pendingDirty&&this.markAsDirty(),this._pendingTouched&&this.markAsTouched(),this._pendingChange)?(this.setValue(this._pendingValue,{onlySelf:!0,emitModelToViewChange:!1}),!0):!1}_applyFormState(e){Kh(e)?(this.value=this._pendingValue=e.value,e.disabled?this.disable({onlySelf:!0,emitEvent:!1}):this.enable({onlySelf:!0,emitEvent:!1})):this.value=this._pendingValue=e}};var nb={provide:kr,useExisting:Dn(()=>oc)},Jh=(()=>Promise.resolve())(),oc=(()=>{let e=class e extends kr{constructor(r,i,o,s,a,u){super(),this._changeDetectorRef=a,this.callSetDisabledState=u,this.control=new tb,this._registered=!1,this.name="",this.update=new oe,this._parent=r,this._setValidators(i),this._setAsyncValidators(o),this.valueAccessor=eb(this,s)}ngOnChanges(r){if(this._checkForErrors(),!this._registered||"name"in r){if(this._registered&&(this._checkName(),this.formDirective)){let i=r.name.previousValue;this.formDirective.removeControl({name:i,path:this._getPath(i)})}this._setUpControl()}"isDisabled"in r&&this._updateDisabled(r),JE(r,this.viewModel)&&(this._updateValue(this.model),this.viewModel=this.model)}ngOnDestroy(){this.formDirective&&this.formDirective.removeControl(this)}get path(){return this._getPath(this.name)}get formDirective(){return this._parent?this._parent.formDirective:null}viewToModelUpdate(r){this.viewModel=r,this.update.emit(r)}_setUpControl(){this._setUpdateStrategy(),this._isStandalone()?this._setUpStandalone():this.formDirective.addControl(this),this._registered=!0}_setUpdateStrategy(){this.options&&this.options.updateOn!=null&&(this.control._updateOn=this.options.updateOn)}_isStandalone(){return!this._parent||!!(this.options&&this.options.standalone)}_setUpStandalone(){WE(this.control,this,this.callSetDisabledState),this.control.updateValueAndValidity({emitEvent:!1})}_checkForErrors(){this._isStandalone()||this._checkParentType(),this._checkName()}_checkParentType(){}_checkName(){this.options&&this.options.name&&(this.name=this.options.name),!this._isStandalone()&&this.name}_updateValue(r){Jh.then(()=>{this.control.setValue(r,{emitViewToModelChange:!1}),this._changeDetectorRef?.markForCheck()})}_updateDisabled(r){let i=r.isDisabled.currentValue,o=i!==0&&no(i);Jh.then(()=>{o&&!this.control.disabled?this.control.disable():!o&&this.control.disabled&&this.control.enable(),this._changeDetectorRef?.markForCheck()})}_getPath(r){return this._parent?GE(r,this._parent):[r]}};e.\u0275fac=function(i){return new(i||e)(U(ec,9),U(RE,10),U(PE,10),U(rc,10),U(En,8),U(cp,8))},e.\u0275dir=Ee({type:e,selectors:[["","ngModel","",3,"formControlName","",3,"formControl",""]],inputs:{name:"name",isDisabled:["disabled","isDisabled"],model:["ngModel","model"],options:["ngModelOptions","options"]},outputs:{update:"ngModelChange"},exportAs:["ngModel"],features:[Ki([nb]),Vt,Cn]});let t=e;return t})();var rb=(()=>{let e=class e{};e.\u0275fac=function(i){return new(i||e)},e.\u0275mod=Le({type:e}),e.\u0275inj=ke({});let t=e;return t})();var ib={provide:rc,useExisting:Dn(()=>sc),multi:!0},sc=(()=>{let e=class e extends ep{writeValue(r){this.setProperty("value",parseFloat(r))}registerOnChange(r){this.onChange=i=>{r(i==""?null:parseFloat(i))}}};e.\u0275fac=(()=>{let r;return function(o){return(r||(r=wn(e)))(o||e)}})(),e.\u0275dir=Ee({type:e,selectors:[["input","type","range","formControlName",""],["input","type","range","formControl",""],["input","type","range","ngModel",""]],hostBindings:function(i,o){i&1&&ht("change",function(a){return o.onChange(a.target.value)})("input",function(a){return o.onChange(a.target.value)})("blur",function(){return o.onTouched()})},features:[Ki([ib]),Vt]});let t=e;return t})();var ob=(()=>{let e=class e{};e.\u0275fac=function(i){return new(i||e)},e.\u0275mod=Le({type:e}),e.\u0275inj=ke({imports:[rb]});let t=e;return t})();var dp=(()=>{let e=class e{static withConfig(r){return{ngModule:e,providers:[{provide:cp,useValue:r.callSetDisabledState??ic}]}}};e.\u0275fac=function(i){return new(i||e)},e.\u0275mod=Le({type:e}),e.\u0275inj=ke({imports:[ob]});let t=e;return t})();var ab=(t,e)=>[t,e],te=function(t){return t.Christmas="Christmas",t.Easter="Easter",t.Halloween="Halloween",t.NewYearsEve="New Year's Eve",t.Default="Default",t}(te||{}),qt=function(t){return t.Background="Background",t.Text="Text",t.Button="Button",t.Heading="Heading",t.Slider="Slider",t}(qt||{}),fp=(()=>{let e=class e{constructor(r){this.http=r,this.subscriptions=[],this.speed=0,this.speedLimit=255,this.ip="127.0.0.1",this.realSpeed=0,this.COMPONENT_TYPE=qt}ngOnInit(){this.subscriptions.push(this.http.get("getSpeedLimit",{responseType:"text"}).subscribe(r=>{r!==""&&Number(r)>0&&Number(r)<256&&(this.speedLimit=Number(r))}),this.http.get("getLocalIP",{responseType:"text"}).subscribe(r=>{this.ip=r,this.initWebSocket(r)}))}ngOnDestroy(){this.unsubscribeAll()}initWebSocket(r){this.webSocket=new WebSocket(`ws://${r}:81`),this.webSocket.onopen=()=>{console.log("WebSocket connected")},this.webSocket.onmessage=i=>{console.log("Received message:",i.data),this.realSpeed=i.data,this.speed=this.mapValueTo100(this.realSpeed)},this.webSocket.onclose=()=>{console.log("WebSocket connection closed")}}unsubscribeAll(){this.subscriptions.forEach(r=>r.unsubscribe())}mapValueTo255(r){let i=Math.min(Math.max(r,0),100);return Math.round(i/100*this.speedLimit)}mapValueTo100(r){let i=Math.min(Math.max(r,0),this.speedLimit);return Math.round(i/this.speedLimit*100)}changeSpeed(){this.realSpeed=this.mapValueTo255(this.speed);let r=`/config?speed=${String(this.realSpeed)}`;this.http.get(r,{responseType:"text"}).subscribe(i=>{console.log("HTTP request successful:",i)})}reverseDirection(){let r="/reverse";this.http.get(r,{responseType:"text"}).subscribe(i=>{console.log("HTTP request successful:",i)})}calculateEasterDate(r){let i=r%19,o=Math.floor(r/100),s=r%100,a=Math.floor(o/4),u=o%4,c=Math.floor((o+8)/25),l=Math.floor((o-c+1)/3),d=(19*i+o-a-l+15)%30,f=Math.floor(s/4),h=s%4,g=(32+2*u+2*f-d-h)%7,_=Math.floor((i+11*d+22*g)/451),b=Math.floor((d+g-7*_+114)/31),v=(d+g-7*_+114)%31+1;return new Date(r,b-1,v)}getCurrentSeason(){let r=new Date,i=r.getMonth()+1,o=r.getDate(),s=this.calculateEasterDate(r.getFullYear()),a=s.getMonth()+1,u=s.getDate();switch(i){case 3:if(i===a&&o>=u-2)return te.Easter;break;case 4:if(i===a&&o>=u-2)return te.Easter;break;case 10:if(o>=28&&o<=31)return te.Halloween;break;case 12:if(o>=1&&o<=30)return te.Christmas;if(o>=31&&o<=31)return te.NewYearsEve;break}return te.Default}getSeasonalClass(r){let i="";switch(r){case qt.Background:i="background";break;case qt.Text:i="text";break;case qt.Button:i="button";break;case qt.Heading:i="heading";break;case qt.Slider:i="slider";break;default:return console.error(`Component type ${r} unknown`),""}switch(this.getCurrentSeason()){case te.Easter:return`${i}__easter`;case te.Halloween:return`${i}__halloween`;case te.Christmas:return`${i}__christmas`;case te.NewYearsEve:return`${i}__new-year`;case te.Default:return`${i}__default`;default:return""}}getHeadingText(){switch(this.getCurrentSeason()){case te.Christmas:return"(Christmas Train)";case te.Easter:return"Easter Train";case te.Halloween:return"Halloween Train";case te.NewYearsEve:return"New Year Train";case te.Default:return"Train";default:return console.error("Cannot detect current season"),"Train"}}};e.\u0275fac=function(i){return new(i||e)(U(ou))},e.\u0275cmp=Ui({type:e,selectors:[["app-root"]],standalone:!0,features:[Ji],decls:10,vars:12,consts:[[1,"page",3,"ngClass"],[1,"heading",3,"ngClass"],[1,"button",3,"ngClass","click"],["type","range","min","0","max","100",1,"slider",3,"ngClass","ngModel","ngModelChange","input"],[1,"display"]],template:function(i,o){i&1&&(dt(0,"div",0)(1,"h1",1),sr(2),ft(),dt(3,"div",2),ht("click",function(){return o.reverseDirection()}),sr(4,"reverse"),ft(),dt(5,"input",3),ht("ngModelChange",function(a){return o.speed=a})("input",function(){return o.changeSpeed()}),ft(),dt(6,"div",4),sr(7),ft(),dt(8,"div"),sr(9),ft()()),i&2&&(bn("ngClass",Sf(9,ab,o.getSeasonalClass(o.COMPONENT_TYPE.Text),o.getSeasonalClass(o.COMPONENT_TYPE.Background))),Lt(1),bn("ngClass",o.getSeasonalClass(o.COMPONENT_TYPE.Heading)),Lt(1),za(o.getHeadingText()),Lt(1),bn("ngClass",o.getSeasonalClass(o.COMPONENT_TYPE.Button)),Lt(2),bn("ngClass",o.getSeasonalClass(o.COMPONENT_TYPE.Slider))("ngModel",o.speed),Lt(2),Ga("Speed: ",o.speed," - Real Speed: ",o.realSpeed,""),Lt(2),Qi("train.local or ",o.ip,""))},dependencies:[Ka,$f,dp,Ro,sc,up,oc],encapsulation:2});let t=e;return t})();ih(fp,Gh).catch(t=>console.error(t));
+`).forEach(n=>{let r=n.indexOf(":");if(r>0){let i=n.slice(0,r),o=i.toLowerCase(),s=n.slice(r+1).trim();this.maybeSetNormalizedName(i,o),this.headers.has(o)?this.headers.get(o).push(s):this.headers.set(o,[s])}})}:typeof Headers<"u"&&e instanceof Headers?(this.headers=new Map,e.forEach((n,r)=>{this.setHeaderEntries(r,n)})):this.lazyInit=()=>{this.headers=new Map,Object.entries(e).forEach(([n,r])=>{this.setHeaderEntries(n,r)})}:this.headers=new Map}has(e){return this.init(),this.headers.has(e.toLowerCase())}get(e){this.init();let n=this.headers.get(e.toLowerCase());return n&&n.length>0?n[0]:null}keys(){return this.init(),Array.from(this.normalizedNames.values())}getAll(e){return this.init(),this.headers.get(e.toLowerCase())||null}append(e,n){return this.clone({name:e,value:n,op:"a"})}set(e,n){return this.clone({name:e,value:n,op:"s"})}delete(e,n){return this.clone({name:e,value:n,op:"d"})}maybeSetNormalizedName(e,n){this.normalizedNames.has(n)||this.normalizedNames.set(n,e)}init(){this.lazyInit&&(this.lazyInit instanceof t?this.copyFrom(this.lazyInit):this.lazyInit(),this.lazyInit=null,this.lazyUpdate&&(this.lazyUpdate.forEach(e=>this.applyUpdate(e)),this.lazyUpdate=null))}copyFrom(e){e.init(),Array.from(e.headers.keys()).forEach(n=>{this.headers.set(n,e.headers.get(n)),this.normalizedNames.set(n,e.normalizedNames.get(n))})}clone(e){let n=new t;return n.lazyInit=this.lazyInit&&this.lazyInit instanceof t?this.lazyInit:this,n.lazyUpdate=(this.lazyUpdate||[]).concat([e]),n}applyUpdate(e){let n=e.name.toLowerCase();switch(e.op){case"a":case"s":let r=e.value;if(typeof r=="string"&&(r=[r]),r.length===0)return;this.maybeSetNormalizedName(e.name,n);let i=(e.op==="a"?this.headers.get(n):void 0)||[];i.push(...r),this.headers.set(n,i);break;case"d":let o=e.value;if(!o)this.headers.delete(n),this.normalizedNames.delete(n);else{let s=this.headers.get(n);if(!s)return;s=s.filter(a=>o.indexOf(a)===-1),s.length===0?(this.headers.delete(n),this.normalizedNames.delete(n)):this.headers.set(n,s)}break}}setHeaderEntries(e,n){let r=(Array.isArray(n)?n:[n]).map(o=>o.toString()),i=e.toLowerCase();this.headers.set(i,r),this.maybeSetNormalizedName(e,i)}forEach(e){this.init(),Array.from(this.normalizedNames.keys()).forEach(n=>e(this.normalizedNames.get(n),this.headers.get(n)))}};var nu=class{encodeKey(e){return Bf(e)}encodeValue(e){return Bf(e)}decodeKey(e){return decodeURIComponent(e)}decodeValue(e){return decodeURIComponent(e)}};function qD(t,e){let n=new Map;return t.length>0&&t.replace(/^\?/,"").split("&").forEach(i=>{let o=i.indexOf("="),[s,a]=o==-1?[e.decodeKey(i),""]:[e.decodeKey(i.slice(0,o)),e.decodeValue(i.slice(o+1))],u=n.get(s)||[];u.push(a),n.set(s,u)}),n}var ZD=/%(\d[a-f0-9])/gi,YD={40:"@","3A":":",24:"$","2C":",","3B":";","3D":"=","3F":"?","2F":"/"};function Bf(t){return encodeURIComponent(t).replace(ZD,(e,n)=>YD[n]??e)}function so(t){return`${t}`}var gt=class t{constructor(e={}){if(this.updates=null,this.cloneFrom=null,this.encoder=e.encoder||new nu,e.fromString){if(e.fromObject)throw new Error("Cannot specify both fromString and fromObject.");this.map=qD(e.fromString,this.encoder)}else e.fromObject?(this.map=new Map,Object.keys(e.fromObject).forEach(n=>{let r=e.fromObject[n],i=Array.isArray(r)?r.map(so):[so(r)];this.map.set(n,i)})):this.map=null}has(e){return this.init(),this.map.has(e)}get(e){this.init();let n=this.map.get(e);return n?n[0]:null}getAll(e){return this.init(),this.map.get(e)||null}keys(){return this.init(),Array.from(this.map.keys())}append(e,n){return this.clone({param:e,value:n,op:"a"})}appendAll(e){let n=[];return Object.keys(e).forEach(r=>{let i=e[r];Array.isArray(i)?i.forEach(o=>{n.push({param:r,value:o,op:"a"})}):n.push({param:r,value:i,op:"a"})}),this.clone(n)}set(e,n){return this.clone({param:e,value:n,op:"s"})}delete(e,n){return this.clone({param:e,value:n,op:"d"})}toString(){return this.init(),this.keys().map(e=>{let n=this.encoder.encodeKey(e);return this.map.get(e).map(r=>n+"="+this.encoder.encodeValue(r)).join("&")}).filter(e=>e!=="").join("&")}clone(e){let n=new t({encoder:this.encoder});return n.cloneFrom=this.cloneFrom||this,n.updates=(this.updates||[]).concat(e),n}init(){this.map===null&&(this.map=new Map),this.cloneFrom!==null&&(this.cloneFrom.init(),this.cloneFrom.keys().forEach(e=>this.map.set(e,this.cloneFrom.map.get(e))),this.updates.forEach(e=>{switch(e.op){case"a":case"s":let n=(e.op==="a"?this.map.get(e.param):void 0)||[];n.push(so(e.value)),this.map.set(e.param,n);break;case"d":if(e.value!==void 0){let r=this.map.get(e.param)||[],i=r.indexOf(so(e.value));i!==-1&&r.splice(i,1),r.length>0?this.map.set(e.param,r):this.map.delete(e.param)}else{this.map.delete(e.param);break}}}),this.cloneFrom=this.updates=null)}};var ru=class{constructor(){this.map=new Map}set(e,n){return this.map.set(e,n),this}get(e){return this.map.has(e)||this.map.set(e,e.defaultValue()),this.map.get(e)}delete(e){return this.map.delete(e),this}has(e){return this.map.has(e)}keys(){return this.map.keys()}};function QD(t){switch(t){case"DELETE":case"GET":case"HEAD":case"OPTIONS":case"JSONP":return!1;default:return!0}}function Hf(t){return typeof ArrayBuffer<"u"&&t instanceof ArrayBuffer}function zf(t){return typeof Blob<"u"&&t instanceof Blob}function Gf(t){return typeof FormData<"u"&&t instanceof FormData}function KD(t){return typeof URLSearchParams<"u"&&t instanceof URLSearchParams}var cr=class t{constructor(e,n,r,i){this.url=n,this.body=null,this.reportProgress=!1,this.withCredentials=!1,this.responseType="json",this.method=e.toUpperCase();let o;if(QD(this.method)||i?(this.body=r!==void 0?r:null,o=i):o=r,o&&(this.reportProgress=!!o.reportProgress,this.withCredentials=!!o.withCredentials,o.responseType&&(this.responseType=o.responseType),o.headers&&(this.headers=o.headers),o.context&&(this.context=o.context),o.params&&(this.params=o.params),this.transferCache=o.transferCache),this.headers||(this.headers=new Bt),this.context||(this.context=new ru),!this.params)this.params=new gt,this.urlWithParams=n;else{let s=this.params.toString();if(s.length===0)this.urlWithParams=n;else{let a=n.indexOf("?"),u=a===-1?"?":a<n.length-1?"&":"";this.urlWithParams=n+u+s}}}serializeBody(){return this.body===null?null:Hf(this.body)||zf(this.body)||Gf(this.body)||KD(this.body)||typeof this.body=="string"?this.body:this.body instanceof gt?this.body.toString():typeof this.body=="object"||typeof this.body=="boolean"||Array.isArray(this.body)?JSON.stringify(this.body):this.body.toString()}detectContentTypeHeader(){return this.body===null||Gf(this.body)?null:zf(this.body)?this.body.type||null:Hf(this.body)?null:typeof this.body=="string"?"text/plain":this.body instanceof gt?"application/x-www-form-urlencoded;charset=UTF-8":typeof this.body=="object"||typeof this.body=="number"||typeof this.body=="boolean"?"application/json":null}clone(e={}){let n=e.method||this.method,r=e.url||this.url,i=e.responseType||this.responseType,o=e.body!==void 0?e.body:this.body,s=e.withCredentials!==void 0?e.withCredentials:this.withCredentials,a=e.reportProgress!==void 0?e.reportProgress:this.reportProgress,u=e.headers||this.headers,c=e.params||this.params,l=e.context??this.context;return e.setHeaders!==void 0&&(u=Object.keys(e.setHeaders).reduce((d,f)=>d.set(f,e.setHeaders[f]),u)),e.setParams&&(c=Object.keys(e.setParams).reduce((d,f)=>d.set(f,e.setParams[f]),c)),new t(n,r,o,{params:c,headers:u,context:l,reportProgress:a,responseType:i,withCredentials:s})}},Mn=function(t){return t[t.Sent=0]="Sent",t[t.UploadProgress=1]="UploadProgress",t[t.ResponseHeader=2]="ResponseHeader",t[t.DownloadProgress=3]="DownloadProgress",t[t.Response=4]="Response",t[t.User=5]="User",t}(Mn||{}),dr=class{constructor(e,n=200,r="OK"){this.headers=e.headers||new Bt,this.status=e.status!==void 0?e.status:n,this.statusText=e.statusText||r,this.url=e.url||null,this.ok=this.status>=200&&this.status<300}},iu=class t extends dr{constructor(e={}){super(e),this.type=Mn.ResponseHeader}clone(e={}){return new t({headers:e.headers||this.headers,status:e.status!==void 0?e.status:this.status,statusText:e.statusText||this.statusText,url:e.url||this.url||void 0})}},uo=class t extends dr{constructor(e={}){super(e),this.type=Mn.Response,this.body=e.body!==void 0?e.body:null}clone(e={}){return new t({body:e.body!==void 0?e.body:this.body,headers:e.headers||this.headers,status:e.status!==void 0?e.status:this.status,statusText:e.statusText||this.statusText,url:e.url||this.url||void 0})}},co=class extends dr{constructor(e){super(e,0,"Unknown Error"),this.name="HttpErrorResponse",this.ok=!1,this.status>=200&&this.status<300?this.message=`Http failure during parsing for ${e.url||"(unknown url)"}`:this.message=`Http failure response for ${e.url||"(unknown url)"}: ${e.status} ${e.statusText}`,this.error=e.error||null}};function tu(t,e){return{body:e,headers:t.headers,context:t.context,observe:t.observe,params:t.params,reportProgress:t.reportProgress,responseType:t.responseType,withCredentials:t.withCredentials,transferCache:t.transferCache}}var ou=(()=>{let e=class e{constructor(r){this.handler=r}request(r,i,o={}){let s;if(r instanceof cr)s=r;else{let c;o.headers instanceof Bt?c=o.headers:c=new Bt(o.headers);let l;o.params&&(o.params instanceof gt?l=o.params:l=new gt({fromObject:o.params})),s=new cr(r,i,o.body!==void 0?o.body:null,{headers:c,context:o.context,params:l,reportProgress:o.reportProgress,responseType:o.responseType||"json",withCredentials:o.withCredentials,transferCache:o.transferCache})}let a=D(s).pipe(nt(c=>this.handler.handle(c)));if(r instanceof cr||o.observe==="events")return a;let u=a.pipe(Y(c=>c instanceof uo));switch(o.observe||"body"){case"body":switch(s.responseType){case"arraybuffer":return u.pipe(M(c=>{if(c.body!==null&&!(c.body instanceof ArrayBuffer))throw new Error("Response is not an ArrayBuffer.");return c.body}));case"blob":return u.pipe(M(c=>{if(c.body!==null&&!(c.body instanceof Blob))throw new Error("Response is not a Blob.");return c.body}));case"text":return u.pipe(M(c=>{if(c.body!==null&&typeof c.body!="string")throw new Error("Response is not a string.");return c.body}));case"json":default:return u.pipe(M(c=>c.body))}case"response":return u;default:throw new Error(`Unreachable: unhandled observe type ${o.observe}}`)}}delete(r,i={}){return this.request("DELETE",r,i)}get(r,i={}){return this.request("GET",r,i)}head(r,i={}){return this.request("HEAD",r,i)}jsonp(r,i){return this.request("JSONP",r,{params:new gt().append(i,"JSONP_CALLBACK"),observe:"body",responseType:"json"})}options(r,i={}){return this.request("OPTIONS",r,i)}patch(r,i,o={}){return this.request("PATCH",r,tu(o,i))}post(r,i,o={}){return this.request("POST",r,tu(o,i))}put(r,i,o={}){return this.request("PUT",r,tu(o,i))}};e.\u0275fac=function(i){return new(i||e)(I(lr))},e.\u0275prov=w({token:e,factory:e.\u0275fac});let t=e;return t})();function JD(t,e){return e(t)}function XD(t,e,n){return(r,i)=>Ze(n,()=>e(r,o=>t(o,i)))}var Zf=new E(""),eC=new E(""),tC=new E("");var Wf=(()=>{let e=class e extends lr{constructor(r,i){super(),this.backend=r,this.injector=i,this.chain=null,this.pendingTasks=p(ar);let o=p(tC,{optional:!0});this.backend=o??r}handle(r){if(this.chain===null){let o=Array.from(new Set([...this.injector.get(Zf),...this.injector.get(eC,[])]));this.chain=o.reduceRight((s,a)=>XD(s,a,this.injector),JD)}let i=this.pendingTasks.add();return this.chain(r,o=>this.backend.handle(o)).pipe(Mt(()=>this.pendingTasks.remove(i)))}};e.\u0275fac=function(i){return new(i||e)(I(ao),I(le))},e.\u0275prov=w({token:e,factory:e.\u0275fac});let t=e;return t})();var nC=/^\)\]\}',?\n/;function rC(t){return"responseURL"in t&&t.responseURL?t.responseURL:/^X-Request-URL:/m.test(t.getAllResponseHeaders())?t.getResponseHeader("X-Request-URL"):null}var qf=(()=>{let e=class e{constructor(r){this.xhrFactory=r}handle(r){if(r.method==="JSONP")throw new C(-2800,!1);let i=this.xhrFactory;return(i.\u0275loadImpl?j(i.\u0275loadImpl()):D(null)).pipe(Z(()=>new S(s=>{let a=i.build();if(a.open(r.method,r.urlWithParams),r.withCredentials&&(a.withCredentials=!0),r.headers.forEach((b,v)=>a.setRequestHeader(b,v.join(","))),r.headers.has("Accept")||a.setRequestHeader("Accept","application/json, text/plain, */*"),!r.headers.has("Content-Type")){let b=r.detectContentTypeHeader();b!==null&&a.setRequestHeader("Content-Type",b)}if(r.responseType){let b=r.responseType.toLowerCase();a.responseType=b!=="json"?b:"text"}let u=r.serializeBody(),c=null,l=()=>{if(c!==null)return c;let b=a.statusText||"OK",v=new Bt(a.getAllResponseHeaders()),z=rC(a)||r.url;return c=new iu({headers:v,status:a.status,statusText:b,url:z}),c},d=()=>{let{headers:b,status:v,statusText:z,url:X}=l(),$=null;v!==204&&($=typeof a.response>"u"?a.responseText:a.response),v===0&&(v=$?200:0);let Se=v>=200&&v<300;if(r.responseType==="json"&&typeof $=="string"){let de=$;$=$.replace(nC,"");try{$=$!==""?JSON.parse($):null}catch(Je){$=de,Se&&(Se=!1,$={error:Je,text:$})}}Se?(s.next(new uo({body:$,headers:b,status:v,statusText:z,url:X||void 0})),s.complete()):s.error(new co({error:$,headers:b,status:v,statusText:z,url:X||void 0}))},f=b=>{let{url:v}=l(),z=new co({error:b,status:a.status||0,statusText:a.statusText||"Unknown Error",url:v||void 0});s.error(z)},h=!1,g=b=>{h||(s.next(l()),h=!0);let v={type:Mn.DownloadProgress,loaded:b.loaded};b.lengthComputable&&(v.total=b.total),r.responseType==="text"&&a.responseText&&(v.partialText=a.responseText),s.next(v)},_=b=>{let v={type:Mn.UploadProgress,loaded:b.loaded};b.lengthComputable&&(v.total=b.total),s.next(v)};return a.addEventListener("load",d),a.addEventListener("error",f),a.addEventListener("timeout",f),a.addEventListener("abort",f),r.reportProgress&&(a.addEventListener("progress",g),u!==null&&a.upload&&a.upload.addEventListener("progress",_)),a.send(u),s.next({type:Mn.Sent}),()=>{a.removeEventListener("error",f),a.removeEventListener("abort",f),a.removeEventListener("load",d),a.removeEventListener("timeout",f),r.reportProgress&&(a.removeEventListener("progress",g),u!==null&&a.upload&&a.upload.removeEventListener("progress",_)),a.readyState!==a.DONE&&a.abort()}})))}};e.\u0275fac=function(i){return new(i||e)(I(In))},e.\u0275prov=w({token:e,factory:e.\u0275fac});let t=e;return t})(),Yf=new E("XSRF_ENABLED"),iC="XSRF-TOKEN",oC=new E("XSRF_COOKIE_NAME",{providedIn:"root",factory:()=>iC}),sC="X-XSRF-TOKEN",aC=new E("XSRF_HEADER_NAME",{providedIn:"root",factory:()=>sC}),lo=class{},uC=(()=>{let e=class e{constructor(r,i,o){this.doc=r,this.platform=i,this.cookieName=o,this.lastCookieString="",this.lastToken=null,this.parseCount=0}getToken(){if(this.platform==="server")return null;let r=this.doc.cookie||"";return r!==this.lastCookieString&&(this.parseCount++,this.lastToken=oo(r,this.cookieName),this.lastCookieString=r),this.lastToken}};e.\u0275fac=function(i){return new(i||e)(I(ae),I(_e),I(oC))},e.\u0275prov=w({token:e,factory:e.\u0275fac});let t=e;return t})();function cC(t,e){let n=t.url.toLowerCase();if(!p(Yf)||t.method==="GET"||t.method==="HEAD"||n.startsWith("http://")||n.startsWith("https://"))return e(t);let r=p(lo).getToken(),i=p(aC);return r!=null&&!t.headers.has(i)&&(t=t.clone({headers:t.headers.set(i,r)})),e(t)}function Qf(...t){let e=[ou,qf,Wf,{provide:lr,useExisting:Wf},{provide:ao,useExisting:qf},{provide:Zf,useValue:cC,multi:!0},{provide:Yf,useValue:!0},{provide:lo,useClass:uC}];for(let n of t)e.push(...n.\u0275providers);return ct(e)}var uu=class extends ro{constructor(){super(...arguments),this.supportsDOMEvents=!0}},cu=class t extends uu{static makeCurrent(){kf(new t)}onAndCancel(e,n,r){return e.addEventListener(n,r),()=>{e.removeEventListener(n,r)}}dispatchEvent(e,n){e.dispatchEvent(n)}remove(e){e.parentNode&&e.parentNode.removeChild(e)}createElement(e,n){return n=n||this.getDefaultDocument(),n.createElement(e)}createHtmlDocument(){return document.implementation.createHTMLDocument("fakeTitle")}getDefaultDocument(){return document}isElementNode(e){return e.nodeType===Node.ELEMENT_NODE}isShadowRoot(e){return e instanceof DocumentFragment}getGlobalEventTarget(e,n){return n==="window"?window:n==="document"?e:n==="body"?e.body:null}getBaseHref(e){let n=dC();return n==null?null:fC(n)}resetBaseElement(){fr=null}getUserAgent(){return window.navigator.userAgent}getCookie(e){return oo(document.cookie,e)}},fr=null;function dC(){return fr=fr||document.querySelector("base"),fr?fr.getAttribute("href"):null}function fC(t){return new URL(t,document.baseURI).pathname}var hC=(()=>{let e=class e{build(){return new XMLHttpRequest}};e.\u0275fac=function(i){return new(i||e)},e.\u0275prov=w({token:e,factory:e.\u0275fac});let t=e;return t})(),lu=new E("EventManagerPlugins"),eh=(()=>{let e=class e{constructor(r,i){this._zone=i,this._eventNameToPlugin=new Map,r.forEach(o=>{o.manager=this}),this._plugins=r.slice().reverse()}addEventListener(r,i,o){return this._findPluginFor(i).addEventListener(r,i,o)}getZone(){return this._zone}_findPluginFor(r){let i=this._eventNameToPlugin.get(r);if(i)return i;if(i=this._plugins.find(s=>s.supports(r)),!i)throw new C(5101,!1);return this._eventNameToPlugin.set(r,i),i}};e.\u0275fac=function(i){return new(i||e)(I(lu),I(H))},e.\u0275prov=w({token:e,factory:e.\u0275fac});let t=e;return t})(),fo=class{constructor(e){this._doc=e}},su="ng-app-id",th=(()=>{let e=class e{constructor(r,i,o,s={}){this.doc=r,this.appId=i,this.nonce=o,this.platformId=s,this.styleRef=new Map,this.hostNodes=new Set,this.styleNodesInDOM=this.collectServerRenderedStyles(),this.platformIsServer=eu(s),this.resetHostNodes()}addStyles(r){for(let i of r)this.changeUsageCount(i,1)===1&&this.onStyleAdded(i)}removeStyles(r){for(let i of r)this.changeUsageCount(i,-1)<=0&&this.onStyleRemoved(i)}ngOnDestroy(){let r=this.styleNodesInDOM;r&&(r.forEach(i=>i.remove()),r.clear());for(let i of this.getAllStyles())this.onStyleRemoved(i);this.resetHostNodes()}addHost(r){this.hostNodes.add(r);for(let i of this.getAllStyles())this.addStyleToHost(r,i)}removeHost(r){this.hostNodes.delete(r)}getAllStyles(){return this.styleRef.keys()}onStyleAdded(r){for(let i of this.hostNodes)this.addStyleToHost(i,r)}onStyleRemoved(r){let i=this.styleRef;i.get(r)?.elements?.forEach(o=>o.remove()),i.delete(r)}collectServerRenderedStyles(){let r=this.doc.head?.querySelectorAll(`style[${su}="${this.appId}"]`);if(r?.length){let i=new Map;return r.forEach(o=>{o.textContent!=null&&i.set(o.textContent,o)}),i}return null}changeUsageCount(r,i){let o=this.styleRef;if(o.has(r)){let s=o.get(r);return s.usage+=i,s.usage}return o.set(r,{usage:i,elements:[]}),i}getStyleElement(r,i){let o=this.styleNodesInDOM,s=o?.get(i);if(s?.parentNode===r)return o.delete(i),s.removeAttribute(su),s;{let a=this.doc.createElement("style");return this.nonce&&a.setAttribute("nonce",this.nonce),a.textContent=i,this.platformIsServer&&a.setAttribute(su,this.appId),r.appendChild(a),a}}addStyleToHost(r,i){let o=this.getStyleElement(r,i),s=this.styleRef,a=s.get(i)?.elements;a?a.push(o):s.set(i,{elements:[o],usage:1})}resetHostNodes(){let r=this.hostNodes;r.clear(),r.add(this.doc.head)}};e.\u0275fac=function(i){return new(i||e)(I(ae),I(Ea),I(Ia,8),I(_e))},e.\u0275prov=w({token:e,factory:e.\u0275fac});let t=e;return t})(),au={svg:"http://www.w3.org/2000/svg",xhtml:"http://www.w3.org/1999/xhtml",xlink:"http://www.w3.org/1999/xlink",xml:"http://www.w3.org/XML/1998/namespace",xmlns:"http://www.w3.org/2000/xmlns/",math:"http://www.w3.org/1998/MathML/"},fu=/%COMP%/g,nh="%COMP%",pC=`_nghost-${nh}`,gC=`_ngcontent-${nh}`,mC=!0,vC=new E("RemoveStylesOnCompDestroy",{providedIn:"root",factory:()=>mC});function yC(t){return gC.replace(fu,t)}function DC(t){return pC.replace(fu,t)}function rh(t,e){return e.map(n=>n.replace(fu,t))}var Kf=(()=>{let e=class e{constructor(r,i,o,s,a,u,c,l=null){this.eventManager=r,this.sharedStylesHost=i,this.appId=o,this.removeStylesOnCompDestroy=s,this.doc=a,this.platformId=u,this.ngZone=c,this.nonce=l,this.rendererByCompId=new Map,this.platformIsServer=eu(u),this.defaultRenderer=new hr(r,a,c,this.platformIsServer)}createRenderer(r,i){if(!r||!i)return this.defaultRenderer;this.platformIsServer&&i.encapsulation===Re.ShadowDom&&(i=V(m({},i),{encapsulation:Re.Emulated}));let o=this.getOrCreateRenderer(r,i);return o instanceof ho?o.applyToHost(r):o instanceof pr&&o.applyStyles(),o}getOrCreateRenderer(r,i){let o=this.rendererByCompId,s=o.get(i.id);if(!s){let a=this.doc,u=this.ngZone,c=this.eventManager,l=this.sharedStylesHost,d=this.removeStylesOnCompDestroy,f=this.platformIsServer;switch(i.encapsulation){case Re.Emulated:s=new ho(c,l,i,this.appId,d,a,u,f);break;case Re.ShadowDom:return new du(c,l,r,i,a,u,this.nonce,f);default:s=new pr(c,l,i,d,a,u,f);break}o.set(i.id,s)}return s}ngOnDestroy(){this.rendererByCompId.clear()}};e.\u0275fac=function(i){return new(i||e)(I(eh),I(th),I(Ea),I(vC),I(ae),I(_e),I(H),I(Ia))},e.\u0275prov=w({token:e,factory:e.\u0275fac});let t=e;return t})(),hr=class{constructor(e,n,r,i){this.eventManager=e,this.doc=n,this.ngZone=r,this.platformIsServer=i,this.data=Object.create(null),this.throwOnSyntheticProps=!0,this.destroyNode=null}destroy(){}createElement(e,n){return n?this.doc.createElementNS(au[n]||n,e):this.doc.createElement(e)}createComment(e){return this.doc.createComment(e)}createText(e){return this.doc.createTextNode(e)}appendChild(e,n){(Jf(e)?e.content:e).appendChild(n)}insertBefore(e,n,r){e&&(Jf(e)?e.content:e).insertBefore(n,r)}removeChild(e,n){e&&e.removeChild(n)}selectRootElement(e,n){let r=typeof e=="string"?this.doc.querySelector(e):e;if(!r)throw new C(-5104,!1);return n||(r.textContent=""),r}parentNode(e){return e.parentNode}nextSibling(e){return e.nextSibling}setAttribute(e,n,r,i){if(i){n=i+":"+n;let o=au[i];o?e.setAttributeNS(o,n,r):e.setAttribute(n,r)}else e.setAttribute(n,r)}removeAttribute(e,n,r){if(r){let i=au[r];i?e.removeAttributeNS(i,n):e.removeAttribute(`${r}:${n}`)}else e.removeAttribute(n)}addClass(e,n){e.classList.add(n)}removeClass(e,n){e.classList.remove(n)}setStyle(e,n,r,i){i&(ze.DashCase|ze.Important)?e.style.setProperty(n,r,i&ze.Important?"important":""):e.style[n]=r}removeStyle(e,n,r){r&ze.DashCase?e.style.removeProperty(n):e.style[n]=""}setProperty(e,n,r){e!=null&&(e[n]=r)}setValue(e,n){e.nodeValue=n}listen(e,n,r){if(typeof e=="string"&&(e=Ke().getGlobalEventTarget(this.doc,e),!e))throw new Error(`Unsupported event target ${e} for event ${n}`);return this.eventManager.addEventListener(e,n,this.decoratePreventDefault(r))}decoratePreventDefault(e){return n=>{if(n==="__ngUnwrap__")return e;(this.platformIsServer?this.ngZone.runGuarded(()=>e(n)):e(n))===!1&&n.preventDefault()}}};function Jf(t){return t.tagName==="TEMPLATE"&&t.content!==void 0}var du=class extends hr{constructor(e,n,r,i,o,s,a,u){super(e,o,s,u),this.sharedStylesHost=n,this.hostEl=r,this.shadowRoot=r.attachShadow({mode:"open"}),this.sharedStylesHost.addHost(this.shadowRoot);let c=rh(i.id,i.styles);for(let l of c){let d=document.createElement("style");a&&d.setAttribute("nonce",a),d.textContent=l,this.shadowRoot.appendChild(d)}}nodeOrShadowRoot(e){return e===this.hostEl?this.shadowRoot:e}appendChild(e,n){return super.appendChild(this.nodeOrShadowRoot(e),n)}insertBefore(e,n,r){return super.insertBefore(this.nodeOrShadowRoot(e),n,r)}removeChild(e,n){return super.removeChild(this.nodeOrShadowRoot(e),n)}parentNode(e){return this.nodeOrShadowRoot(super.parentNode(this.nodeOrShadowRoot(e)))}destroy(){this.sharedStylesHost.removeHost(this.shadowRoot)}},pr=class extends hr{constructor(e,n,r,i,o,s,a,u){super(e,o,s,a),this.sharedStylesHost=n,this.removeStylesOnCompDestroy=i,this.styles=u?rh(u,r.styles):r.styles}applyStyles(){this.sharedStylesHost.addStyles(this.styles)}destroy(){this.removeStylesOnCompDestroy&&this.sharedStylesHost.removeStyles(this.styles)}},ho=class extends pr{constructor(e,n,r,i,o,s,a,u){let c=i+"-"+r.id;super(e,n,r,o,s,a,u,c),this.contentAttr=yC(c),this.hostAttr=DC(c)}applyToHost(e){this.applyStyles(),this.setAttribute(e,this.hostAttr,"")}createElement(e,n){let r=super.createElement(e,n);return super.setAttribute(r,this.contentAttr,""),r}},CC=(()=>{let e=class e extends fo{constructor(r){super(r)}supports(r){return!0}addEventListener(r,i,o){return r.addEventListener(i,o,!1),()=>this.removeEventListener(r,i,o)}removeEventListener(r,i,o){return r.removeEventListener(i,o)}};e.\u0275fac=function(i){return new(i||e)(I(ae))},e.\u0275prov=w({token:e,factory:e.\u0275fac});let t=e;return t})(),Xf=["alt","control","meta","shift"],wC={"\b":"Backspace","	":"Tab","\x7F":"Delete","\x1B":"Escape",Del:"Delete",Esc:"Escape",Left:"ArrowLeft",Right:"ArrowRight",Up:"ArrowUp",Down:"ArrowDown",Menu:"ContextMenu",Scroll:"ScrollLock",Win:"OS"},EC={alt:t=>t.altKey,control:t=>t.ctrlKey,meta:t=>t.metaKey,shift:t=>t.shiftKey},bC=(()=>{let e=class e extends fo{constructor(r){super(r)}supports(r){return e.parseEventName(r)!=null}addEventListener(r,i,o){let s=e.parseEventName(i),a=e.eventCallback(s.fullKey,o,this.manager.getZone());return this.manager.getZone().runOutsideAngular(()=>Ke().onAndCancel(r,s.domEventName,a))}static parseEventName(r){let i=r.toLowerCase().split("."),o=i.shift();if(i.length===0||!(o==="keydown"||o==="keyup"))return null;let s=e._normalizeKey(i.pop()),a="",u=i.indexOf("code");if(u>-1&&(i.splice(u,1),a="code."),Xf.forEach(l=>{let d=i.indexOf(l);d>-1&&(i.splice(d,1),a+=l+".")}),a+=s,i.length!=0||s.length===0)return null;let c={};return c.domEventName=o,c.fullKey=a,c}static matchEventFullKeyCode(r,i){let o=wC[r.key]||r.key,s="";return i.indexOf("code.")>-1&&(o=r.code,s="code."),o==null||!o?!1:(o=o.toLowerCase(),o===" "?o="space":o==="."&&(o="dot"),Xf.forEach(a=>{if(a!==o){let u=EC[a];u(r)&&(s+=a+".")}}),s+=o,s===i)}static eventCallback(r,i,o){return s=>{e.matchEventFullKeyCode(s,r)&&o.runGuarded(()=>i(s))}}static _normalizeKey(r){return r==="esc"?"escape":r}};e.\u0275fac=function(i){return new(i||e)(I(ae))},e.\u0275prov=w({token:e,factory:e.\u0275fac});let t=e;return t})();function ih(t,e){return Of(m({rootComponent:t},IC(e)))}function IC(t){return{appProviders:[...AC,...t?.providers??[]],platformProviders:TC}}function MC(){cu.makeCurrent()}function _C(){return new Ge}function SC(){return jd(document),document}var TC=[{provide:_e,useValue:Ja},{provide:ba,useValue:MC,multi:!0},{provide:ae,useFactory:SC,deps:[]}];var AC=[{provide:qi,useValue:"root"},{provide:Ge,useFactory:_C,deps:[]},{provide:lu,useClass:CC,multi:!0,deps:[ae,H,_e]},{provide:lu,useClass:bC,multi:!0,deps:[ae]},Kf,th,eh,{provide:Qn,useExisting:Kf},{provide:In,useClass:hC,deps:[]},[]];function xC(){return new hu(I(ae))}var hu=(()=>{let e=class e{constructor(r){this._doc=r}getTitle(){return this._doc.title}setTitle(r){this._doc.title=r||""}};e.\u0275fac=function(i){return new(i||e)(I(ae))},e.\u0275prov=w({token:e,factory:function(i){let o=null;return i?o=new i:o=xC(),o},providedIn:"root"});let t=e;return t})();var x="primary",Ar=Symbol("RouteTitle"),yu=class{constructor(e){this.params=e||{}}has(e){return Object.prototype.hasOwnProperty.call(this.params,e)}get(e){if(this.has(e)){let n=this.params[e];return Array.isArray(n)?n[0]:n}return null}getAll(e){if(this.has(e)){let n=this.params[e];return Array.isArray(n)?n:[n]}return[]}get keys(){return Object.keys(this.params)}};function xn(t){return new yu(t)}function RC(t,e,n){let r=n.path.split("/");if(r.length>t.length||n.pathMatch==="full"&&(e.hasChildren()||r.length<t.length))return null;let i={};for(let o=0;o<r.length;o++){let s=r[o],a=t[o];if(s.startsWith(":"))i[s.substring(1)]=a;else if(s!==a.path)return null}return{consumed:t.slice(0,r.length),posParams:i}}function PC(t,e){if(t.length!==e.length)return!1;for(let n=0;n<t.length;++n)if(!Ve(t[n],e[n]))return!1;return!0}function Ve(t,e){let n=t?Du(t):void 0,r=e?Du(e):void 0;if(!n||!r||n.length!=r.length)return!1;let i;for(let o=0;o<n.length;o++)if(i=n[o],!lh(t[i],e[i]))return!1;return!0}function Du(t){return[...Object.keys(t),...Object.getOwnPropertySymbols(t)]}function lh(t,e){if(Array.isArray(t)&&Array.isArray(e)){if(t.length!==e.length)return!1;let n=[...t].sort(),r=[...e].sort();return n.every((i,o)=>r[o]===i)}else return t===e}function dh(t){return t.length>0?t[t.length-1]:null}function yt(t){return Jo(t)?t:jt(t)?j(Promise.resolve(t)):D(t)}var FC={exact:hh,subset:ph},fh={exact:kC,subset:LC,ignored:()=>!0};function oh(t,e,n){return FC[n.paths](t.root,e.root,n.matrixParams)&&fh[n.queryParams](t.queryParams,e.queryParams)&&!(n.fragment==="exact"&&t.fragment!==e.fragment)}function kC(t,e){return Ve(t,e)}function hh(t,e,n){if(!zt(t.segments,e.segments)||!mo(t.segments,e.segments,n)||t.numberOfChildren!==e.numberOfChildren)return!1;for(let r in e.children)if(!t.children[r]||!hh(t.children[r],e.children[r],n))return!1;return!0}function LC(t,e){return Object.keys(e).length<=Object.keys(t).length&&Object.keys(e).every(n=>lh(t[n],e[n]))}function ph(t,e,n){return gh(t,e,e.segments,n)}function gh(t,e,n,r){if(t.segments.length>n.length){let i=t.segments.slice(0,n.length);return!(!zt(i,n)||e.hasChildren()||!mo(i,n,r))}else if(t.segments.length===n.length){if(!zt(t.segments,n)||!mo(t.segments,n,r))return!1;for(let i in e.children)if(!t.children[i]||!ph(t.children[i],e.children[i],r))return!1;return!0}else{let i=n.slice(0,t.segments.length),o=n.slice(t.segments.length);return!zt(t.segments,i)||!mo(t.segments,i,r)||!t.children[x]?!1:gh(t.children[x],e,o,r)}}function mo(t,e,n){return e.every((r,i)=>fh[n](t[i].parameters,r.parameters))}var mt=class{constructor(e=new k([],{}),n={},r=null){this.root=e,this.queryParams=n,this.fragment=r}get queryParamMap(){return this._queryParamMap||(this._queryParamMap=xn(this.queryParams)),this._queryParamMap}toString(){return $C.serialize(this)}},k=class{constructor(e,n){this.segments=e,this.children=n,this.parent=null,Object.values(n).forEach(r=>r.parent=this)}hasChildren(){return this.numberOfChildren>0}get numberOfChildren(){return Object.keys(this.children).length}toString(){return vo(this)}},Ht=class{constructor(e,n){this.path=e,this.parameters=n}get parameterMap(){return this._parameterMap||(this._parameterMap=xn(this.parameters)),this._parameterMap}toString(){return vh(this)}};function VC(t,e){return zt(t,e)&&t.every((n,r)=>Ve(n.parameters,e[r].parameters))}function zt(t,e){return t.length!==e.length?!1:t.every((n,r)=>n.path===e[r].path)}function jC(t,e){let n=[];return Object.entries(t.children).forEach(([r,i])=>{r===x&&(n=n.concat(e(i,r)))}),Object.entries(t.children).forEach(([r,i])=>{r!==x&&(n=n.concat(e(i,r)))}),n}var zu=(()=>{let e=class e{};e.\u0275fac=function(i){return new(i||e)},e.\u0275prov=w({token:e,factory:()=>(()=>new Do)(),providedIn:"root"});let t=e;return t})(),Do=class{parse(e){let n=new wu(e);return new mt(n.parseRootSegment(),n.parseQueryParams(),n.parseFragment())}serialize(e){let n=`/${gr(e.root,!0)}`,r=HC(e.queryParams),i=typeof e.fragment=="string"?`#${UC(e.fragment)}`:"";return`${n}${r}${i}`}},$C=new Do;function vo(t){return t.segments.map(e=>vh(e)).join("/")}function gr(t,e){if(!t.hasChildren())return vo(t);if(e){let n=t.children[x]?gr(t.children[x],!1):"",r=[];return Object.entries(t.children).forEach(([i,o])=>{i!==x&&r.push(`${i}:${gr(o,!1)}`)}),r.length>0?`${n}(${r.join("//")})`:n}else{let n=jC(t,(r,i)=>i===x?[gr(t.children[x],!1)]:[`${i}:${gr(r,!1)}`]);return Object.keys(t.children).length===1&&t.children[x]!=null?`${vo(t)}/${n[0]}`:`${vo(t)}/(${n.join("//")})`}}function mh(t){return encodeURIComponent(t).replace(/%40/g,"@").replace(/%3A/gi,":").replace(/%24/g,"$").replace(/%2C/gi,",")}function po(t){return mh(t).replace(/%3B/gi,";")}function UC(t){return encodeURI(t)}function Cu(t){return mh(t).replace(/\(/g,"%28").replace(/\)/g,"%29").replace(/%26/gi,"&")}function yo(t){return decodeURIComponent(t)}function sh(t){return yo(t.replace(/\+/g,"%20"))}function vh(t){return`${Cu(t.path)}${BC(t.parameters)}`}function BC(t){return Object.keys(t).map(e=>`;${Cu(e)}=${Cu(t[e])}`).join("")}function HC(t){let e=Object.keys(t).map(n=>{let r=t[n];return Array.isArray(r)?r.map(i=>`${po(n)}=${po(i)}`).join("&"):`${po(n)}=${po(r)}`}).filter(n=>!!n);return e.length?`?${e.join("&")}`:""}var zC=/^[^\/()?;#]+/;function pu(t){let e=t.match(zC);return e?e[0]:""}var GC=/^[^\/()?;=#]+/;function WC(t){let e=t.match(GC);return e?e[0]:""}var qC=/^[^=?&#]+/;function ZC(t){let e=t.match(qC);return e?e[0]:""}var YC=/^[^&#]+/;function QC(t){let e=t.match(YC);return e?e[0]:""}var wu=class{constructor(e){this.url=e,this.remaining=e}parseRootSegment(){return this.consumeOptional("/"),this.remaining===""||this.peekStartsWith("?")||this.peekStartsWith("#")?new k([],{}):new k([],this.parseChildren())}parseQueryParams(){let e={};if(this.consumeOptional("?"))do this.parseQueryParam(e);while(this.consumeOptional("&"));return e}parseFragment(){return this.consumeOptional("#")?decodeURIComponent(this.remaining):null}parseChildren(){if(this.remaining==="")return{};this.consumeOptional("/");let e=[];for(this.peekStartsWith("(")||e.push(this.parseSegment());this.peekStartsWith("/")&&!this.peekStartsWith("//")&&!this.peekStartsWith("/(");)this.capture("/"),e.push(this.parseSegment());let n={};this.peekStartsWith("/(")&&(this.capture("/"),n=this.parseParens(!0));let r={};return this.peekStartsWith("(")&&(r=this.parseParens(!1)),(e.length>0||Object.keys(n).length>0)&&(r[x]=new k(e,n)),r}parseSegment(){let e=pu(this.remaining);if(e===""&&this.peekStartsWith(";"))throw new C(4009,!1);return this.capture(e),new Ht(yo(e),this.parseMatrixParams())}parseMatrixParams(){let e={};for(;this.consumeOptional(";");)this.parseParam(e);return e}parseParam(e){let n=WC(this.remaining);if(!n)return;this.capture(n);let r="";if(this.consumeOptional("=")){let i=pu(this.remaining);i&&(r=i,this.capture(r))}e[yo(n)]=yo(r)}parseQueryParam(e){let n=ZC(this.remaining);if(!n)return;this.capture(n);let r="";if(this.consumeOptional("=")){let s=QC(this.remaining);s&&(r=s,this.capture(r))}let i=sh(n),o=sh(r);if(e.hasOwnProperty(i)){let s=e[i];Array.isArray(s)||(s=[s],e[i]=s),s.push(o)}else e[i]=o}parseParens(e){let n={};for(this.capture("(");!this.consumeOptional(")")&&this.remaining.length>0;){let r=pu(this.remaining),i=this.remaining[r.length];if(i!=="/"&&i!==")"&&i!==";")throw new C(4010,!1);let o;r.indexOf(":")>-1?(o=r.slice(0,r.indexOf(":")),this.capture(o),this.capture(":")):e&&(o=x);let s=this.parseChildren();n[o]=Object.keys(s).length===1?s[x]:new k([],s),this.consumeOptional("//")}return n}peekStartsWith(e){return this.remaining.startsWith(e)}consumeOptional(e){return this.peekStartsWith(e)?(this.remaining=this.remaining.substring(e.length),!0):!1}capture(e){if(!this.consumeOptional(e))throw new C(4011,!1)}};function yh(t){return t.segments.length>0?new k([],{[x]:t}):t}function Dh(t){let e={};for(let r of Object.keys(t.children)){let i=t.children[r],o=Dh(i);if(r===x&&o.segments.length===0&&o.hasChildren())for(let[s,a]of Object.entries(o.children))e[s]=a;else(o.segments.length>0||o.hasChildren())&&(e[r]=o)}let n=new k(t.segments,e);return KC(n)}function KC(t){if(t.numberOfChildren===1&&t.children[x]){let e=t.children[x];return new k(t.segments.concat(e.segments),e.children)}return t}function Nn(t){return t instanceof mt}function JC(t,e,n=null,r=null){let i=Ch(t);return wh(i,e,n,r)}function Ch(t){let e;function n(o){let s={};for(let u of o.children){let c=n(u);s[u.outlet]=c}let a=new k(o.url,s);return o===t&&(e=a),a}let r=n(t.root),i=yh(r);return e??i}function wh(t,e,n,r){let i=t;for(;i.parent;)i=i.parent;if(e.length===0)return gu(i,i,i,n,r);let o=XC(e);if(o.toRoot())return gu(i,i,new k([],{}),n,r);let s=ew(o,i,t),a=s.processChildren?yr(s.segmentGroup,s.index,o.commands):bh(s.segmentGroup,s.index,o.commands);return gu(i,s.segmentGroup,a,n,r)}function Co(t){return typeof t=="object"&&t!=null&&!t.outlets&&!t.segmentPath}function wr(t){return typeof t=="object"&&t!=null&&t.outlets}function gu(t,e,n,r,i){let o={};r&&Object.entries(r).forEach(([u,c])=>{o[u]=Array.isArray(c)?c.map(l=>`${l}`):`${c}`});let s;t===e?s=n:s=Eh(t,e,n);let a=yh(Dh(s));return new mt(a,o,i)}function Eh(t,e,n){let r={};return Object.entries(t.children).forEach(([i,o])=>{o===e?r[i]=n:r[i]=Eh(o,e,n)}),new k(t.segments,r)}var wo=class{constructor(e,n,r){if(this.isAbsolute=e,this.numberOfDoubleDots=n,this.commands=r,e&&r.length>0&&Co(r[0]))throw new C(4003,!1);let i=r.find(wr);if(i&&i!==dh(r))throw new C(4004,!1)}toRoot(){return this.isAbsolute&&this.commands.length===1&&this.commands[0]=="/"}};function XC(t){if(typeof t[0]=="string"&&t.length===1&&t[0]==="/")return new wo(!0,0,t);let e=0,n=!1,r=t.reduce((i,o,s)=>{if(typeof o=="object"&&o!=null){if(o.outlets){let a={};return Object.entries(o.outlets).forEach(([u,c])=>{a[u]=typeof c=="string"?c.split("/"):c}),[...i,{outlets:a}]}if(o.segmentPath)return[...i,o.segmentPath]}return typeof o!="string"?[...i,o]:s===0?(o.split("/").forEach((a,u)=>{u==0&&a==="."||(u==0&&a===""?n=!0:a===".."?e++:a!=""&&i.push(a))}),i):[...i,o]},[]);return new wo(n,e,r)}var Tn=class{constructor(e,n,r){this.segmentGroup=e,this.processChildren=n,this.index=r}};function ew(t,e,n){if(t.isAbsolute)return new Tn(e,!0,0);if(!n)return new Tn(e,!1,NaN);if(n.parent===null)return new Tn(n,!0,0);let r=Co(t.commands[0])?0:1,i=n.segments.length-1+r;return tw(n,i,t.numberOfDoubleDots)}function tw(t,e,n){let r=t,i=e,o=n;for(;o>i;){if(o-=i,r=r.parent,!r)throw new C(4005,!1);i=r.segments.length}return new Tn(r,!1,i-o)}function nw(t){return wr(t[0])?t[0].outlets:{[x]:t}}function bh(t,e,n){if(t||(t=new k([],{})),t.segments.length===0&&t.hasChildren())return yr(t,e,n);let r=rw(t,e,n),i=n.slice(r.commandIndex);if(r.match&&r.pathIndex<t.segments.length){let o=new k(t.segments.slice(0,r.pathIndex),{});return o.children[x]=new k(t.segments.slice(r.pathIndex),t.children),yr(o,0,i)}else return r.match&&i.length===0?new k(t.segments,{}):r.match&&!t.hasChildren()?Eu(t,e,n):r.match?yr(t,0,i):Eu(t,e,n)}function yr(t,e,n){if(n.length===0)return new k(t.segments,{});{let r=nw(n),i={};if(Object.keys(r).some(o=>o!==x)&&t.children[x]&&t.numberOfChildren===1&&t.children[x].segments.length===0){let o=yr(t.children[x],e,n);return new k(t.segments,o.children)}return Object.entries(r).forEach(([o,s])=>{typeof s=="string"&&(s=[s]),s!==null&&(i[o]=bh(t.children[o],e,s))}),Object.entries(t.children).forEach(([o,s])=>{r[o]===void 0&&(i[o]=s)}),new k(t.segments,i)}}function rw(t,e,n){let r=0,i=e,o={match:!1,pathIndex:0,commandIndex:0};for(;i<t.segments.length;){if(r>=n.length)return o;let s=t.segments[i],a=n[r];if(wr(a))break;let u=`${a}`,c=r<n.length-1?n[r+1]:null;if(i>0&&u===void 0)break;if(u&&c&&typeof c=="object"&&c.outlets===void 0){if(!uh(u,c,s))return o;r+=2}else{if(!uh(u,{},s))return o;r++}i++}return{match:!0,pathIndex:i,commandIndex:r}}function Eu(t,e,n){let r=t.segments.slice(0,e),i=0;for(;i<n.length;){let o=n[i];if(wr(o)){let u=iw(o.outlets);return new k(r,u)}if(i===0&&Co(n[0])){let u=t.segments[e];r.push(new Ht(u.path,ah(n[0]))),i++;continue}let s=wr(o)?o.outlets[x]:`${o}`,a=i<n.length-1?n[i+1]:null;s&&a&&Co(a)?(r.push(new Ht(s,ah(a))),i+=2):(r.push(new Ht(s,{})),i++)}return new k(r,{})}function iw(t){let e={};return Object.entries(t).forEach(([n,r])=>{typeof r=="string"&&(r=[r]),r!==null&&(e[n]=Eu(new k([],{}),0,r))}),e}function ah(t){let e={};return Object.entries(t).forEach(([n,r])=>e[n]=`${r}`),e}function uh(t,e,n){return t==n.path&&Ve(e,n.parameters)}var Dr="imperative",ve=class{constructor(e,n){this.id=e,this.url=n}},Er=class extends ve{constructor(e,n,r="imperative",i=null){super(e,n),this.type=0,this.navigationTrigger=r,this.restoredState=i}toString(){return`NavigationStart(id: ${this.id}, url: '${this.url}')`}},Gt=class extends ve{constructor(e,n,r){super(e,n),this.urlAfterRedirects=r,this.type=1}toString(){return`NavigationEnd(id: ${this.id}, url: '${this.url}', urlAfterRedirects: '${this.urlAfterRedirects}')`}},vt=class extends ve{constructor(e,n,r,i){super(e,n),this.reason=r,this.code=i,this.type=2}toString(){return`NavigationCancel(id: ${this.id}, url: '${this.url}')`}},Wt=class extends ve{constructor(e,n,r,i){super(e,n),this.reason=r,this.code=i,this.type=16}},br=class extends ve{constructor(e,n,r,i){super(e,n),this.error=r,this.target=i,this.type=3}toString(){return`NavigationError(id: ${this.id}, url: '${this.url}', error: ${this.error})`}},Eo=class extends ve{constructor(e,n,r,i){super(e,n),this.urlAfterRedirects=r,this.state=i,this.type=4}toString(){return`RoutesRecognized(id: ${this.id}, url: '${this.url}', urlAfterRedirects: '${this.urlAfterRedirects}', state: ${this.state})`}},bu=class extends ve{constructor(e,n,r,i){super(e,n),this.urlAfterRedirects=r,this.state=i,this.type=7}toString(){return`GuardsCheckStart(id: ${this.id}, url: '${this.url}', urlAfterRedirects: '${this.urlAfterRedirects}', state: ${this.state})`}},Iu=class extends ve{constructor(e,n,r,i,o){super(e,n),this.urlAfterRedirects=r,this.state=i,this.shouldActivate=o,this.type=8}toString(){return`GuardsCheckEnd(id: ${this.id}, url: '${this.url}', urlAfterRedirects: '${this.urlAfterRedirects}', state: ${this.state}, shouldActivate: ${this.shouldActivate})`}},Mu=class extends ve{constructor(e,n,r,i){super(e,n),this.urlAfterRedirects=r,this.state=i,this.type=5}toString(){return`ResolveStart(id: ${this.id}, url: '${this.url}', urlAfterRedirects: '${this.urlAfterRedirects}', state: ${this.state})`}},_u=class extends ve{constructor(e,n,r,i){super(e,n),this.urlAfterRedirects=r,this.state=i,this.type=6}toString(){return`ResolveEnd(id: ${this.id}, url: '${this.url}', urlAfterRedirects: '${this.urlAfterRedirects}', state: ${this.state})`}},Su=class{constructor(e){this.route=e,this.type=9}toString(){return`RouteConfigLoadStart(path: ${this.route.path})`}},Tu=class{constructor(e){this.route=e,this.type=10}toString(){return`RouteConfigLoadEnd(path: ${this.route.path})`}},Au=class{constructor(e){this.snapshot=e,this.type=11}toString(){return`ChildActivationStart(path: '${this.snapshot.routeConfig&&this.snapshot.routeConfig.path||""}')`}},xu=class{constructor(e){this.snapshot=e,this.type=12}toString(){return`ChildActivationEnd(path: '${this.snapshot.routeConfig&&this.snapshot.routeConfig.path||""}')`}},Nu=class{constructor(e){this.snapshot=e,this.type=13}toString(){return`ActivationStart(path: '${this.snapshot.routeConfig&&this.snapshot.routeConfig.path||""}')`}},Ou=class{constructor(e){this.snapshot=e,this.type=14}toString(){return`ActivationEnd(path: '${this.snapshot.routeConfig&&this.snapshot.routeConfig.path||""}')`}};var Ir=class{},Mr=class{constructor(e){this.url=e}};var Ru=class{constructor(){this.outlet=null,this.route=null,this.injector=null,this.children=new To,this.attachRef=null}},To=(()=>{let e=class e{constructor(){this.contexts=new Map}onChildOutletCreated(r,i){let o=this.getOrCreateContext(r);o.outlet=i,this.contexts.set(r,o)}onChildOutletDestroyed(r){let i=this.getContext(r);i&&(i.outlet=null,i.attachRef=null)}onOutletDeactivated(){let r=this.contexts;return this.contexts=new Map,r}onOutletReAttached(r){this.contexts=r}getOrCreateContext(r){let i=this.getContext(r);return i||(i=new Ru,this.contexts.set(r,i)),i}getContext(r){return this.contexts.get(r)||null}};e.\u0275fac=function(i){return new(i||e)},e.\u0275prov=w({token:e,factory:e.\u0275fac,providedIn:"root"});let t=e;return t})(),bo=class{constructor(e){this._root=e}get root(){return this._root.value}parent(e){let n=this.pathFromRoot(e);return n.length>1?n[n.length-2]:null}children(e){let n=Pu(e,this._root);return n?n.children.map(r=>r.value):[]}firstChild(e){let n=Pu(e,this._root);return n&&n.children.length>0?n.children[0].value:null}siblings(e){let n=Fu(e,this._root);return n.length<2?[]:n[n.length-2].children.map(i=>i.value).filter(i=>i!==e)}pathFromRoot(e){return Fu(e,this._root).map(n=>n.value)}};function Pu(t,e){if(t===e.value)return e;for(let n of e.children){let r=Pu(t,n);if(r)return r}return null}function Fu(t,e){if(t===e.value)return[e];for(let n of e.children){let r=Fu(t,n);if(r.length)return r.unshift(e),r}return[]}var he=class{constructor(e,n){this.value=e,this.children=n}toString(){return`TreeNode(${this.value})`}};function Sn(t){let e={};return t&&t.children.forEach(n=>e[n.value.outlet]=n),e}var Io=class extends bo{constructor(e,n){super(e),this.snapshot=n,Wu(this,e)}toString(){return this.snapshot.toString()}};function Ih(t,e){let n=ow(t,e),r=new ee([new Ht("",{})]),i=new ee({}),o=new ee({}),s=new ee({}),a=new ee(""),u=new On(r,i,s,a,o,x,e,n.root);return u.snapshot=n.root,new Io(new he(u,[]),n)}function ow(t,e){let n={},r={},i={},o="",s=new _r([],n,i,o,r,x,e,null,{});return new Mo("",new he(s,[]))}var On=class{constructor(e,n,r,i,o,s,a,u){this.urlSubject=e,this.paramsSubject=n,this.queryParamsSubject=r,this.fragmentSubject=i,this.dataSubject=o,this.outlet=s,this.component=a,this._futureSnapshot=u,this.title=this.dataSubject?.pipe(M(c=>c[Ar]))??D(void 0),this.url=e,this.params=n,this.queryParams=r,this.fragment=i,this.data=o}get routeConfig(){return this._futureSnapshot.routeConfig}get root(){return this._routerState.root}get parent(){return this._routerState.parent(this)}get firstChild(){return this._routerState.firstChild(this)}get children(){return this._routerState.children(this)}get pathFromRoot(){return this._routerState.pathFromRoot(this)}get paramMap(){return this._paramMap||(this._paramMap=this.params.pipe(M(e=>xn(e)))),this._paramMap}get queryParamMap(){return this._queryParamMap||(this._queryParamMap=this.queryParams.pipe(M(e=>xn(e)))),this._queryParamMap}toString(){return this.snapshot?this.snapshot.toString():`Future(${this._futureSnapshot})`}};function Gu(t,e,n="emptyOnly"){let r,{routeConfig:i}=t;return e!==null&&(n==="always"||i?.path===""||!e.component&&!e.routeConfig?.loadComponent)?r={params:m(m({},e.params),t.params),data:m(m({},e.data),t.data),resolve:m(m(m(m({},t.data),e.data),i?.data),t._resolvedData)}:r={params:t.params,data:t.data,resolve:m(m({},t.data),t._resolvedData??{})},i&&_h(i)&&(r.resolve[Ar]=i.title),r}var _r=class{get title(){return this.data?.[Ar]}constructor(e,n,r,i,o,s,a,u,c){this.url=e,this.params=n,this.queryParams=r,this.fragment=i,this.data=o,this.outlet=s,this.component=a,this.routeConfig=u,this._resolve=c}get root(){return this._routerState.root}get parent(){return this._routerState.parent(this)}get firstChild(){return this._routerState.firstChild(this)}get children(){return this._routerState.children(this)}get pathFromRoot(){return this._routerState.pathFromRoot(this)}get paramMap(){return this._paramMap||(this._paramMap=xn(this.params)),this._paramMap}get queryParamMap(){return this._queryParamMap||(this._queryParamMap=xn(this.queryParams)),this._queryParamMap}toString(){let e=this.url.map(r=>r.toString()).join("/"),n=this.routeConfig?this.routeConfig.path:"";return`Route(url:'${e}', path:'${n}')`}},Mo=class extends bo{constructor(e,n){super(n),this.url=e,Wu(this,n)}toString(){return Mh(this._root)}};function Wu(t,e){e.value._routerState=t,e.children.forEach(n=>Wu(t,n))}function Mh(t){let e=t.children.length>0?` { ${t.children.map(Mh).join(", ")} } `:"";return`${t.value}${e}`}function mu(t){if(t.snapshot){let e=t.snapshot,n=t._futureSnapshot;t.snapshot=n,Ve(e.queryParams,n.queryParams)||t.queryParamsSubject.next(n.queryParams),e.fragment!==n.fragment&&t.fragmentSubject.next(n.fragment),Ve(e.params,n.params)||t.paramsSubject.next(n.params),PC(e.url,n.url)||t.urlSubject.next(n.url),Ve(e.data,n.data)||t.dataSubject.next(n.data)}else t.snapshot=t._futureSnapshot,t.dataSubject.next(t._futureSnapshot.data)}function ku(t,e){let n=Ve(t.params,e.params)&&VC(t.url,e.url),r=!t.parent!=!e.parent;return n&&!r&&(!t.parent||ku(t.parent,e.parent))}function _h(t){return typeof t.title=="string"||t.title===null}var sw=(()=>{let e=class e{constructor(){this.activated=null,this._activatedRoute=null,this.name=x,this.activateEvents=new oe,this.deactivateEvents=new oe,this.attachEvents=new oe,this.detachEvents=new oe,this.parentContexts=p(To),this.location=p(Yi),this.changeDetector=p(En),this.environmentInjector=p(le),this.inputBinder=p(qu,{optional:!0}),this.supportsBindingToComponentInputs=!0}get activatedComponentRef(){return this.activated}ngOnChanges(r){if(r.name){let{firstChange:i,previousValue:o}=r.name;if(i)return;this.isTrackedInParentContexts(o)&&(this.deactivate(),this.parentContexts.onChildOutletDestroyed(o)),this.initializeOutletWithName()}}ngOnDestroy(){this.isTrackedInParentContexts(this.name)&&this.parentContexts.onChildOutletDestroyed(this.name),this.inputBinder?.unsubscribeFromRouteData(this)}isTrackedInParentContexts(r){return this.parentContexts.getContext(r)?.outlet===this}ngOnInit(){this.initializeOutletWithName()}initializeOutletWithName(){if(this.parentContexts.onChildOutletCreated(this.name,this),this.activated)return;let r=this.parentContexts.getContext(this.name);r?.route&&(r.attachRef?this.attach(r.attachRef,r.route):this.activateWith(r.route,r.injector))}get isActivated(){return!!this.activated}get component(){if(!this.activated)throw new C(4012,!1);return this.activated.instance}get activatedRoute(){if(!this.activated)throw new C(4012,!1);return this._activatedRoute}get activatedRouteData(){return this._activatedRoute?this._activatedRoute.snapshot.data:{}}detach(){if(!this.activated)throw new C(4012,!1);this.location.detach();let r=this.activated;return this.activated=null,this._activatedRoute=null,this.detachEvents.emit(r.instance),r}attach(r,i){this.activated=r,this._activatedRoute=i,this.location.insert(r.hostView),this.inputBinder?.bindActivatedRouteToOutletComponent(this),this.attachEvents.emit(r.instance)}deactivate(){if(this.activated){let r=this.component;this.activated.destroy(),this.activated=null,this._activatedRoute=null,this.deactivateEvents.emit(r)}}activateWith(r,i){if(this.isActivated)throw new C(4013,!1);this._activatedRoute=r;let o=this.location,a=r.snapshot.component,u=this.parentContexts.getOrCreateContext(this.name).children,c=new Lu(r,u,o.injector);this.activated=o.createComponent(a,{index:o.length,injector:c,environmentInjector:i??this.environmentInjector}),this.changeDetector.markForCheck(),this.inputBinder?.bindActivatedRouteToOutletComponent(this),this.activateEvents.emit(this.activated.instance)}};e.\u0275fac=function(i){return new(i||e)},e.\u0275dir=Ee({type:e,selectors:[["router-outlet"]],inputs:{name:"name"},outputs:{activateEvents:"activate",deactivateEvents:"deactivate",attachEvents:"attach",detachEvents:"detach"},exportAs:["outlet"],standalone:!0,features:[Cn]});let t=e;return t})(),Lu=class{constructor(e,n,r){this.route=e,this.childContexts=n,this.parent=r}get(e,n){return e===On?this.route:e===To?this.childContexts:this.parent.get(e,n)}},qu=new E("");function aw(t,e,n){let r=Sr(t,e._root,n?n._root:void 0);return new Io(r,e)}function Sr(t,e,n){if(n&&t.shouldReuseRoute(e.value,n.value.snapshot)){let r=n.value;r._futureSnapshot=e.value;let i=uw(t,e,n);return new he(r,i)}else{if(t.shouldAttach(e.value)){let o=t.retrieve(e.value);if(o!==null){let s=o.route;return s.value._futureSnapshot=e.value,s.children=e.children.map(a=>Sr(t,a)),s}}let r=cw(e.value),i=e.children.map(o=>Sr(t,o));return new he(r,i)}}function uw(t,e,n){return e.children.map(r=>{for(let i of n.children)if(t.shouldReuseRoute(r.value,i.value.snapshot))return Sr(t,r,i);return Sr(t,r)})}function cw(t){return new On(new ee(t.url),new ee(t.params),new ee(t.queryParams),new ee(t.fragment),new ee(t.data),t.outlet,t.component,t)}var Sh="ngNavigationCancelingError";function Th(t,e){let{redirectTo:n,navigationBehaviorOptions:r}=Nn(e)?{redirectTo:e,navigationBehaviorOptions:void 0}:e,i=Ah(!1,0,e);return i.url=n,i.navigationBehaviorOptions=r,i}function Ah(t,e,n){let r=new Error("NavigationCancelingError: "+(t||""));return r[Sh]=!0,r.cancellationCode=e,n&&(r.url=n),r}function lw(t){return xh(t)&&Nn(t.url)}function xh(t){return t&&t[Sh]}var dw=(()=>{let e=class e{};e.\u0275fac=function(i){return new(i||e)},e.\u0275cmp=Ui({type:e,selectors:[["ng-component"]],standalone:!0,features:[Ji],decls:1,vars:0,template:function(i,o){i&1&&Ha(0,"router-outlet")},dependencies:[sw],encapsulation:2});let t=e;return t})();function fw(t,e){return t.providers&&!t._injector&&(t._injector=Wa(t.providers,e,`Route: ${t.path}`)),t._injector??e}function Zu(t){let e=t.children&&t.children.map(Zu),n=e?V(m({},t),{children:e}):m({},t);return!n.component&&!n.loadComponent&&(e||n.loadChildren)&&n.outlet&&n.outlet!==x&&(n.component=dw),n}function je(t){return t.outlet||x}function hw(t,e){let n=t.filter(r=>je(r)===e);return n.push(...t.filter(r=>je(r)!==e)),n}function xr(t){if(!t)return null;if(t.routeConfig?._injector)return t.routeConfig._injector;for(let e=t.parent;e;e=e.parent){let n=e.routeConfig;if(n?._loadedInjector)return n._loadedInjector;if(n?._injector)return n._injector}return null}var pw=(t,e,n,r)=>M(i=>(new Vu(e,i.targetRouterState,i.currentRouterState,n,r).activate(t),i)),Vu=class{constructor(e,n,r,i,o){this.routeReuseStrategy=e,this.futureState=n,this.currState=r,this.forwardEvent=i,this.inputBindingEnabled=o}activate(e){let n=this.futureState._root,r=this.currState?this.currState._root:null;this.deactivateChildRoutes(n,r,e),mu(this.futureState.root),this.activateChildRoutes(n,r,e)}deactivateChildRoutes(e,n,r){let i=Sn(n);e.children.forEach(o=>{let s=o.value.outlet;this.deactivateRoutes(o,i[s],r),delete i[s]}),Object.values(i).forEach(o=>{this.deactivateRouteAndItsChildren(o,r)})}deactivateRoutes(e,n,r){let i=e.value,o=n?n.value:null;if(i===o)if(i.component){let s=r.getContext(i.outlet);s&&this.deactivateChildRoutes(e,n,s.children)}else this.deactivateChildRoutes(e,n,r);else o&&this.deactivateRouteAndItsChildren(n,r)}deactivateRouteAndItsChildren(e,n){e.value.component&&this.routeReuseStrategy.shouldDetach(e.value.snapshot)?this.detachAndStoreRouteSubtree(e,n):this.deactivateRouteAndOutlet(e,n)}detachAndStoreRouteSubtree(e,n){let r=n.getContext(e.value.outlet),i=r&&e.value.component?r.children:n,o=Sn(e);for(let s of Object.keys(o))this.deactivateRouteAndItsChildren(o[s],i);if(r&&r.outlet){let s=r.outlet.detach(),a=r.children.onOutletDeactivated();this.routeReuseStrategy.store(e.value.snapshot,{componentRef:s,route:e,contexts:a})}}deactivateRouteAndOutlet(e,n){let r=n.getContext(e.value.outlet),i=r&&e.value.component?r.children:n,o=Sn(e);for(let s of Object.keys(o))this.deactivateRouteAndItsChildren(o[s],i);r&&(r.outlet&&(r.outlet.deactivate(),r.children.onOutletDeactivated()),r.attachRef=null,r.route=null)}activateChildRoutes(e,n,r){let i=Sn(n);e.children.forEach(o=>{this.activateRoutes(o,i[o.value.outlet],r),this.forwardEvent(new Ou(o.value.snapshot))}),e.children.length&&this.forwardEvent(new xu(e.value.snapshot))}activateRoutes(e,n,r){let i=e.value,o=n?n.value:null;if(mu(i),i===o)if(i.component){let s=r.getOrCreateContext(i.outlet);this.activateChildRoutes(e,n,s.children)}else this.activateChildRoutes(e,n,r);else if(i.component){let s=r.getOrCreateContext(i.outlet);if(this.routeReuseStrategy.shouldAttach(i.snapshot)){let a=this.routeReuseStrategy.retrieve(i.snapshot);this.routeReuseStrategy.store(i.snapshot,null),s.children.onOutletReAttached(a.contexts),s.attachRef=a.componentRef,s.route=a.route.value,s.outlet&&s.outlet.attach(a.componentRef,a.route.value),mu(a.route.value),this.activateChildRoutes(e,null,s.children)}else{let a=xr(i.snapshot);s.attachRef=null,s.route=i,s.injector=a,s.outlet&&s.outlet.activateWith(i,s.injector),this.activateChildRoutes(e,null,s.children)}}else this.activateChildRoutes(e,null,r)}},_o=class{constructor(e){this.path=e,this.route=this.path[this.path.length-1]}},An=class{constructor(e,n){this.component=e,this.route=n}};function gw(t,e,n){let r=t._root,i=e?e._root:null;return mr(r,i,n,[r.value])}function mw(t){let e=t.routeConfig?t.routeConfig.canActivateChild:null;return!e||e.length===0?null:{node:t,guards:e}}function Pn(t,e){let n=Symbol(),r=e.get(t,n);return r===n?typeof t=="function"&&!Ol(t)?t:e.get(t):r}function mr(t,e,n,r,i={canDeactivateChecks:[],canActivateChecks:[]}){let o=Sn(e);return t.children.forEach(s=>{vw(s,o[s.value.outlet],n,r.concat([s.value]),i),delete o[s.value.outlet]}),Object.entries(o).forEach(([s,a])=>Cr(a,n.getContext(s),i)),i}function vw(t,e,n,r,i={canDeactivateChecks:[],canActivateChecks:[]}){let o=t.value,s=e?e.value:null,a=n?n.getContext(t.value.outlet):null;if(s&&o.routeConfig===s.routeConfig){let u=yw(s,o,o.routeConfig.runGuardsAndResolvers);u?i.canActivateChecks.push(new _o(r)):(o.data=s.data,o._resolvedData=s._resolvedData),o.component?mr(t,e,a?a.children:null,r,i):mr(t,e,n,r,i),u&&a&&a.outlet&&a.outlet.isActivated&&i.canDeactivateChecks.push(new An(a.outlet.component,s))}else s&&Cr(e,a,i),i.canActivateChecks.push(new _o(r)),o.component?mr(t,null,a?a.children:null,r,i):mr(t,null,n,r,i);return i}function yw(t,e,n){if(typeof n=="function")return n(t,e);switch(n){case"pathParamsChange":return!zt(t.url,e.url);case"pathParamsOrQueryParamsChange":return!zt(t.url,e.url)||!Ve(t.queryParams,e.queryParams);case"always":return!0;case"paramsOrQueryParamsChange":return!ku(t,e)||!Ve(t.queryParams,e.queryParams);case"paramsChange":default:return!ku(t,e)}}function Cr(t,e,n){let r=Sn(t),i=t.value;Object.entries(r).forEach(([o,s])=>{i.component?e?Cr(s,e.children.getContext(o),n):Cr(s,null,n):Cr(s,e,n)}),i.component?e&&e.outlet&&e.outlet.isActivated?n.canDeactivateChecks.push(new An(e.outlet.component,i)):n.canDeactivateChecks.push(new An(null,i)):n.canDeactivateChecks.push(new An(null,i))}function Nr(t){return typeof t=="function"}function Dw(t){return typeof t=="boolean"}function Cw(t){return t&&Nr(t.canLoad)}function ww(t){return t&&Nr(t.canActivate)}function Ew(t){return t&&Nr(t.canActivateChild)}function bw(t){return t&&Nr(t.canDeactivate)}function Iw(t){return t&&Nr(t.canMatch)}function Nh(t){return t instanceof Be||t?.name==="EmptyError"}var go=Symbol("INITIAL_VALUE");function Rn(){return Z(t=>ai(t.map(e=>e.pipe(Q(1),us(go)))).pipe(M(e=>{for(let n of e)if(n!==!0){if(n===go)return go;if(n===!1||n instanceof mt)return n}return!0}),Y(e=>e!==go),Q(1)))}function Mw(t,e){return B(n=>{let{targetSnapshot:r,currentSnapshot:i,guards:{canActivateChecks:o,canDeactivateChecks:s}}=n;return s.length===0&&o.length===0?D(V(m({},n),{guardsResult:!0})):_w(s,r,i,t).pipe(B(a=>a&&Dw(a)?Sw(r,o,t,e):D(a)),M(a=>V(m({},n),{guardsResult:a})))})}function _w(t,e,n,r){return j(t).pipe(B(i=>Ow(i.component,i.route,n,e,r)),xe(i=>i!==!0,!0))}function Sw(t,e,n,r){return j(e).pipe(nt(i=>Ae(Aw(i.route.parent,r),Tw(i.route,r),Nw(t,i.path,n),xw(t,i.route,n))),xe(i=>i!==!0,!0))}function Tw(t,e){return t!==null&&e&&e(new Nu(t)),D(!0)}function Aw(t,e){return t!==null&&e&&e(new Au(t)),D(!0)}function xw(t,e,n){let r=e.routeConfig?e.routeConfig.canActivate:null;if(!r||r.length===0)return D(!0);let i=r.map(o=>bt(()=>{let s=xr(e)??n,a=Pn(o,s),u=ww(a)?a.canActivate(e,t):Ze(s,()=>a(e,t));return yt(u).pipe(xe())}));return D(i).pipe(Rn())}function Nw(t,e,n){let r=e[e.length-1],o=e.slice(0,e.length-1).reverse().map(s=>mw(s)).filter(s=>s!==null).map(s=>bt(()=>{let a=s.guards.map(u=>{let c=xr(s.node)??n,l=Pn(u,c),d=Ew(l)?l.canActivateChild(r,t):Ze(c,()=>l(r,t));return yt(d).pipe(xe())});return D(a).pipe(Rn())}));return D(o).pipe(Rn())}function Ow(t,e,n,r,i){let o=e&&e.routeConfig?e.routeConfig.canDeactivate:null;if(!o||o.length===0)return D(!0);let s=o.map(a=>{let u=xr(e)??i,c=Pn(a,u),l=bw(c)?c.canDeactivate(t,e,n,r):Ze(u,()=>c(t,e,n,r));return yt(l).pipe(xe())});return D(s).pipe(Rn())}function Rw(t,e,n,r){let i=e.canLoad;if(i===void 0||i.length===0)return D(!0);let o=i.map(s=>{let a=Pn(s,t),u=Cw(a)?a.canLoad(e,n):Ze(t,()=>a(e,n));return yt(u)});return D(o).pipe(Rn(),Oh(r))}function Oh(t){return Go(W(e=>{if(Nn(e))throw Th(t,e)}),M(e=>e===!0))}function Pw(t,e,n,r){let i=e.canMatch;if(!i||i.length===0)return D(!0);let o=i.map(s=>{let a=Pn(s,t),u=Iw(a)?a.canMatch(e,n):Ze(t,()=>a(e,n));return yt(u)});return D(o).pipe(Rn(),Oh(r))}var Tr=class{constructor(e){this.segmentGroup=e||null}},So=class extends Error{constructor(e){super(),this.urlTree=e}};function _n(t){return et(new Tr(t))}function Fw(t){return et(new C(4e3,!1))}function kw(t){return et(Ah(!1,3))}var ju=class{constructor(e,n){this.urlSerializer=e,this.urlTree=n}lineralizeSegments(e,n){let r=[],i=n.root;for(;;){if(r=r.concat(i.segments),i.numberOfChildren===0)return D(r);if(i.numberOfChildren>1||!i.children[x])return Fw(e.redirectTo);i=i.children[x]}}applyRedirectCommands(e,n,r){let i=this.applyRedirectCreateUrlTree(n,this.urlSerializer.parse(n),e,r);if(n.startsWith("/"))throw new So(i);return i}applyRedirectCreateUrlTree(e,n,r,i){let o=this.createSegmentGroup(e,n.root,r,i);return new mt(o,this.createQueryParams(n.queryParams,this.urlTree.queryParams),n.fragment)}createQueryParams(e,n){let r={};return Object.entries(e).forEach(([i,o])=>{if(typeof o=="string"&&o.startsWith(":")){let a=o.substring(1);r[i]=n[a]}else r[i]=o}),r}createSegmentGroup(e,n,r,i){let o=this.createSegments(e,n.segments,r,i),s={};return Object.entries(n.children).forEach(([a,u])=>{s[a]=this.createSegmentGroup(e,u,r,i)}),new k(o,s)}createSegments(e,n,r,i){return n.map(o=>o.path.startsWith(":")?this.findPosParam(e,o,i):this.findOrReturn(o,r))}findPosParam(e,n,r){let i=r[n.path.substring(1)];if(!i)throw new C(4001,!1);return i}findOrReturn(e,n){let r=0;for(let i of n){if(i.path===e.path)return n.splice(r),i;r++}return e}},$u={matched:!1,consumedSegments:[],remainingSegments:[],parameters:{},positionalParamSegments:{}};function Lw(t,e,n,r,i){let o=Yu(t,e,n);return o.matched?(r=fw(e,r),Pw(r,e,n,i).pipe(M(s=>s===!0?o:m({},$u)))):D(o)}function Yu(t,e,n){if(e.path==="**")return Vw(n);if(e.path==="")return e.pathMatch==="full"&&(t.hasChildren()||n.length>0)?m({},$u):{matched:!0,consumedSegments:[],remainingSegments:n,parameters:{},positionalParamSegments:{}};let i=(e.matcher||RC)(n,t,e);if(!i)return m({},$u);let o={};Object.entries(i.posParams??{}).forEach(([a,u])=>{o[a]=u.path});let s=i.consumed.length>0?m(m({},o),i.consumed[i.consumed.length-1].parameters):o;return{matched:!0,consumedSegments:i.consumed,remainingSegments:n.slice(i.consumed.length),parameters:s,positionalParamSegments:i.posParams??{}}}function Vw(t){return{matched:!0,parameters:t.length>0?dh(t).parameters:{},consumedSegments:t,remainingSegments:[],positionalParamSegments:{}}}function ch(t,e,n,r){return n.length>0&&Uw(t,n,r)?{segmentGroup:new k(e,$w(r,new k(n,t.children))),slicedSegments:[]}:n.length===0&&Bw(t,n,r)?{segmentGroup:new k(t.segments,jw(t,e,n,r,t.children)),slicedSegments:n}:{segmentGroup:new k(t.segments,t.children),slicedSegments:n}}function jw(t,e,n,r,i){let o={};for(let s of r)if(Ao(t,n,s)&&!i[je(s)]){let a=new k([],{});o[je(s)]=a}return m(m({},i),o)}function $w(t,e){let n={};n[x]=e;for(let r of t)if(r.path===""&&je(r)!==x){let i=new k([],{});n[je(r)]=i}return n}function Uw(t,e,n){return n.some(r=>Ao(t,e,r)&&je(r)!==x)}function Bw(t,e,n){return n.some(r=>Ao(t,e,r))}function Ao(t,e,n){return(t.hasChildren()||e.length>0)&&n.pathMatch==="full"?!1:n.path===""}function Hw(t,e,n,r){return je(t)!==r&&(r===x||!Ao(e,n,t))?!1:Yu(e,t,n).matched}function zw(t,e,n){return e.length===0&&!t.children[n]}var Uu=class{};function Gw(t,e,n,r,i,o,s="emptyOnly"){return new Bu(t,e,n,r,i,s,o).recognize()}var Ww=31,Bu=class{constructor(e,n,r,i,o,s,a){this.injector=e,this.configLoader=n,this.rootComponentType=r,this.config=i,this.urlTree=o,this.paramsInheritanceStrategy=s,this.urlSerializer=a,this.applyRedirects=new ju(this.urlSerializer,this.urlTree),this.absoluteRedirectCount=0,this.allowRedirects=!0}noMatchError(e){return new C(4002,`'${e.segmentGroup}'`)}recognize(){let e=ch(this.urlTree.root,[],[],this.config).segmentGroup;return this.match(e).pipe(M(n=>{let r=new _r([],Object.freeze({}),Object.freeze(m({},this.urlTree.queryParams)),this.urlTree.fragment,{},x,this.rootComponentType,null,{}),i=new he(r,n),o=new Mo("",i),s=JC(r,[],this.urlTree.queryParams,this.urlTree.fragment);return s.queryParams=this.urlTree.queryParams,o.url=this.urlSerializer.serialize(s),this.inheritParamsAndData(o._root,null),{state:o,tree:s}}))}match(e){return this.processSegmentGroup(this.injector,this.config,e,x).pipe(tt(r=>{if(r instanceof So)return this.urlTree=r.urlTree,this.match(r.urlTree.root);throw r instanceof Tr?this.noMatchError(r):r}))}inheritParamsAndData(e,n){let r=e.value,i=Gu(r,n,this.paramsInheritanceStrategy);r.params=Object.freeze(i.params),r.data=Object.freeze(i.data),e.children.forEach(o=>this.inheritParamsAndData(o,r))}processSegmentGroup(e,n,r,i){return r.segments.length===0&&r.hasChildren()?this.processChildren(e,n,r):this.processSegment(e,n,r,r.segments,i,!0).pipe(M(o=>o instanceof he?[o]:[]))}processChildren(e,n,r){let i=[];for(let o of Object.keys(r.children))o==="primary"?i.unshift(o):i.push(o);return j(i).pipe(nt(o=>{let s=r.children[o],a=hw(n,o);return this.processSegmentGroup(e,a,s,o)}),os((o,s)=>(o.push(...s),o)),rt(null),rs(),B(o=>{if(o===null)return _n(r);let s=Rh(o);return qw(s),D(s)}))}processSegment(e,n,r,i,o,s){return j(n).pipe(nt(a=>this.processSegmentAgainstRoute(a._injector??e,n,a,r,i,o,s).pipe(tt(u=>{if(u instanceof Tr)return D(null);throw u}))),xe(a=>!!a),tt(a=>{if(Nh(a))return zw(r,i,o)?D(new Uu):_n(r);throw a}))}processSegmentAgainstRoute(e,n,r,i,o,s,a){return Hw(r,i,o,s)?r.redirectTo===void 0?this.matchSegmentAgainstRoute(e,i,r,o,s):this.allowRedirects&&a?this.expandSegmentAgainstRouteUsingRedirect(e,i,n,r,o,s):_n(i):_n(i)}expandSegmentAgainstRouteUsingRedirect(e,n,r,i,o,s){let{matched:a,consumedSegments:u,positionalParamSegments:c,remainingSegments:l}=Yu(n,i,o);if(!a)return _n(n);i.redirectTo.startsWith("/")&&(this.absoluteRedirectCount++,this.absoluteRedirectCount>Ww&&(this.allowRedirects=!1));let d=this.applyRedirects.applyRedirectCommands(u,i.redirectTo,c);return this.applyRedirects.lineralizeSegments(i,d).pipe(B(f=>this.processSegment(e,r,n,f.concat(l),s,!1)))}matchSegmentAgainstRoute(e,n,r,i,o){let s=Lw(n,r,i,e,this.urlSerializer);return r.path==="**"&&(n.children={}),s.pipe(Z(a=>a.matched?(e=r._injector??e,this.getChildConfig(e,r,i).pipe(Z(({routes:u})=>{let c=r._loadedInjector??e,{consumedSegments:l,remainingSegments:d,parameters:f}=a,h=new _r(l,f,Object.freeze(m({},this.urlTree.queryParams)),this.urlTree.fragment,Yw(r),je(r),r.component??r._loadedComponent??null,r,Qw(r)),{segmentGroup:g,slicedSegments:_}=ch(n,l,d,u);if(_.length===0&&g.hasChildren())return this.processChildren(c,u,g).pipe(M(v=>v===null?null:new he(h,v)));if(u.length===0&&_.length===0)return D(new he(h,[]));let b=je(r)===o;return this.processSegment(c,u,g,_,b?x:o,!0).pipe(M(v=>new he(h,v instanceof he?[v]:[])))}))):_n(n)))}getChildConfig(e,n,r){return n.children?D({routes:n.children,injector:e}):n.loadChildren?n._loadedRoutes!==void 0?D({routes:n._loadedRoutes,injector:n._loadedInjector}):Rw(e,n,r,this.urlSerializer).pipe(B(i=>i?this.configLoader.loadChildren(e,n).pipe(W(o=>{n._loadedRoutes=o.routes,n._loadedInjector=o.injector})):kw(n))):D({routes:[],injector:e})}};function qw(t){t.sort((e,n)=>e.value.outlet===x?-1:n.value.outlet===x?1:e.value.outlet.localeCompare(n.value.outlet))}function Zw(t){let e=t.value.routeConfig;return e&&e.path===""}function Rh(t){let e=[],n=new Set;for(let r of t){if(!Zw(r)){e.push(r);continue}let i=e.find(o=>r.value.routeConfig===o.value.routeConfig);i!==void 0?(i.children.push(...r.children),n.add(i)):e.push(r)}for(let r of n){let i=Rh(r.children);e.push(new he(r.value,i))}return e.filter(r=>!n.has(r))}function Yw(t){return t.data||{}}function Qw(t){return t.resolve||{}}function Kw(t,e,n,r,i,o){return B(s=>Gw(t,e,n,r,s.extractedUrl,i,o).pipe(M(({state:a,tree:u})=>V(m({},s),{targetSnapshot:a,urlAfterRedirects:u}))))}function Jw(t,e){return B(n=>{let{targetSnapshot:r,guards:{canActivateChecks:i}}=n;if(!i.length)return D(n);let o=new Set(i.map(u=>u.route)),s=new Set;for(let u of o)if(!s.has(u))for(let c of Ph(u))s.add(c);let a=0;return j(s).pipe(nt(u=>o.has(u)?Xw(u,r,t,e):(u.data=Gu(u,u.parent,t).resolve,D(void 0))),W(()=>a++),on(1),B(u=>a===s.size?D(n):ue))})}function Ph(t){let e=t.children.map(n=>Ph(n)).flat();return[t,...e]}function Xw(t,e,n,r){let i=t.routeConfig,o=t._resolve;return i?.title!==void 0&&!_h(i)&&(o[Ar]=i.title),eE(o,t,e,r).pipe(M(s=>(t._resolvedData=s,t.data=Gu(t,t.parent,n).resolve,null)))}function eE(t,e,n,r){let i=Du(t);if(i.length===0)return D({});let o={};return j(i).pipe(B(s=>tE(t[s],e,n,r).pipe(xe(),W(a=>{o[s]=a}))),on(1),jn(o),tt(s=>Nh(s)?ue:et(s)))}function tE(t,e,n,r){let i=xr(e)??r,o=Pn(t,i),s=o.resolve?o.resolve(e,n):Ze(i,()=>o(e,n));return yt(s)}function vu(t){return Z(e=>{let n=t(e);return n?j(n).pipe(M(()=>e)):D(e)})}var Fh=(()=>{let e=class e{buildTitle(r){let i,o=r.root;for(;o!==void 0;)i=this.getResolvedTitleForRoute(o)??i,o=o.children.find(s=>s.outlet===x);return i}getResolvedTitleForRoute(r){return r.data[Ar]}};e.\u0275fac=function(i){return new(i||e)},e.\u0275prov=w({token:e,factory:()=>(()=>p(nE))(),providedIn:"root"});let t=e;return t})(),nE=(()=>{let e=class e extends Fh{constructor(r){super(),this.title=r}updateTitle(r){let i=this.buildTitle(r);i!==void 0&&this.title.setTitle(i)}};e.\u0275fac=function(i){return new(i||e)(I(hu))},e.\u0275prov=w({token:e,factory:e.\u0275fac,providedIn:"root"});let t=e;return t})(),Qu=new E("",{providedIn:"root",factory:()=>({})}),Ku=new E("ROUTES"),rE=(()=>{let e=class e{constructor(){this.componentLoaders=new WeakMap,this.childrenLoaders=new WeakMap,this.compiler=p(qa)}loadComponent(r){if(this.componentLoaders.get(r))return this.componentLoaders.get(r);if(r._loadedComponent)return D(r._loadedComponent);this.onLoadStartListener&&this.onLoadStartListener(r);let i=yt(r.loadComponent()).pipe(M(kh),W(s=>{this.onLoadEndListener&&this.onLoadEndListener(r),r._loadedComponent=s}),Mt(()=>{this.componentLoaders.delete(r)})),o=new Xe(i,()=>new G).pipe(Jt());return this.componentLoaders.set(r,o),o}loadChildren(r,i){if(this.childrenLoaders.get(i))return this.childrenLoaders.get(i);if(i._loadedRoutes)return D({routes:i._loadedRoutes,injector:i._loadedInjector});this.onLoadStartListener&&this.onLoadStartListener(i);let s=iE(i,this.compiler,r,this.onLoadEndListener).pipe(Mt(()=>{this.childrenLoaders.delete(i)})),a=new Xe(s,()=>new G).pipe(Jt());return this.childrenLoaders.set(i,a),a}};e.\u0275fac=function(i){return new(i||e)},e.\u0275prov=w({token:e,factory:e.\u0275fac,providedIn:"root"});let t=e;return t})();function iE(t,e,n,r){return yt(t.loadChildren()).pipe(M(kh),B(i=>i instanceof er||Array.isArray(i)?D(i):j(e.compileModuleAsync(i))),M(i=>{r&&r(t);let o,s,a=!1;return Array.isArray(i)?(s=i,a=!0):(o=i.create(n).injector,s=o.get(Ku,[],{optional:!0,self:!0}).flat()),{routes:s.map(Zu),injector:o}}))}function oE(t){return t&&typeof t=="object"&&"default"in t}function kh(t){return oE(t)?t.default:t}var Ju=(()=>{let e=class e{};e.\u0275fac=function(i){return new(i||e)},e.\u0275prov=w({token:e,factory:()=>(()=>p(sE))(),providedIn:"root"});let t=e;return t})(),sE=(()=>{let e=class e{shouldProcessUrl(r){return!0}extract(r){return r}merge(r,i){return r}};e.\u0275fac=function(i){return new(i||e)},e.\u0275prov=w({token:e,factory:e.\u0275fac,providedIn:"root"});let t=e;return t})(),aE=new E("");var uE=(()=>{let e=class e{get hasRequestedNavigation(){return this.navigationId!==0}constructor(){this.currentNavigation=null,this.currentTransition=null,this.lastSuccessfulNavigation=null,this.events=new G,this.transitionAbortSubject=new G,this.configLoader=p(rE),this.environmentInjector=p(le),this.urlSerializer=p(zu),this.rootContexts=p(To),this.location=p(ur),this.inputBindingEnabled=p(qu,{optional:!0})!==null,this.titleStrategy=p(Fh),this.options=p(Qu,{optional:!0})||{},this.paramsInheritanceStrategy=this.options.paramsInheritanceStrategy||"emptyOnly",this.urlHandlingStrategy=p(Ju),this.createViewTransition=p(aE,{optional:!0}),this.navigationId=0,this.afterPreactivation=()=>D(void 0),this.rootComponentType=null;let r=o=>this.events.next(new Su(o)),i=o=>this.events.next(new Tu(o));this.configLoader.onLoadEndListener=i,this.configLoader.onLoadStartListener=r}complete(){this.transitions?.complete()}handleNavigationRequest(r){let i=++this.navigationId;this.transitions?.next(V(m(m({},this.transitions.value),r),{id:i}))}setupNavigations(r,i,o){return this.transitions=new ee({id:0,currentUrlTree:i,currentRawUrl:i,extractedUrl:this.urlHandlingStrategy.extract(i),urlAfterRedirects:this.urlHandlingStrategy.extract(i),rawUrl:i,extras:{},resolve:null,reject:null,promise:Promise.resolve(!0),source:Dr,restoredState:null,currentSnapshot:o.snapshot,targetSnapshot:null,currentRouterState:o,targetRouterState:null,guards:{canActivateChecks:[],canDeactivateChecks:[]},guardsResult:null}),this.transitions.pipe(Y(s=>s.id!==0),M(s=>V(m({},s),{extractedUrl:this.urlHandlingStrategy.extract(s.rawUrl)})),Z(s=>{this.currentTransition=s;let a=!1,u=!1;return D(s).pipe(W(c=>{this.currentNavigation={id:c.id,initialUrl:c.rawUrl,extractedUrl:c.extractedUrl,trigger:c.source,extras:c.extras,previousNavigation:this.lastSuccessfulNavigation?V(m({},this.lastSuccessfulNavigation),{previousNavigation:null}):null}}),Z(c=>{let l=!r.navigated||this.isUpdatingInternalState()||this.isUpdatedBrowserUrl(),d=c.extras.onSameUrlNavigation??r.onSameUrlNavigation;if(!l&&d!=="reload"){let f="";return this.events.next(new Wt(c.id,this.urlSerializer.serialize(c.rawUrl),f,0)),c.resolve(null),ue}if(this.urlHandlingStrategy.shouldProcessUrl(c.rawUrl))return D(c).pipe(Z(f=>{let h=this.transitions?.getValue();return this.events.next(new Er(f.id,this.urlSerializer.serialize(f.extractedUrl),f.source,f.restoredState)),h!==this.transitions?.getValue()?ue:Promise.resolve(f)}),Kw(this.environmentInjector,this.configLoader,this.rootComponentType,r.config,this.urlSerializer,this.paramsInheritanceStrategy),W(f=>{s.targetSnapshot=f.targetSnapshot,s.urlAfterRedirects=f.urlAfterRedirects,this.currentNavigation=V(m({},this.currentNavigation),{finalUrl:f.urlAfterRedirects});let h=new Eo(f.id,this.urlSerializer.serialize(f.extractedUrl),this.urlSerializer.serialize(f.urlAfterRedirects),f.targetSnapshot);this.events.next(h)}));if(l&&this.urlHandlingStrategy.shouldProcessUrl(c.currentRawUrl)){let{id:f,extractedUrl:h,source:g,restoredState:_,extras:b}=c,v=new Er(f,this.urlSerializer.serialize(h),g,_);this.events.next(v);let z=Ih(h,this.rootComponentType).snapshot;return this.currentTransition=s=V(m({},c),{targetSnapshot:z,urlAfterRedirects:h,extras:V(m({},b),{skipLocationChange:!1,replaceUrl:!1})}),this.currentNavigation.finalUrl=h,D(s)}else{let f="";return this.events.next(new Wt(c.id,this.urlSerializer.serialize(c.extractedUrl),f,1)),c.resolve(null),ue}}),W(c=>{let l=new bu(c.id,this.urlSerializer.serialize(c.extractedUrl),this.urlSerializer.serialize(c.urlAfterRedirects),c.targetSnapshot);this.events.next(l)}),M(c=>(this.currentTransition=s=V(m({},c),{guards:gw(c.targetSnapshot,c.currentSnapshot,this.rootContexts)}),s)),Mw(this.environmentInjector,c=>this.events.next(c)),W(c=>{if(s.guardsResult=c.guardsResult,Nn(c.guardsResult))throw Th(this.urlSerializer,c.guardsResult);let l=new Iu(c.id,this.urlSerializer.serialize(c.extractedUrl),this.urlSerializer.serialize(c.urlAfterRedirects),c.targetSnapshot,!!c.guardsResult);this.events.next(l)}),Y(c=>c.guardsResult?!0:(this.cancelNavigationTransition(c,"",3),!1)),vu(c=>{if(c.guards.canActivateChecks.length)return D(c).pipe(W(l=>{let d=new Mu(l.id,this.urlSerializer.serialize(l.extractedUrl),this.urlSerializer.serialize(l.urlAfterRedirects),l.targetSnapshot);this.events.next(d)}),Z(l=>{let d=!1;return D(l).pipe(Jw(this.paramsInheritanceStrategy,this.environmentInjector),W({next:()=>d=!0,complete:()=>{d||this.cancelNavigationTransition(l,"",2)}}))}),W(l=>{let d=new _u(l.id,this.urlSerializer.serialize(l.extractedUrl),this.urlSerializer.serialize(l.urlAfterRedirects),l.targetSnapshot);this.events.next(d)}))}),vu(c=>{let l=d=>{let f=[];d.routeConfig?.loadComponent&&!d.routeConfig._loadedComponent&&f.push(this.configLoader.loadComponent(d.routeConfig).pipe(W(h=>{d.component=h}),M(()=>{})));for(let h of d.children)f.push(...l(h));return f};return ai(l(c.targetSnapshot.root)).pipe(rt(),Q(1))}),vu(()=>this.afterPreactivation()),Z(()=>{let{currentSnapshot:c,targetSnapshot:l}=s,d=this.createViewTransition?.(this.environmentInjector,c.root,l.root);return d?j(d).pipe(M(()=>s)):D(s)}),M(c=>{let l=aw(r.routeReuseStrategy,c.targetSnapshot,c.currentRouterState);return this.currentTransition=s=V(m({},c),{targetRouterState:l}),this.currentNavigation.targetRouterState=l,s}),W(()=>{this.events.next(new Ir)}),pw(this.rootContexts,r.routeReuseStrategy,c=>this.events.next(c),this.inputBindingEnabled),Q(1),W({next:c=>{a=!0,this.lastSuccessfulNavigation=this.currentNavigation,this.events.next(new Gt(c.id,this.urlSerializer.serialize(c.extractedUrl),this.urlSerializer.serialize(c.urlAfterRedirects))),this.titleStrategy?.updateTitle(c.targetRouterState.snapshot),c.resolve(!0)},complete:()=>{a=!0}}),cs(this.transitionAbortSubject.pipe(W(c=>{throw c}))),Mt(()=>{if(!a&&!u){let c="";this.cancelNavigationTransition(s,c,1)}this.currentNavigation?.id===s.id&&(this.currentNavigation=null)}),tt(c=>{if(u=!0,xh(c))this.events.next(new vt(s.id,this.urlSerializer.serialize(s.extractedUrl),c.message,c.cancellationCode)),lw(c)?this.events.next(new Mr(c.url)):s.resolve(!1);else{this.events.next(new br(s.id,this.urlSerializer.serialize(s.extractedUrl),c,s.targetSnapshot??void 0));try{s.resolve(r.errorHandler(c))}catch(l){s.reject(l)}}return ue}))}))}cancelNavigationTransition(r,i,o){let s=new vt(r.id,this.urlSerializer.serialize(r.extractedUrl),i,o);this.events.next(s),r.resolve(!1)}isUpdatingInternalState(){return this.currentTransition?.extractedUrl.toString()!==this.currentTransition?.currentUrlTree.toString()}isUpdatedBrowserUrl(){return this.urlHandlingStrategy.extract(this.urlSerializer.parse(this.location.path(!0))).toString()!==this.currentTransition?.extractedUrl.toString()&&!this.currentTransition?.extras.skipLocationChange}};e.\u0275fac=function(i){return new(i||e)},e.\u0275prov=w({token:e,factory:e.\u0275fac,providedIn:"root"});let t=e;return t})();function cE(t){return t!==Dr}var lE=(()=>{let e=class e{};e.\u0275fac=function(i){return new(i||e)},e.\u0275prov=w({token:e,factory:()=>(()=>p(dE))(),providedIn:"root"});let t=e;return t})(),Hu=class{shouldDetach(e){return!1}store(e,n){}shouldAttach(e){return!1}retrieve(e){return null}shouldReuseRoute(e,n){return e.routeConfig===n.routeConfig}},dE=(()=>{let e=class e extends Hu{};e.\u0275fac=(()=>{let r;return function(o){return(r||(r=wn(e)))(o||e)}})(),e.\u0275prov=w({token:e,factory:e.\u0275fac,providedIn:"root"});let t=e;return t})(),Lh=(()=>{let e=class e{};e.\u0275fac=function(i){return new(i||e)},e.\u0275prov=w({token:e,factory:()=>(()=>p(fE))(),providedIn:"root"});let t=e;return t})(),fE=(()=>{let e=class e extends Lh{constructor(){super(...arguments),this.location=p(ur),this.urlSerializer=p(zu),this.options=p(Qu,{optional:!0})||{},this.canceledNavigationResolution=this.options.canceledNavigationResolution||"replace",this.urlHandlingStrategy=p(Ju),this.urlUpdateStrategy=this.options.urlUpdateStrategy||"deferred",this.currentUrlTree=new mt,this.rawUrlTree=this.currentUrlTree,this.currentPageId=0,this.lastSuccessfulId=-1,this.routerState=Ih(this.currentUrlTree,null),this.stateMemento=this.createStateMemento()}getCurrentUrlTree(){return this.currentUrlTree}getRawUrlTree(){return this.rawUrlTree}restoredState(){return this.location.getState()}get browserPageId(){return this.canceledNavigationResolution!=="computed"?this.currentPageId:this.restoredState()?.\u0275routerPageId??this.currentPageId}getRouterState(){return this.routerState}createStateMemento(){return{rawUrlTree:this.rawUrlTree,currentUrlTree:this.currentUrlTree,routerState:this.routerState}}registerNonRouterCurrentEntryChangeListener(r){return this.location.subscribe(i=>{i.type==="popstate"&&r(i.url,i.state)})}handleRouterEvent(r,i){if(r instanceof Er)this.stateMemento=this.createStateMemento();else if(r instanceof Wt)this.rawUrlTree=i.initialUrl;else if(r instanceof Eo){if(this.urlUpdateStrategy==="eager"&&!i.extras.skipLocationChange){let o=this.urlHandlingStrategy.merge(i.finalUrl,i.initialUrl);this.setBrowserUrl(o,i)}}else r instanceof Ir?(this.currentUrlTree=i.finalUrl,this.rawUrlTree=this.urlHandlingStrategy.merge(i.finalUrl,i.initialUrl),this.routerState=i.targetRouterState,this.urlUpdateStrategy==="deferred"&&(i.extras.skipLocationChange||this.setBrowserUrl(this.rawUrlTree,i))):r instanceof vt&&(r.code===3||r.code===2)?this.restoreHistory(i):r instanceof br?this.restoreHistory(i,!0):r instanceof Gt&&(this.lastSuccessfulId=r.id,this.currentPageId=this.browserPageId)}setBrowserUrl(r,i){let o=this.urlSerializer.serialize(r);if(this.location.isCurrentPathEqualTo(o)||i.extras.replaceUrl){let s=this.browserPageId,a=m(m({},i.extras.state),this.generateNgRouterState(i.id,s));this.location.replaceState(o,"",a)}else{let s=m(m({},i.extras.state),this.generateNgRouterState(i.id,this.browserPageId+1));this.location.go(o,"",s)}}restoreHistory(r,i=!1){if(this.canceledNavigationResolution==="computed"){let o=this.browserPageId,s=this.currentPageId-o;s!==0?this.location.historyGo(s):this.currentUrlTree===r.finalUrl&&s===0&&(this.resetState(r),this.resetUrlToCurrentUrlTree())}else this.canceledNavigationResolution==="replace"&&(i&&this.resetState(r),this.resetUrlToCurrentUrlTree())}resetState(r){this.routerState=this.stateMemento.routerState,this.currentUrlTree=this.stateMemento.currentUrlTree,this.rawUrlTree=this.urlHandlingStrategy.merge(this.currentUrlTree,r.finalUrl??this.rawUrlTree)}resetUrlToCurrentUrlTree(){this.location.replaceState(this.urlSerializer.serialize(this.rawUrlTree),"",this.generateNgRouterState(this.lastSuccessfulId,this.currentPageId))}generateNgRouterState(r,i){return this.canceledNavigationResolution==="computed"?{navigationId:r,\u0275routerPageId:i}:{navigationId:r}}};e.\u0275fac=(()=>{let r;return function(o){return(r||(r=wn(e)))(o||e)}})(),e.\u0275prov=w({token:e,factory:e.\u0275fac,providedIn:"root"});let t=e;return t})(),vr=function(t){return t[t.COMPLETE=0]="COMPLETE",t[t.FAILED=1]="FAILED",t[t.REDIRECTING=2]="REDIRECTING",t}(vr||{});function hE(t,e){t.events.pipe(Y(n=>n instanceof Gt||n instanceof vt||n instanceof br||n instanceof Wt),M(n=>n instanceof Gt||n instanceof Wt?vr.COMPLETE:(n instanceof vt?n.code===0||n.code===1:!1)?vr.REDIRECTING:vr.FAILED),Y(n=>n!==vr.REDIRECTING),Q(1)).subscribe(()=>{e()})}function pE(t){throw t}var gE={paths:"exact",fragment:"ignored",matrixParams:"ignored",queryParams:"exact"},mE={paths:"subset",fragment:"ignored",matrixParams:"ignored",queryParams:"subset"},Vh=(()=>{let e=class e{get currentUrlTree(){return this.stateManager.getCurrentUrlTree()}get rawUrlTree(){return this.stateManager.getRawUrlTree()}get events(){return this._events}get routerState(){return this.stateManager.getRouterState()}constructor(){this.disposed=!1,this.isNgZoneEnabled=!1,this.console=p(Xi),this.stateManager=p(Lh),this.options=p(Qu,{optional:!0})||{},this.pendingTasks=p(ar),this.urlUpdateStrategy=this.options.urlUpdateStrategy||"deferred",this.navigationTransitions=p(uE),this.urlSerializer=p(zu),this.location=p(ur),this.urlHandlingStrategy=p(Ju),this._events=new G,this.errorHandler=this.options.errorHandler||pE,this.navigated=!1,this.routeReuseStrategy=p(lE),this.onSameUrlNavigation=this.options.onSameUrlNavigation||"ignore",this.config=p(Ku,{optional:!0})?.flat()??[],this.componentInputBindingEnabled=!!p(qu,{optional:!0}),this.eventsSubscription=new q,this.isNgZoneEnabled=p(H)instanceof H&&H.isInAngularZone(),this.resetConfig(this.config),this.navigationTransitions.setupNavigations(this,this.currentUrlTree,this.routerState).subscribe({error:r=>{this.console.warn(r)}}),this.subscribeToNavigationEvents()}subscribeToNavigationEvents(){let r=this.navigationTransitions.events.subscribe(i=>{try{let o=this.navigationTransitions.currentTransition,s=this.navigationTransitions.currentNavigation;if(o!==null&&s!==null){if(this.stateManager.handleRouterEvent(i,s),i instanceof vt&&i.code!==0&&i.code!==1)this.navigated=!0;else if(i instanceof Gt)this.navigated=!0;else if(i instanceof Mr){let a=this.urlHandlingStrategy.merge(i.url,o.currentRawUrl),u={skipLocationChange:o.extras.skipLocationChange,replaceUrl:this.urlUpdateStrategy==="eager"||cE(o.source)};this.scheduleNavigation(a,Dr,null,u,{resolve:o.resolve,reject:o.reject,promise:o.promise})}}yE(i)&&this._events.next(i)}catch(o){this.navigationTransitions.transitionAbortSubject.next(o)}});this.eventsSubscription.add(r)}resetRootComponentType(r){this.routerState.root.component=r,this.navigationTransitions.rootComponentType=r}initialNavigation(){this.setUpLocationChangeListener(),this.navigationTransitions.hasRequestedNavigation||this.navigateToSyncWithBrowser(this.location.path(!0),Dr,this.stateManager.restoredState())}setUpLocationChangeListener(){this.nonRouterCurrentEntryChangeSubscription||(this.nonRouterCurrentEntryChangeSubscription=this.stateManager.registerNonRouterCurrentEntryChangeListener((r,i)=>{setTimeout(()=>{this.navigateToSyncWithBrowser(r,"popstate",i)},0)}))}navigateToSyncWithBrowser(r,i,o){let s={replaceUrl:!0},a=o?.navigationId?o:null;if(o){let c=m({},o);delete c.navigationId,delete c.\u0275routerPageId,Object.keys(c).length!==0&&(s.state=c)}let u=this.parseUrl(r);this.scheduleNavigation(u,i,a,s)}get url(){return this.serializeUrl(this.currentUrlTree)}getCurrentNavigation(){return this.navigationTransitions.currentNavigation}get lastSuccessfulNavigation(){return this.navigationTransitions.lastSuccessfulNavigation}resetConfig(r){this.config=r.map(Zu),this.navigated=!1}ngOnDestroy(){this.dispose()}dispose(){this.navigationTransitions.complete(),this.nonRouterCurrentEntryChangeSubscription&&(this.nonRouterCurrentEntryChangeSubscription.unsubscribe(),this.nonRouterCurrentEntryChangeSubscription=void 0),this.disposed=!0,this.eventsSubscription.unsubscribe()}createUrlTree(r,i={}){let{relativeTo:o,queryParams:s,fragment:a,queryParamsHandling:u,preserveFragment:c}=i,l=c?this.currentUrlTree.fragment:a,d=null;switch(u){case"merge":d=m(m({},this.currentUrlTree.queryParams),s);break;case"preserve":d=this.currentUrlTree.queryParams;break;default:d=s||null}d!==null&&(d=this.removeEmptyProps(d));let f;try{let h=o?o.snapshot:this.routerState.snapshot.root;f=Ch(h)}catch{(typeof r[0]!="string"||!r[0].startsWith("/"))&&(r=[]),f=this.currentUrlTree.root}return wh(f,r,d,l??null)}navigateByUrl(r,i={skipLocationChange:!1}){let o=Nn(r)?r:this.parseUrl(r),s=this.urlHandlingStrategy.merge(o,this.rawUrlTree);return this.scheduleNavigation(s,Dr,null,i)}navigate(r,i={skipLocationChange:!1}){return vE(r),this.navigateByUrl(this.createUrlTree(r,i),i)}serializeUrl(r){return this.urlSerializer.serialize(r)}parseUrl(r){try{return this.urlSerializer.parse(r)}catch{return this.urlSerializer.parse("/")}}isActive(r,i){let o;if(i===!0?o=m({},gE):i===!1?o=m({},mE):o=i,Nn(r))return oh(this.currentUrlTree,r,o);let s=this.parseUrl(r);return oh(this.currentUrlTree,s,o)}removeEmptyProps(r){return Object.keys(r).reduce((i,o)=>{let s=r[o];return s!=null&&(i[o]=s),i},{})}scheduleNavigation(r,i,o,s,a){if(this.disposed)return Promise.resolve(!1);let u,c,l;a?(u=a.resolve,c=a.reject,l=a.promise):l=new Promise((f,h)=>{u=f,c=h});let d=this.pendingTasks.add();return hE(this,()=>{queueMicrotask(()=>this.pendingTasks.remove(d))}),this.navigationTransitions.handleNavigationRequest({source:i,restoredState:o,currentUrlTree:this.currentUrlTree,currentRawUrl:this.currentUrlTree,rawUrl:r,extras:s,resolve:u,reject:c,promise:l,currentSnapshot:this.routerState.snapshot,currentRouterState:this.routerState}),l.catch(f=>Promise.reject(f))}};e.\u0275fac=function(i){return new(i||e)},e.\u0275prov=w({token:e,factory:e.\u0275fac,providedIn:"root"});let t=e;return t})();function vE(t){for(let e=0;e<t.length;e++)if(t[e]==null)throw new C(4008,!1)}function yE(t){return!(t instanceof Ir)&&!(t instanceof Mr)}var DE=new E("");function jh(t,...e){return ct([{provide:Ku,multi:!0,useValue:t},[],{provide:On,useFactory:CE,deps:[Vh]},{provide:to,multi:!0,useFactory:wE},e.map(n=>n.\u0275providers)])}function CE(t){return t.routerState.root}function wE(){let t=p(Ye);return e=>{let n=t.get(pt);if(e!==n.components[0])return;let r=t.get(Vh),i=t.get(EE);t.get(bE)===1&&r.initialNavigation(),t.get(IE,null,O.Optional)?.setUpPreloading(),t.get(DE,null,O.Optional)?.init(),r.resetRootComponentType(n.componentTypes[0]),i.closed||(i.next(),i.complete(),i.unsubscribe())}}var EE=new E("",{factory:()=>new G}),bE=new E("",{providedIn:"root",factory:()=>1});var IE=new E("");var $h=[];var Rr="Service workers are disabled or not supported by this browser";function ME(t){return bt(()=>et(new Error(t)))}var Fn=class{constructor(e){if(this.serviceWorker=e,!e)this.worker=this.events=this.registration=ME(Rr);else{let r=nn(e,"controllerchange").pipe(M(()=>e.controller)),i=bt(()=>D(e.controller)),o=Ae(i,r);this.worker=o.pipe(Y(l=>!!l)),this.registration=this.worker.pipe(Z(()=>e.getRegistration()));let c=nn(e,"message").pipe(M(l=>l.data)).pipe(Y(l=>l&&l.type)).pipe(is());c.connect(),this.events=c}}postMessage(e,n){return this.worker.pipe(Q(1),W(r=>{r.postMessage(m({action:e},n))})).toPromise().then(()=>{})}postMessageWithOperation(e,n,r){let i=this.waitForOperationCompleted(r),o=this.postMessage(e,n);return Promise.all([o,i]).then(([,s])=>s)}generateNonce(){return Math.round(Math.random()*1e7)}eventsOfType(e){let n;return typeof e=="string"?n=r=>r.type===e:n=r=>e.includes(r.type),this.events.pipe(Y(n))}nextEventOfType(e){return this.eventsOfType(e).pipe(Q(1))}waitForOperationCompleted(e){return this.eventsOfType("OPERATION_COMPLETED").pipe(Y(n=>n.nonce===e),Q(1),M(n=>{if(n.result!==void 0)return n.result;throw new Error(n.error)})).toPromise()}get isEnabled(){return!!this.serviceWorker}},_E=(()=>{let e=class e{get isEnabled(){return this.sw.isEnabled}constructor(r){if(this.sw=r,this.pushManager=null,this.subscriptionChanges=new G,!r.isEnabled){this.messages=It,this.notificationClicks=It,this.subscription=It;return}this.messages=this.sw.eventsOfType("PUSH").pipe(M(o=>o.data)),this.notificationClicks=this.sw.eventsOfType("NOTIFICATION_CLICK").pipe(M(o=>o.data)),this.pushManager=this.sw.registration.pipe(M(o=>o.pushManager));let i=this.pushManager.pipe(Z(o=>o.getSubscription()));this.subscription=rn(i,this.subscriptionChanges)}requestSubscription(r){if(!this.sw.isEnabled||this.pushManager===null)return Promise.reject(new Error(Rr));let i={userVisibleOnly:!0},o=this.decodeBase64(r.serverPublicKey.replace(/_/g,"/").replace(/-/g,"+")),s=new Uint8Array(new ArrayBuffer(o.length));for(let a=0;a<o.length;a++)s[a]=o.charCodeAt(a);return i.applicationServerKey=s,this.pushManager.pipe(Z(a=>a.subscribe(i)),Q(1)).toPromise().then(a=>(this.subscriptionChanges.next(a),a))}unsubscribe(){if(!this.sw.isEnabled)return Promise.reject(new Error(Rr));let r=i=>{if(i===null)throw new Error("Not subscribed to push notifications.");return i.unsubscribe().then(o=>{if(!o)throw new Error("Unsubscribe failed!");this.subscriptionChanges.next(null)})};return this.subscription.pipe(Q(1),Z(r)).toPromise()}decodeBase64(r){return atob(r)}};e.\u0275fac=function(i){return new(i||e)(I(Fn))},e.\u0275prov=w({token:e,factory:e.\u0275fac});let t=e;return t})(),SE=(()=>{let e=class e{get isEnabled(){return this.sw.isEnabled}constructor(r){if(this.sw=r,!r.isEnabled){this.versionUpdates=It,this.unrecoverable=It;return}this.versionUpdates=this.sw.eventsOfType(["VERSION_DETECTED","VERSION_INSTALLATION_FAILED","VERSION_READY","NO_NEW_VERSION_DETECTED"]),this.unrecoverable=this.sw.eventsOfType("UNRECOVERABLE_STATE")}checkForUpdate(){if(!this.sw.isEnabled)return Promise.reject(new Error(Rr));let r=this.sw.generateNonce();return this.sw.postMessageWithOperation("CHECK_FOR_UPDATES",{nonce:r},r)}activateUpdate(){if(!this.sw.isEnabled)return Promise.reject(new Error(Rr));let r=this.sw.generateNonce();return this.sw.postMessageWithOperation("ACTIVATE_UPDATE",{nonce:r},r)}};e.\u0275fac=function(i){return new(i||e)(I(Fn))},e.\u0275prov=w({token:e,factory:e.\u0275fac});let t=e;return t})();var Uh=new E("NGSW_REGISTER_SCRIPT");function TE(t,e,n,r){return()=>{if(!(Xa(r)&&"serviceWorker"in navigator&&n.enabled!==!1))return;navigator.serviceWorker.addEventListener("controllerchange",()=>{navigator.serviceWorker.controller!==null&&navigator.serviceWorker.controller.postMessage({action:"INITIALIZE"})});let i;if(typeof n.registrationStrategy=="function")i=n.registrationStrategy();else{let[s,...a]=(n.registrationStrategy||"registerWhenStable:30000").split(":");switch(s){case"registerImmediately":i=D(null);break;case"registerWithDelay":i=Bh(+a[0]||0);break;case"registerWhenStable":i=a[0]?rn(Hh(t),Bh(+a[0])):Hh(t);break;default:throw new Error(`Unknown ServiceWorker registration strategy: ${n.registrationStrategy}`)}}t.get(H).runOutsideAngular(()=>i.pipe(Q(1)).subscribe(()=>navigator.serviceWorker.register(e,{scope:n.scope}).catch(s=>console.error("Service worker registration failed with:",s))))}}function Bh(t){return D(null).pipe(ts(t))}function Hh(t){return t.get(pt).isStable.pipe(Y(n=>n))}function AE(t,e){return new Fn(Xa(e)&&t.enabled!==!1?navigator.serviceWorker:void 0)}var Or=class{};function zh(t,e={}){return ct([_E,SE,{provide:Uh,useValue:t},{provide:Or,useValue:e},{provide:Fn,useFactory:AE,deps:[Or,_e]},{provide:eo,useFactory:TE,deps:[Ye,Uh,Or,_e],multi:!0}])}var Gh={providers:[jh($h),Qf(),zh("ngsw-worker.js",{enabled:!Nf(),registrationStrategy:"registerWhenStable:30000"})]};var Xh=(()=>{let e=class e{constructor(r,i){this._renderer=r,this._elementRef=i,this.onChange=o=>{},this.onTouched=()=>{}}setProperty(r,i){this._renderer.setProperty(this._elementRef.nativeElement,r,i)}registerOnTouched(r){this.onTouched=r}registerOnChange(r){this.onChange=r}setDisabledState(r){this.setProperty("disabled",r)}};e.\u0275fac=function(i){return new(i||e)(U(kt),U(lt))},e.\u0275dir=Ee({type:e});let t=e;return t})(),ep=(()=>{let e=class e extends Xh{};e.\u0275fac=(()=>{let r;return function(o){return(r||(r=wn(e)))(o||e)}})(),e.\u0275dir=Ee({type:e,features:[Vt]});let t=e;return t})(),rc=new E("NgValueAccessor");var xE={provide:rc,useExisting:Dn(()=>Ro),multi:!0};function NE(){let t=Ke()?Ke().getUserAgent():"";return/android (\d+)/.test(t.toLowerCase())}var OE=new E("CompositionEventMode"),Ro=(()=>{let e=class e extends Xh{constructor(r,i,o){super(r,i),this._compositionMode=o,this._composing=!1,this._compositionMode==null&&(this._compositionMode=!NE())}writeValue(r){let i=r??"";this.setProperty("value",i)}_handleInput(r){(!this._compositionMode||this._compositionMode&&!this._composing)&&this.onChange(r)}_compositionStart(){this._composing=!0}_compositionEnd(r){this._composing=!1,this._compositionMode&&this.onChange(r)}};e.\u0275fac=function(i){return new(i||e)(U(kt),U(lt),U(OE,8))},e.\u0275dir=Ee({type:e,selectors:[["input","formControlName","",3,"type","checkbox"],["textarea","formControlName",""],["input","formControl","",3,"type","checkbox"],["textarea","formControl",""],["input","ngModel","",3,"type","checkbox"],["textarea","ngModel",""],["","ngDefaultControl",""]],hostBindings:function(i,o){i&1&&ht("input",function(a){return o._handleInput(a.target.value)})("blur",function(){return o.onTouched()})("compositionstart",function(){return o._compositionStart()})("compositionend",function(a){return o._compositionEnd(a.target.value)})},features:[Ki([xE]),Vt]});let t=e;return t})();var RE=new E("NgValidators"),PE=new E("NgAsyncValidators");function tp(t){return t!=null}function np(t){return jt(t)?j(t):t}function rp(t){let e={};return t.forEach(n=>{e=n!=null?m(m({},e),n):e}),Object.keys(e).length===0?null:e}function ip(t,e){return e.map(n=>n(t))}function FE(t){return!t.validate}function op(t){return t.map(e=>FE(e)?e:n=>e.validate(n))}function kE(t){if(!t)return null;let e=t.filter(tp);return e.length==0?null:function(n){return rp(ip(n,e))}}function sp(t){return t!=null?kE(op(t)):null}function LE(t){if(!t)return null;let e=t.filter(tp);return e.length==0?null:function(n){let r=ip(n,e).map(np);return Xo(r).pipe(M(rp))}}function ap(t){return t!=null?LE(op(t)):null}function Wh(t,e){return t===null?[e]:Array.isArray(t)?[...t,e]:[t,e]}function VE(t){return t._rawValidators}function jE(t){return t._rawAsyncValidators}function Xu(t){return t?Array.isArray(t)?t:[t]:[]}function No(t,e){return Array.isArray(t)?t.includes(e):t===e}function qh(t,e){let n=Xu(e);return Xu(t).forEach(i=>{No(n,i)||n.push(i)}),n}function Zh(t,e){return Xu(e).filter(n=>!No(t,n))}var Oo=class{constructor(){this._rawValidators=[],this._rawAsyncValidators=[],this._onDestroyCallbacks=[]}get value(){return this.control?this.control.value:null}get valid(){return this.control?this.control.valid:null}get invalid(){return this.control?this.control.invalid:null}get pending(){return this.control?this.control.pending:null}get disabled(){return this.control?this.control.disabled:null}get enabled(){return this.control?this.control.enabled:null}get errors(){return this.control?this.control.errors:null}get pristine(){return this.control?this.control.pristine:null}get dirty(){return this.control?this.control.dirty:null}get touched(){return this.control?this.control.touched:null}get status(){return this.control?this.control.status:null}get untouched(){return this.control?this.control.untouched:null}get statusChanges(){return this.control?this.control.statusChanges:null}get valueChanges(){return this.control?this.control.valueChanges:null}get path(){return null}_setValidators(e){this._rawValidators=e||[],this._composedValidatorFn=sp(this._rawValidators)}_setAsyncValidators(e){this._rawAsyncValidators=e||[],this._composedAsyncValidatorFn=ap(this._rawAsyncValidators)}get validator(){return this._composedValidatorFn||null}get asyncValidator(){return this._composedAsyncValidatorFn||null}_registerOnDestroy(e){this._onDestroyCallbacks.push(e)}_invokeOnDestroyCallbacks(){this._onDestroyCallbacks.forEach(e=>e()),this._onDestroyCallbacks=[]}reset(e=void 0){this.control&&this.control.reset(e)}hasError(e,n){return this.control?this.control.hasError(e,n):!1}getError(e,n){return this.control?this.control.getError(e,n):null}},ec=class extends Oo{get formDirective(){return null}get path(){return null}},kr=class extends Oo{constructor(){super(...arguments),this._parent=null,this.name=null,this.valueAccessor=null}},tc=class{constructor(e){this._cd=e}get isTouched(){return!!this._cd?.control?.touched}get isUntouched(){return!!this._cd?.control?.untouched}get isPristine(){return!!this._cd?.control?.pristine}get isDirty(){return!!this._cd?.control?.dirty}get isValid(){return!!this._cd?.control?.valid}get isInvalid(){return!!this._cd?.control?.invalid}get isPending(){return!!this._cd?.control?.pending}get isSubmitted(){return!!this._cd?.submitted}},$E={"[class.ng-untouched]":"isUntouched","[class.ng-touched]":"isTouched","[class.ng-pristine]":"isPristine","[class.ng-dirty]":"isDirty","[class.ng-valid]":"isValid","[class.ng-invalid]":"isInvalid","[class.ng-pending]":"isPending"},ZN=V(m({},$E),{"[class.ng-submitted]":"isSubmitted"}),up=(()=>{let e=class e extends tc{constructor(r){super(r)}};e.\u0275fac=function(i){return new(i||e)(U(kr,2))},e.\u0275dir=Ee({type:e,selectors:[["","formControlName",""],["","ngModel",""],["","formControl",""]],hostVars:14,hostBindings:function(i,o){i&2&&Ba("ng-untouched",o.isUntouched)("ng-touched",o.isTouched)("ng-pristine",o.isPristine)("ng-dirty",o.isDirty)("ng-valid",o.isValid)("ng-invalid",o.isInvalid)("ng-pending",o.isPending)},features:[Vt]});let t=e;return t})();var Pr="VALID",xo="INVALID",kn="PENDING",Fr="DISABLED";function UE(t){return(Po(t)?t.validators:t)||null}function BE(t){return Array.isArray(t)?sp(t):t||null}function HE(t,e){return(Po(e)?e.asyncValidators:t)||null}function zE(t){return Array.isArray(t)?ap(t):t||null}function Po(t){return t!=null&&!Array.isArray(t)&&typeof t=="object"}var nc=class{constructor(e,n){this._pendingDirty=!1,this._hasOwnPendingAsyncValidator=!1,this._pendingTouched=!1,this._onCollectionChange=()=>{},this._parent=null,this.pristine=!0,this.touched=!1,this._onDisabledChange=[],this._assignValidators(e),this._assignAsyncValidators(n)}get validator(){return this._composedValidatorFn}set validator(e){this._rawValidators=this._composedValidatorFn=e}get asyncValidator(){return this._composedAsyncValidatorFn}set asyncValidator(e){this._rawAsyncValidators=this._composedAsyncValidatorFn=e}get parent(){return this._parent}get valid(){return this.status===Pr}get invalid(){return this.status===xo}get pending(){return this.status==kn}get disabled(){return this.status===Fr}get enabled(){return this.status!==Fr}get dirty(){return!this.pristine}get untouched(){return!this.touched}get updateOn(){return this._updateOn?this._updateOn:this.parent?this.parent.updateOn:"change"}setValidators(e){this._assignValidators(e)}setAsyncValidators(e){this._assignAsyncValidators(e)}addValidators(e){this.setValidators(qh(e,this._rawValidators))}addAsyncValidators(e){this.setAsyncValidators(qh(e,this._rawAsyncValidators))}removeValidators(e){this.setValidators(Zh(e,this._rawValidators))}removeAsyncValidators(e){this.setAsyncValidators(Zh(e,this._rawAsyncValidators))}hasValidator(e){return No(this._rawValidators,e)}hasAsyncValidator(e){return No(this._rawAsyncValidators,e)}clearValidators(){this.validator=null}clearAsyncValidators(){this.asyncValidator=null}markAsTouched(e={}){this.touched=!0,this._parent&&!e.onlySelf&&this._parent.markAsTouched(e)}markAllAsTouched(){this.markAsTouched({onlySelf:!0}),this._forEachChild(e=>e.markAllAsTouched())}markAsUntouched(e={}){this.touched=!1,this._pendingTouched=!1,this._forEachChild(n=>{n.markAsUntouched({onlySelf:!0})}),this._parent&&!e.onlySelf&&this._parent._updateTouched(e)}markAsDirty(e={}){this.pristine=!1,this._parent&&!e.onlySelf&&this._parent.markAsDirty(e)}markAsPristine(e={}){this.pristine=!0,this._pendingDirty=!1,this._forEachChild(n=>{n.markAsPristine({onlySelf:!0})}),this._parent&&!e.onlySelf&&this._parent._updatePristine(e)}markAsPending(e={}){this.status=kn,e.emitEvent!==!1&&this.statusChanges.emit(this.status),this._parent&&!e.onlySelf&&this._parent.markAsPending(e)}disable(e={}){let n=this._parentMarkedDirty(e.onlySelf);this.status=Fr,this.errors=null,this._forEachChild(r=>{r.disable(V(m({},e),{onlySelf:!0}))}),this._updateValue(),e.emitEvent!==!1&&(this.valueChanges.emit(this.value),this.statusChanges.emit(this.status)),this._updateAncestors(V(m({},e),{skipPristineCheck:n})),this._onDisabledChange.forEach(r=>r(!0))}enable(e={}){let n=this._parentMarkedDirty(e.onlySelf);this.status=Pr,this._forEachChild(r=>{r.enable(V(m({},e),{onlySelf:!0}))}),this.updateValueAndValidity({onlySelf:!0,emitEvent:e.emitEvent}),this._updateAncestors(V(m({},e),{skipPristineCheck:n})),this._onDisabledChange.forEach(r=>r(!1))}_updateAncestors(e){this._parent&&!e.onlySelf&&(this._parent.updateValueAndValidity(e),e.skipPristineCheck||this._parent._updatePristine(),this._parent._updateTouched())}setParent(e){this._parent=e}getRawValue(){return this.value}updateValueAndValidity(e={}){this._setInitialStatus(),this._updateValue(),this.enabled&&(this._cancelExistingSubscription(),this.errors=this._runValidator(),this.status=this._calculateStatus(),(this.status===Pr||this.status===kn)&&this._runAsyncValidator(e.emitEvent)),e.emitEvent!==!1&&(this.valueChanges.emit(this.value),this.statusChanges.emit(this.status)),this._parent&&!e.onlySelf&&this._parent.updateValueAndValidity(e)}_updateTreeValidity(e={emitEvent:!0}){this._forEachChild(n=>n._updateTreeValidity(e)),this.updateValueAndValidity({onlySelf:!0,emitEvent:e.emitEvent})}_setInitialStatus(){this.status=this._allControlsDisabled()?Fr:Pr}_runValidator(){return this.validator?this.validator(this):null}_runAsyncValidator(e){if(this.asyncValidator){this.status=kn,this._hasOwnPendingAsyncValidator=!0;let n=np(this.asyncValidator(this));this._asyncValidationSubscription=n.subscribe(r=>{this._hasOwnPendingAsyncValidator=!1,this.setErrors(r,{emitEvent:e})})}}_cancelExistingSubscription(){this._asyncValidationSubscription&&(this._asyncValidationSubscription.unsubscribe(),this._hasOwnPendingAsyncValidator=!1)}setErrors(e,n={}){this.errors=e,this._updateControlsErrors(n.emitEvent!==!1)}get(e){let n=e;return n==null||(Array.isArray(n)||(n=n.split(".")),n.length===0)?null:n.reduce((r,i)=>r&&r._find(i),this)}getError(e,n){let r=n?this.get(n):this;return r&&r.errors?r.errors[e]:null}hasError(e,n){return!!this.getError(e,n)}get root(){let e=this;for(;e._parent;)e=e._parent;return e}_updateControlsErrors(e){this.status=this._calculateStatus(),e&&this.statusChanges.emit(this.status),this._parent&&this._parent._updateControlsErrors(e)}_initObservables(){this.valueChanges=new oe,this.statusChanges=new oe}_calculateStatus(){return this._allControlsDisabled()?Fr:this.errors?xo:this._hasOwnPendingAsyncValidator||this._anyControlsHaveStatus(kn)?kn:this._anyControlsHaveStatus(xo)?xo:Pr}_anyControlsHaveStatus(e){return this._anyControls(n=>n.status===e)}_anyControlsDirty(){return this._anyControls(e=>e.dirty)}_anyControlsTouched(){return this._anyControls(e=>e.touched)}_updatePristine(e={}){this.pristine=!this._anyControlsDirty(),this._parent&&!e.onlySelf&&this._parent._updatePristine(e)}_updateTouched(e={}){this.touched=this._anyControlsTouched(),this._parent&&!e.onlySelf&&this._parent._updateTouched(e)}_registerOnCollectionChange(e){this._onCollectionChange=e}_setUpdateStrategy(e){Po(e)&&e.updateOn!=null&&(this._updateOn=e.updateOn)}_parentMarkedDirty(e){let n=this._parent&&this._parent.dirty;return!e&&!!n&&!this._parent._anyControlsDirty()}_find(e){return null}_assignValidators(e){this._rawValidators=Array.isArray(e)?e.slice():e,this._composedValidatorFn=BE(this._rawValidators)}_assignAsyncValidators(e){this._rawAsyncValidators=Array.isArray(e)?e.slice():e,this._composedAsyncValidatorFn=zE(this._rawAsyncValidators)}};var cp=new E("CallSetDisabledState",{providedIn:"root",factory:()=>ic}),ic="always";function GE(t,e){return[...e.path,t]}function WE(t,e,n=ic){ZE(t,e),e.valueAccessor.writeValue(t.value),(t.disabled||n==="always")&&e.valueAccessor.setDisabledState?.(t.disabled),YE(t,e),KE(t,e),QE(t,e),qE(t,e)}function Yh(t,e){t.forEach(n=>{n.registerOnValidatorChange&&n.registerOnValidatorChange(e)})}function qE(t,e){if(e.valueAccessor.setDisabledState){let n=r=>{e.valueAccessor.setDisabledState(r)};t.registerOnDisabledChange(n),e._registerOnDestroy(()=>{t._unregisterOnDisabledChange(n)})}}function ZE(t,e){let n=VE(t);e.validator!==null?t.setValidators(Wh(n,e.validator)):typeof n=="function"&&t.setValidators([n]);let r=jE(t);e.asyncValidator!==null?t.setAsyncValidators(Wh(r,e.asyncValidator)):typeof r=="function"&&t.setAsyncValidators([r]);let i=()=>t.updateValueAndValidity();Yh(e._rawValidators,i),Yh(e._rawAsyncValidators,i)}function YE(t,e){e.valueAccessor.registerOnChange(n=>{t._pendingValue=n,t._pendingChange=!0,t._pendingDirty=!0,t.updateOn==="change"&&lp(t,e)})}function QE(t,e){e.valueAccessor.registerOnTouched(()=>{t._pendingTouched=!0,t.updateOn==="blur"&&t._pendingChange&&lp(t,e),t.updateOn!=="submit"&&t.markAsTouched()})}function lp(t,e){t._pendingDirty&&t.markAsDirty(),t.setValue(t._pendingValue,{emitModelToViewChange:!1}),e.viewToModelUpdate(t._pendingValue),t._pendingChange=!1}function KE(t,e){let n=(r,i)=>{e.valueAccessor.writeValue(r),i&&e.viewToModelUpdate(r)};t.registerOnChange(n),e._registerOnDestroy(()=>{t._unregisterOnChange(n)})}function JE(t,e){if(!t.hasOwnProperty("model"))return!1;let n=t.model;return n.isFirstChange()?!0:!Object.is(e,n.currentValue)}function XE(t){return Object.getPrototypeOf(t.constructor)===ep}function eb(t,e){if(!e)return null;Array.isArray(e);let n,r,i;return e.forEach(o=>{o.constructor===Ro?n=o:XE(o)?r=o:i=o}),i||r||n||null}function Qh(t,e){let n=t.indexOf(e);n>-1&&t.splice(n,1)}function Kh(t){return typeof t=="object"&&t!==null&&Object.keys(t).length===2&&"value"in t&&"disabled"in t}var tb=class extends nc{constructor(e=null,n,r){super(UE(n),HE(r,n)),this.defaultValue=null,this._onChange=[],this._pendingChange=!1,this._applyFormState(e),this._setUpdateStrategy(n),this._initObservables(),this.updateValueAndValidity({onlySelf:!0,emitEvent:!!this.asyncValidator}),Po(n)&&(n.nonNullable||n.initialValueIsDefault)&&(Kh(e)?this.defaultValue=e.value:this.defaultValue=e)}setValue(e,n={}){this.value=this._pendingValue=e,this._onChange.length&&n.emitModelToViewChange!==!1&&this._onChange.forEach(r=>r(this.value,n.emitViewToModelChange!==!1)),this.updateValueAndValidity(n)}patchValue(e,n={}){this.setValue(e,n)}reset(e=this.defaultValue,n={}){this._applyFormState(e),this.markAsPristine(n),this.markAsUntouched(n),this.setValue(this.value,n),this._pendingChange=!1}_updateValue(){}_anyControls(e){return!1}_allControlsDisabled(){return this.disabled}registerOnChange(e){this._onChange.push(e)}_unregisterOnChange(e){Qh(this._onChange,e)}registerOnDisabledChange(e){this._onDisabledChange.push(e)}_unregisterOnDisabledChange(e){Qh(this._onDisabledChange,e)}_forEachChild(e){}_syncPendingControls(){return this.updateOn==="submit"&&(this._pendingDirty&&this.markAsDirty(),this._pendingTouched&&this.markAsTouched(),this._pendingChange)?(this.setValue(this._pendingValue,{onlySelf:!0,emitModelToViewChange:!1}),!0):!1}_applyFormState(e){Kh(e)?(this.value=this._pendingValue=e.value,e.disabled?this.disable({onlySelf:!0,emitEvent:!1}):this.enable({onlySelf:!0,emitEvent:!1})):this.value=this._pendingValue=e}};var nb={provide:kr,useExisting:Dn(()=>oc)},Jh=(()=>Promise.resolve())(),oc=(()=>{let e=class e extends kr{constructor(r,i,o,s,a,u){super(),this._changeDetectorRef=a,this.callSetDisabledState=u,this.control=new tb,this._registered=!1,this.name="",this.update=new oe,this._parent=r,this._setValidators(i),this._setAsyncValidators(o),this.valueAccessor=eb(this,s)}ngOnChanges(r){if(this._checkForErrors(),!this._registered||"name"in r){if(this._registered&&(this._checkName(),this.formDirective)){let i=r.name.previousValue;this.formDirective.removeControl({name:i,path:this._getPath(i)})}this._setUpControl()}"isDisabled"in r&&this._updateDisabled(r),JE(r,this.viewModel)&&(this._updateValue(this.model),this.viewModel=this.model)}ngOnDestroy(){this.formDirective&&this.formDirective.removeControl(this)}get path(){return this._getPath(this.name)}get formDirective(){return this._parent?this._parent.formDirective:null}viewToModelUpdate(r){this.viewModel=r,this.update.emit(r)}_setUpControl(){this._setUpdateStrategy(),this._isStandalone()?this._setUpStandalone():this.formDirective.addControl(this),this._registered=!0}_setUpdateStrategy(){this.options&&this.options.updateOn!=null&&(this.control._updateOn=this.options.updateOn)}_isStandalone(){return!this._parent||!!(this.options&&this.options.standalone)}_setUpStandalone(){WE(this.control,this,this.callSetDisabledState),this.control.updateValueAndValidity({emitEvent:!1})}_checkForErrors(){this._isStandalone()||this._checkParentType(),this._checkName()}_checkParentType(){}_checkName(){this.options&&this.options.name&&(this.name=this.options.name),!this._isStandalone()&&this.name}_updateValue(r){Jh.then(()=>{this.control.setValue(r,{emitViewToModelChange:!1}),this._changeDetectorRef?.markForCheck()})}_updateDisabled(r){let i=r.isDisabled.currentValue,o=i!==0&&no(i);Jh.then(()=>{o&&!this.control.disabled?this.control.disable():!o&&this.control.disabled&&this.control.enable(),this._changeDetectorRef?.markForCheck()})}_getPath(r){return this._parent?GE(r,this._parent):[r]}};e.\u0275fac=function(i){return new(i||e)(U(ec,9),U(RE,10),U(PE,10),U(rc,10),U(En,8),U(cp,8))},e.\u0275dir=Ee({type:e,selectors:[["","ngModel","",3,"formControlName","",3,"formControl",""]],inputs:{name:"name",isDisabled:["disabled","isDisabled"],model:["ngModel","model"],options:["ngModelOptions","options"]},outputs:{update:"ngModelChange"},exportAs:["ngModel"],features:[Ki([nb]),Vt,Cn]});let t=e;return t})();var rb=(()=>{let e=class e{};e.\u0275fac=function(i){return new(i||e)},e.\u0275mod=Le({type:e}),e.\u0275inj=ke({});let t=e;return t})();var ib={provide:rc,useExisting:Dn(()=>sc),multi:!0},sc=(()=>{let e=class e extends ep{writeValue(r){this.setProperty("value",parseFloat(r))}registerOnChange(r){this.onChange=i=>{r(i==""?null:parseFloat(i))}}};e.\u0275fac=(()=>{let r;return function(o){return(r||(r=wn(e)))(o||e)}})(),e.\u0275dir=Ee({type:e,selectors:[["input","type","range","formControlName",""],["input","type","range","formControl",""],["input","type","range","ngModel",""]],hostBindings:function(i,o){i&1&&ht("change",function(a){return o.onChange(a.target.value)})("input",function(a){return o.onChange(a.target.value)})("blur",function(){return o.onTouched()})},features:[Ki([ib]),Vt]});let t=e;return t})();var ob=(()=>{let e=class e{};e.\u0275fac=function(i){return new(i||e)},e.\u0275mod=Le({type:e}),e.\u0275inj=ke({imports:[rb]});let t=e;return t})();var dp=(()=>{let e=class e{static withConfig(r){return{ngModule:e,providers:[{provide:cp,useValue:r.callSetDisabledState??ic}]}}};e.\u0275fac=function(i){return new(i||e)},e.\u0275mod=Le({type:e}),e.\u0275inj=ke({imports:[ob]});let t=e;return t})();var ab=(t,e)=>[t,e],te=function(t){return t.Christmas="Christmas",t.Easter="Easter",t.Halloween="Halloween",t.NewYearsEve="New Year's Eve",t.Default="Default",t}(te||{}),qt=function(t){return t.Background="Background",t.Text="Text",t.Button="Button",t.Heading="Heading",t.Slider="Slider",t}(qt||{}),fp=(()=>{let e=class e{constructor(r){this.http=r,this.subscriptions=[],this.speed=0,this.speedLimit=255,this.ip="127.0.0.1",this.realSpeed=null,this.COMPONENT_TYPE=qt}ngOnInit(){this.subscriptions.push(this.http.get("getSpeedLimit",{responseType:"text"}).subscribe(r=>{r!==""&&Number(r)>0&&Number(r)<256&&(this.speedLimit=Number(r))}),this.http.get("getLocalIP",{responseType:"text"}).subscribe(r=>{this.ip=r,this.initWebSocket(r)}))}ngOnDestroy(){this.unsubscribeAll()}initWebSocket(r){this.webSocket=new WebSocket(`ws://${r}:81`),this.webSocket.onopen=()=>{console.log("WebSocket connected"),this.subscriptions.push(this.http.get("getRealSpeed",{responseType:"text"}).subscribe(i=>{this.setRealSpeed(i)}))},this.webSocket.onmessage=i=>{console.log("Received message:",i.data);let o=String(i.data);o.startsWith("real:")?this.setRealSpeed(o.substring(5)):this.speed=this.mapValueTo100(Number(o))},this.webSocket.onclose=()=>{console.log("WebSocket connection closed")}}setRealSpeed(r){this.realSpeed=r==="unknown"?null:Number(r)}unsubscribeAll(){this.subscriptions.forEach(r=>r.unsubscribe())}mapValueTo255(r){let i=Math.min(Math.max(r,0),100);return Math.round(i/100*this.speedLimit)}mapValueTo100(r){let i=Math.min(Math.max(r,0),this.speedLimit);return Math.round(i/this.speedLimit*100)}changeSpeed(){let r=`/config?speed=${String(this.mapValueTo255(this.speed))}`;this.http.get(r,{responseType:"text"}).subscribe(i=>{console.log("HTTP request successful:",i)})}reverseDirection(){let r="/reverse";this.http.get(r,{responseType:"text"}).subscribe(i=>{console.log("HTTP request successful:",i)})}calculateEasterDate(r){let i=r%19,o=Math.floor(r/100),s=r%100,a=Math.floor(o/4),u=o%4,c=Math.floor((o+8)/25),l=Math.floor((o-c+1)/3),d=(19*i+o-a-l+15)%30,f=Math.floor(s/4),h=s%4,g=(32+2*u+2*f-d-h)%7,_=Math.floor((i+11*d+22*g)/451),b=Math.floor((d+g-7*_+114)/31),v=(d+g-7*_+114)%31+1;return new Date(r,b-1,v)}getCurrentSeason(){let r=new Date,i=r.getMonth()+1,o=r.getDate(),s=this.calculateEasterDate(r.getFullYear()),a=s.getMonth()+1,u=s.getDate();switch(i){case 3:if(i===a&&o>=u-2)return te.Easter;break;case 4:if(i===a&&o>=u-2)return te.Easter;break;case 10:if(o>=28&&o<=31)return te.Halloween;break;case 12:if(o>=1&&o<=30)return te.Christmas;if(o>=31&&o<=31)return te.NewYearsEve;break}return te.Default}getSeasonalClass(r){let i="";switch(r){case qt.Background:i="background";break;case qt.Text:i="text";break;case qt.Button:i="button";break;case qt.Heading:i="heading";break;case qt.Slider:i="slider";break;default:return console.error(`Component type ${r} unknown`),""}switch(this.getCurrentSeason()){case te.Easter:return`${i}__easter`;case te.Halloween:return`${i}__halloween`;case te.Christmas:return`${i}__christmas`;case te.NewYearsEve:return`${i}__new-year`;case te.Default:return`${i}__default`;default:return""}}getHeadingText(){switch(this.getCurrentSeason()){case te.Christmas:return"(Christmas Train)";case te.Easter:return"Easter Train";case te.Halloween:return"Halloween Train";case te.NewYearsEve:return"New Year Train";case te.Default:return"Train";default:return console.error("Cannot detect current season"),"Train"}}};e.\u0275fac=function(i){return new(i||e)(U(ou))},e.\u0275cmp=Ui({type:e,selectors:[["app-root"]],standalone:!0,features:[Ji],decls:10,vars:12,consts:[[1,"page",3,"ngClass"],[1,"heading",3,"ngClass"],[1,"button",3,"ngClass","click"],["type","range","min","0","max","100",1,"slider",3,"ngClass","ngModel","ngModelChange","input"],[1,"display"]],template:function(i,o){i&1&&(dt(0,"div",0)(1,"h1",1),sr(2),ft(),dt(3,"div",2),ht("click",function(){return o.reverseDirection()}),sr(4,"reverse"),ft(),dt(5,"input",3),ht("ngModelChange",function(a){return o.speed=a})("input",function(){return o.changeSpeed()}),ft(),dt(6,"div",4),sr(7),ft(),dt(8,"div"),sr(9),ft()()),i&2&&(bn("ngClass",Sf(9,ab,o.getSeasonalClass(o.COMPONENT_TYPE.Text),o.getSeasonalClass(o.COMPONENT_TYPE.Background))),Lt(1),bn("ngClass",o.getSeasonalClass(o.COMPONENT_TYPE.Heading)),Lt(1),za(o.getHeadingText()),Lt(1),bn("ngClass",o.getSeasonalClass(o.COMPONENT_TYPE.Button)),Lt(2),bn("ngClass",o.getSeasonalClass(o.COMPONENT_TYPE.Slider))("ngModel",o.speed),Lt(2),Ga("Speed: ",o.speed," - Real Speed: ",o.realSpeed??"?",""),Lt(2),Qi("train.local or ",o.ip,""))},dependencies:[Ka,$f,dp,Ro,sc,up,oc],encapsulation:2});let t=e;return t})();ih(fp,Gh).catch(t=>console.error(t));
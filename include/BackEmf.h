@@ -0,0 +1,145 @@
+#ifndef BACK_EMF_H
+#define BACK_EMF_H
+
+#include <stdint.h>
+
+// Back-EMF speed estimation. Everything in here is plain integer code without
+// Arduino or ESP-IDF dependencies, so it can be compiled and fed synthetic
+// waveforms on the host (see test/test_backemf).
+
+// Cycle budget of one addSample(uint16_t, uint16_t) call. At 80 kHz a sample
+// arrives every 12.5 us, 3000 cycles at 240 MHz, and the loop() task has to
+// do everything else in between. Checked on the target by test/test_backemf.
+#define BACK_EMF_SAMPLE_BUDGET_CYCLES 100
+
+struct BackEmfConfig {
+    uint16_t onThreshold;     // sample value at or above which it belongs to the PWM on-phase
+    uint8_t blankingSamples;  // samples dropped after each on-phase (inductive kick)
+    uint8_t filterShift;      // low-pass weight of a new sample is 1 / 2^filterShift
+    uint16_t fullScale;       // filtered back-EMF that corresponds to speed 255
+};
+
+class BackEmfEstimator {
+public:
+    explicit BackEmfEstimator(const BackEmfConfig& config)
+        : config(config),
+          speedScale((255UL << 16) / (config.fullScale ? config.fullScale : 1)) {
+    }
+
+    // Called once per ADC sample, keep it within BACK_EMF_SAMPLE_BUDGET_CYCLES:
+    // one compare, one shift and one add in the common case, no division and
+    // no floating point.
+    inline void addSample(uint16_t value) {
+        if (value >= config.onThreshold) {
+            blanking = config.blankingSamples;
+            return;
+        }
+        if (blanking > 0) {
+            blanking--;
+            return;
+        }
+        // exponential moving average, accumulator in Q16
+        accumulator += ((static_cast<int32_t>(value) << 16) - accumulator) >> config.filterShift;
+        samples++;
+    }
+
+    // Differential reading of both motor terminals. The terminal that is
+    // driven in the current direction carries the back-EMF, a negative
+    // difference means the motor still turns the other way and counts as 0.
+    inline void addSample(uint16_t driven, uint16_t other) {
+        addSample(driven > other ? driven - other : 0);
+    }
+
+    // Filtered back-EMF in ADC units
+    uint16_t filtered() const {
+        return static_cast<uint16_t>(accumulator >> 16);
+    }
+
+    // Estimated speed on the same 0-255 scale as the PWM value
+    uint8_t speed() const {
+        uint32_t s = (static_cast<uint32_t>(filtered()) * speedScale) >> 16;
+        return s > 255 ? 255 : static_cast<uint8_t>(s);
+    }
+
+    // Number of off-phase samples that went into the filter so far. When it
+    // doesn't move, the off-phase is too short to measure and speed() is stale.
+    uint32_t sampleCount() const {
+        return samples;
+    }
+
+    void reset() {
+        accumulator = 0;
+        blanking = 0;
+        samples = 0;
+    }
+
+private:
+    BackEmfConfig config;
+    uint32_t speedScale; // 255 / fullScale in Q16
+    int32_t accumulator = 0;
+    uint8_t blanking = 0;
+    uint32_t samples = 0;
+};
+
+// PI controller with the target speed as feed-forward, gains in Q8. The
+// output never exceeds maxOutput, the highest duty whose off-phase is still
+// long enough to measure; higher targets run open loop.
+class SpeedController {
+public:
+    SpeedController(int16_t kp, int16_t ki, uint8_t maxOutput) : kp(kp), ki(ki), maxOutput(maxOutput) {
+    }
+
+    // Called with a fresh measurement
+    uint8_t update(uint8_t target, uint8_t measured) {
+        if (target == 0 || target > maxOutput) {
+            reset();
+            return target;
+        }
+
+        int32_t error = static_cast<int32_t>(target) - measured;
+        int32_t nextIntegral = integral + error * ki;
+        if (nextIntegral > (255L << 8)) {
+            nextIntegral = 255L << 8;
+        } else if (nextIntegral < -(255L << 8)) {
+            nextIntegral = -(255L << 8);
+        }
+
+        int32_t output = target + ((error * kp + nextIntegral) >> 8);
+        // anti-windup: don't integrate further into a saturated output
+        bool saturatedHigh = output > maxOutput && error > 0;
+        bool saturatedLow = output < 0 && error < 0;
+        if (!saturatedHigh && !saturatedLow) {
+            integral = nextIntegral;
+        }
+        return clamp(output);
+    }
+
+    // Called when there is no fresh measurement: keep the last correction
+    // but don't integrate an error that can't be observed.
+    uint8_t hold(uint8_t target) {
+        if (target == 0 || target > maxOutput) {
+            reset();
+            return target;
+        }
+        return clamp(target + (integral >> 8));
+    }
+
+    void reset() {
+        integral = 0;
+    }
+
+private:
+    uint8_t clamp(int32_t output) const {
+        if (output < 0) {
+            return 0;
+        }
+        return output > maxOutput ? maxOutput : static_cast<uint8_t>(output);
+    }
+
+    int16_t kp;
+    int16_t ki;
+    uint8_t maxOutput;
+    int32_t integral = 0;
+};
+
+#endif
@@ -0,0 +1,129 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+// Scoped trace points for finding out what makes loop() or a web handler slow.
+// A scope that takes at least TRACE_MIN_DURATION_US is recorded as one
+// complete event into a ring buffer per core, faster ones are dropped so the
+// buffers reach back far enough to still hold a stutter once it is noticed.
+// The buffers are dumped as Chrome trace-event JSON at /trace and can be
+// opened in Perfetto (https://ui.perfetto.dev), one track per task.
+// Build with -DTRACE_ENABLED=1, otherwise every trace point compiles to nothing.
+
+#ifndef TRACE_ENABLED
+#define TRACE_ENABLED 0
+#endif
+
+#if TRACE_ENABLED
+
+#include <Arduino.h>
+#include <esp_timer.h>
+
+#define TRACE_BUFFER_SIZE 512 // events per core, must be a power of two
+
+#ifndef TRACE_MIN_DURATION_US
+#define TRACE_MIN_DURATION_US 200
+#endif
+
+struct TraceEvent {
+    const char* name;   // must be a string literal, only the pointer is stored
+    int64_t start;      // us since boot, the same clock on both cores
+    uint32_t duration;  // us
+    TaskHandle_t task;
+};
+
+struct TraceBuffer {
+    TraceEvent events[TRACE_BUFFER_SIZE];
+    uint32_t head;
+};
+
+// The cycle counter is read instead of esp_timer for every scope, see TraceScope
+#define TRACE_CYCLES_PER_US (F_CPU / 1000000)
+#define TRACE_MIN_DURATION_CYCLES (TRACE_MIN_DURATION_US * TRACE_CYCLES_PER_US)
+
+extern TraceBuffer traceBuffers[portNUM_PROCESSORS];
+extern uint32_t tracePauseCount; // number of dumps in progress, nothing is recorded while > 0
+
+inline void traceRecord(const char* name, int64_t start, uint32_t duration) {
+    if (__atomic_load_n(&tracePauseCount, __ATOMIC_RELAXED) != 0) {
+        return;
+    }
+    TraceBuffer& buffer = traceBuffers[xPortGetCoreID()];
+    // atomic because tasks on the same core may preempt each other
+    uint32_t index = __atomic_fetch_add(&buffer.head, 1, __ATOMIC_RELAXED) & (TRACE_BUFFER_SIZE - 1);
+    TraceEvent& event = buffer.events[index];
+    event.name = name;
+    event.start = start;
+    event.duration = duration;
+    event.task = xTaskGetCurrentTaskHandle();
+}
+
+// Records a scope that just ended, out of line since it is the rare case
+void traceRecordEnd(const char* name, uint32_t duration);
+
+// Most scopes are dropped, so they only read the cycle counter, the core ID
+// and the tick count, esp_timer_get_time() is left to the ones that are
+// recorded. The cycle counters of the two cores aren't in sync, a scope that
+// ends on the other core than it started is timed with the FreeRTOS tick.
+// Scopes have to stay below 2^32 cycles, about 17s at 240MHz.
+class TraceScope {
+public:
+    explicit TraceScope(const char* name)
+        : name(name), cycles(ESP.getCycleCount()), ticks(xTaskGetTickCount()), core(xPortGetCoreID()) {
+    }
+    ~TraceScope() {
+        if (xPortGetCoreID() == core) {
+            uint32_t elapsed = ESP.getCycleCount() - cycles;
+            if (elapsed >= TRACE_MIN_DURATION_CYCLES) {
+                traceRecordEnd(name, elapsed / TRACE_CYCLES_PER_US);
+            }
+        } else {
+            uint32_t elapsed = (xTaskGetTickCount() - ticks) * portTICK_PERIOD_MS * 1000;
+            if (elapsed >= TRACE_MIN_DURATION_US) {
+                traceRecordEnd(name, elapsed);
+            }
+        }
+    }
+
+private:
+    const char* name;
+    uint32_t cycles;
+    TickType_t ticks;
+    int core;
+};
+
+// Writes the buffers as JSON in pieces, for a chunked response. Recording is
+// paused from construction until the last writer is destroyed.
+class TraceJsonWriter {
+public:
+    TraceJsonWriter();
+    ~TraceJsonWriter();
+
+    // Fills up to maxLen bytes, returns 0 when the whole dump is written
+    size_t read(uint8_t* buffer, size_t maxLen);
+
+private:
+    bool nextLine();
+
+    TaskHandle_t tasks[16];
+    int taskCount = 0;
+    int section = 0; // header, task names, events, footer, done
+    int task = 0;
+    int core = 0;
+    uint32_t event = 0;
+    bool first = true;
+    char line[192];
+    size_t lineLength = 0;
+    size_t lineOffset = 0;
+};
+
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_(a, b)
+#define TRACE_SCOPE(name) TraceScope TRACE_CONCAT(traceScope, __LINE__)(name)
+
+#else
+
+#define TRACE_SCOPE(name)
+
+#endif
+
+#endif
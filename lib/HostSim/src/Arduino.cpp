@@ -0,0 +1,161 @@
+#include "Arduino.h"
+#include "esp_timer.h"
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+HardwareSerial Serial;
+EspClass ESP;
+
+static const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+static std::mutex pinMutex;
+static int pinValues[64];
+static FILE *pinLog = nullptr;
+static bool pinLogOpened = false;
+
+struct SimTask {
+    char name[16];
+};
+static thread_local SimTask currentTask = {"task"};
+
+const char* simFsRoot() {
+    const char *root = getenv("SIM_FS_ROOT");
+    return root ? root : "data";
+}
+
+uint16_t simPort(uint16_t port) {
+    const char *offset = getenv("SIM_PORT_OFFSET");
+    return port + (offset ? atoi(offset) : 8000);
+}
+
+int simPinValue(uint8_t pin) {
+    std::lock_guard<std::mutex> lock(pinMutex);
+    return pin < 64 ? pinValues[pin] : 0;
+}
+
+// expects pinMutex to be held
+static void writePinLog(const char* kind, uint8_t pin, int value) {
+    if (!pinLogOpened) {
+        pinLogOpened = true;
+        const char *path = getenv("SIM_PIN_LOG");
+        if (path) {
+            pinLog = fopen(path, "w");
+            if (pinLog) {
+                fprintf(pinLog, "micros,kind,pin,value\n");
+            }
+        }
+    }
+    if (pinLog) {
+        fprintf(pinLog, "%lu,%s,%u,%d\n", micros(), kind, pin, value);
+        fflush(pinLog);
+    }
+}
+
+void simLogPin(const char* kind, uint8_t pin, int value) {
+    std::lock_guard<std::mutex> lock(pinMutex);
+    writePinLog(kind, pin, value);
+}
+
+static void setPin(const char* kind, uint8_t pin, int value) {
+    std::lock_guard<std::mutex> lock(pinMutex);
+    if (pin < 64) {
+        pinValues[pin] = value;
+    }
+    writePinLog(kind, pin, value);
+}
+
+void simSetTaskName(const char* name) {
+    strlcpy(currentTask.name, name, sizeof(currentTask.name));
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+    return &currentTask;
+}
+
+char *pcTaskGetName(TaskHandle_t task) {
+    return task ? static_cast<SimTask*>(task)->name : currentTask.name;
+}
+
+int64_t esp_timer_get_time() {
+    return micros();
+}
+
+TickType_t xTaskGetTickCount() {
+    return millis() / portTICK_PERIOD_MS;
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+    simLogPin("mode", pin, mode);
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+    setPin("digital", pin, value ? HIGH : LOW);
+}
+
+int digitalRead(uint8_t pin) {
+    return simPinValue(pin) ? HIGH : LOW;
+}
+
+void analogWrite(uint8_t pin, int value) {
+    setPin("analog", pin, value);
+}
+
+void shiftOut(uint8_t dataPin, uint8_t clockPin, uint8_t bitOrder, uint8_t value) {
+    // one record per byte rather than per clock edge
+    simLogPin(bitOrder == MSBFIRST ? "shiftMSB" : "shiftLSB", dataPin, value);
+}
+
+unsigned long millis() {
+    return micros() / 1000;
+}
+
+unsigned long micros() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+void delay(uint32_t ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(uint32_t us) {
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+long random(long max) {
+    return max > 0 ? ::random() % max : 0;
+}
+
+long random(long min, long max) {
+    return min < max ? min + random(max - min) : min;
+}
+
+#if !defined(__GLIBC__) || __GLIBC__ < 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ < 38)
+size_t strlcpy(char *dst, const char *src, size_t size) {
+    size_t length = strlen(src);
+    if (size > 0) {
+        size_t n = length < size - 1 ? length : size - 1;
+        memcpy(dst, src, n);
+        dst[n] = '\0';
+    }
+    return length;
+}
+#endif
+
+size_t HardwareSerial::write(uint8_t c) {
+    return fwrite(&c, 1, 1, stdout);
+}
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size) {
+    return fwrite(buffer, 1, size, stdout);
+}
+
+void EspClass::restart() {
+    printf("ESP.restart() called, exiting simulator\n");
+    exit(0);
+}
+
+uint32_t EspClass::getCycleCount() {
+    int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count();
+    return static_cast<uint32_t>(ns * (F_CPU / 1000000) / 1000);
+}
@@ -0,0 +1,89 @@
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+// Host stand-in for the Arduino-ESP32 core. Pin writes are recorded instead of
+// driving hardware, time comes from the host clock.
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "WString.h"
+#include "Print.h"
+#include "HostSim.h"
+
+#define HIGH 0x1
+#define LOW 0x0
+
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+
+#define LSBFIRST 0
+#define MSBFIRST 1
+
+#define BIT(nr) (1UL << (nr))
+#define F(string_literal) (string_literal)
+
+#define portNUM_PROCESSORS 1
+#define portTICK_PERIOD_MS 1
+
+// Clock of the simulated CPU, getCycleCount() counts at this rate
+#ifndef F_CPU
+#define F_CPU 240000000L
+#endif
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+void analogWrite(uint8_t pin, int value);
+void shiftOut(uint8_t dataPin, uint8_t clockPin, uint8_t bitOrder, uint8_t value);
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+
+long random(long max);
+long random(long min, long max);
+
+// Every thread counts as a FreeRTOS task, named with simSetTaskName()
+typedef void* TaskHandle_t;
+typedef uint32_t TickType_t;
+
+inline int xPortGetCoreID() {
+    return 0;
+}
+TaskHandle_t xTaskGetCurrentTaskHandle();
+char *pcTaskGetName(TaskHandle_t task);
+TickType_t xTaskGetTickCount();
+
+#if !defined(__GLIBC__) || __GLIBC__ < 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ < 38)
+size_t strlcpy(char *dst, const char *src, size_t size);
+#endif
+
+class HardwareSerial : public Print {
+public:
+    void begin(unsigned long baud) {}
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t *buffer, size_t size) override;
+    using Print::write;
+    operator bool() const { return true; }
+};
+
+extern HardwareSerial Serial;
+
+class EspClass {
+public:
+    void restart();
+    uint32_t getCycleCount();
+};
+
+extern EspClass ESP;
+
+#endif
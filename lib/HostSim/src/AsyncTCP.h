@@ -0,0 +1,7 @@
+#ifndef ASYNC_TCP_H
+#define ASYNC_TCP_H
+
+// The host ESPAsyncWebServer uses plain sockets on its own thread, which
+// takes the role of the async_tcp task.
+
+#endif
@@ -0,0 +1,284 @@
+#include "ESPAsyncWebServer.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+static const char *statusText(int code) {
+    switch (code) {
+        case 200: return "OK";
+        case 400: return "Bad Request";
+        case 404: return "Not Found";
+        case 500: return "Internal Server Error";
+        default: return "";
+    }
+}
+
+static std::string urlDecode(const std::string &in) {
+    std::string out;
+    for (size_t i = 0; i < in.length(); i++) {
+        if (in[i] == '+') {
+            out += ' ';
+        } else if (in[i] == '%' && i + 2 < in.length()) {
+            out += static_cast<char>(strtol(in.substr(i + 1, 2).c_str(), nullptr, 16));
+            i += 2;
+        } else {
+            out += in[i];
+        }
+    }
+    return out;
+}
+
+static void sendAll(int socket, const char *data, size_t length) {
+    while (length > 0) {
+        ssize_t sent = ::send(socket, data, length, MSG_NOSIGNAL);
+        if (sent <= 0) {
+            return;
+        }
+        data += sent;
+        length -= sent;
+    }
+}
+
+String AsyncWebServerRequest::arg(const char *name) const {
+    auto it = args.find(name);
+    return it == args.end() ? String() : it->second;
+}
+
+void AsyncWebServerRequest::send(int code, const String &contentType, const String &content) {
+    send(new AsyncWebServerResponse(code, contentType, content.str()));
+}
+
+void AsyncWebServerRequest::send(FS &fs, const String &path, const String &contentType) {
+    File file = fs.open(path, "r");
+    if (!file) {
+        send(404);
+        return;
+    }
+    std::string content(file.size(), '\0');
+    content.resize(file.readBytes(&content[0], content.size()));
+    send(new AsyncWebServerResponse(200, contentType, content));
+}
+
+void AsyncWebServerRequest::send(AsyncWebServerResponse *response) {
+    delete this->response;
+    this->response = response;
+}
+
+AsyncResponseStream *AsyncWebServerRequest::beginResponseStream(const String &contentType) {
+    return new AsyncResponseStream(contentType);
+}
+
+AsyncWebServerResponse *AsyncWebServerRequest::beginChunkedResponse(const String &contentType, AwsResponseFiller callback) {
+    AsyncWebServerResponse *response = new AsyncWebServerResponse(200, contentType);
+    response->filler = callback;
+    return response;
+}
+
+bool AsyncCallbackWebHandler::canHandle(AsyncWebServerRequest *request) {
+    if (!onRequestFunction || !(method & request->method())) {
+        return false;
+    }
+    // same matching as ESPAsyncWebServer: exact or as a path prefix
+    return uri.length() == 0 || request->url() == uri || request->url().startsWith(uri + "/");
+}
+
+void AsyncCallbackWebHandler::handleRequest(AsyncWebServerRequest *request) {
+    onRequestFunction(request);
+}
+
+AsyncWebServer::~AsyncWebServer() {
+    if (serverThread.joinable()) {
+        serverThread.detach();
+    }
+    for (AsyncWebHandler *handler : handlers) {
+        delete handler;
+    }
+}
+
+AsyncCallbackWebHandler &AsyncWebServer::on(const char *uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest) {
+    AsyncCallbackWebHandler *handler = new AsyncCallbackWebHandler();
+    handler->setUri(uri);
+    handler->setMethod(method);
+    handler->onRequest(onRequest);
+    addHandler(handler);
+    return *handler;
+}
+
+AsyncWebHandler &AsyncWebServer::addHandler(AsyncWebHandler *handler) {
+    handlers.push_back(handler);
+    return *handler;
+}
+
+void AsyncWebServer::begin() {
+    listenSocket = socket(AF_INET, SOCK_STREAM, 0);
+    int reuse = 1;
+    setsockopt(listenSocket, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(simPort(port));
+    if (bind(listenSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || listen(listenSocket, 64) != 0) {
+        Serial.printf("AsyncWebServer: cannot listen on port %u\n", simPort(port));
+        close(listenSocket);
+        listenSocket = -1;
+        return;
+    }
+    Serial.printf("AsyncWebServer: listening on http://127.0.0.1:%u\n", simPort(port));
+    serverThread = std::thread(&AsyncWebServer::run, this);
+}
+
+void AsyncWebServer::run() {
+    simSetTaskName("async_tcp");
+    struct Connection {
+        int socket;
+        std::string buffer;
+    };
+    std::vector<Connection> connections;
+
+    while (true) {
+        std::vector<pollfd> fds;
+        fds.push_back({listenSocket, POLLIN, 0});
+        for (Connection &connection : connections) {
+            fds.push_back({connection.socket, POLLIN, 0});
+        }
+        if (poll(fds.data(), fds.size(), -1) < 0) {
+            continue;
+        }
+
+        if (fds[0].revents & POLLIN) {
+            int client = accept(listenSocket, nullptr, nullptr);
+            if (client >= 0) {
+                connections.push_back({client, ""});
+            }
+        }
+
+        for (size_t i = 1; i < fds.size(); i++) {
+            if (!(fds[i].revents & (POLLIN | POLLHUP | POLLERR))) {
+                continue;
+            }
+            Connection &connection = connections[i - 1];
+            char chunk[2048];
+            ssize_t received = recv(connection.socket, chunk, sizeof(chunk), 0);
+            if (received <= 0) {
+                close(connection.socket);
+                connection.socket = -1;
+                continue;
+            }
+            connection.buffer.append(chunk, received);
+
+            size_t end = connection.buffer.find("\r\n\r\n");
+            if (end != std::string::npos) {
+                handleConnection(connection.socket, connection.buffer.substr(0, end));
+                close(connection.socket);
+                connection.socket = -1;
+            } else if (connection.buffer.length() > 8192) {
+                static const char tooLarge[] = "HTTP/1.1 431 Request Header Fields Too Large\r\nConnection: close\r\n\r\n";
+                sendAll(connection.socket, tooLarge, sizeof(tooLarge) - 1);
+                close(connection.socket);
+                connection.socket = -1;
+            }
+        }
+
+        for (size_t i = 0; i < connections.size();) {
+            if (connections[i].socket < 0) {
+                connections.erase(connections.begin() + i);
+            } else {
+                i++;
+            }
+        }
+    }
+}
+
+void AsyncWebServer::handleConnection(int client, const std::string &head) {
+    size_t methodEnd = head.find(' ');
+    size_t targetEnd = head.find(' ', methodEnd + 1);
+    if (methodEnd == std::string::npos || targetEnd == std::string::npos) {
+        return;
+    }
+    std::string methodName = head.substr(0, methodEnd);
+    std::string target = head.substr(methodEnd + 1, targetEnd - methodEnd - 1);
+
+    WebRequestMethod method = HTTP_GET;
+    if (methodName == "POST") method = HTTP_POST;
+    else if (methodName == "DELETE") method = HTTP_DELETE;
+    else if (methodName == "PUT") method = HTTP_PUT;
+    else if (methodName == "PATCH") method = HTTP_PATCH;
+    else if (methodName == "HEAD") method = HTTP_HEAD;
+    else if (methodName == "OPTIONS") method = HTTP_OPTIONS;
+
+    std::map<std::string, String> args;
+    size_t queryStart = target.find('?');
+    std::string path = urlDecode(target.substr(0, queryStart));
+    if (queryStart != std::string::npos) {
+        std::string query = target.substr(queryStart + 1);
+        size_t position = 0;
+        while (position <= query.length()) {
+            size_t next = query.find('&', position);
+            if (next == std::string::npos) {
+                next = query.length();
+            }
+            std::string pair = query.substr(position, next - position);
+            size_t equals = pair.find('=');
+            if (!pair.empty()) {
+                args[urlDecode(pair.substr(0, equals))] = String(equals == std::string::npos ? "" : urlDecode(pair.substr(equals + 1)));
+            }
+            position = next + 1;
+        }
+    }
+
+    AsyncWebServerRequest request(method, String(path), args);
+    bool handled = false;
+    for (AsyncWebHandler *handler : handlers) {
+        if (handler->canHandle(&request)) {
+            handler->handleRequest(&request);
+            handled = true;
+            break;
+        }
+    }
+    if (!handled && notFoundFunction) {
+        notFoundFunction(&request);
+    }
+    if (!request.response) {
+        request.send(500);
+    }
+
+    AsyncWebServerResponse *response = request.response;
+    const char *contentType = response->contentType.length() ? response->contentType.c_str() : "text/plain";
+    char header[256];
+    int headerLength;
+    if (response->filler) {
+        headerLength = snprintf(header, sizeof(header),
+                                "HTTP/1.1 %d %s\r\nContent-Type: %s\r\nTransfer-Encoding: chunked\r\nConnection: close\r\n\r\n",
+                                response->code, statusText(response->code), contentType);
+    } else {
+        headerLength = snprintf(header, sizeof(header),
+                                "HTTP/1.1 %d %s\r\nContent-Type: %s\r\nContent-Length: %zu\r\nConnection: close\r\n\r\n",
+                                response->code, statusText(response->code), contentType, response->content.length());
+    }
+    sendAll(client, header, headerLength);
+
+    if (method == HTTP_HEAD) {
+        // nothing to send
+    } else if (response->filler) {
+        // pull the content in TCP segment sized pieces like the ESP32 does
+        uint8_t chunk[1460];
+        size_t index = 0;
+        size_t length;
+        while ((length = response->filler(chunk, sizeof(chunk), index)) > 0) {
+            char size[16];
+            int sizeLength = snprintf(size, sizeof(size), "%zx\r\n", length);
+            sendAll(client, size, sizeLength);
+            sendAll(client, reinterpret_cast<const char*>(chunk), length);
+            sendAll(client, "\r\n", 2);
+            index += length;
+        }
+        sendAll(client, "0\r\n\r\n", 5);
+    } else {
+        sendAll(client, response->content.data(), response->content.length());
+    }
+    shutdown(client, SHUT_WR);
+}
@@ -0,0 +1,131 @@
+#ifndef ESP_ASYNC_WEB_SERVER_H
+#define ESP_ASYNC_WEB_SERVER_H
+
+#include <functional>
+#include <map>
+#include <thread>
+#include <vector>
+#include <Arduino.h>
+#include <FS.h>
+
+// ESPAsyncWebServer on plain sockets. A single server thread accepts the
+// connections and runs the handlers one after another, like the async_tcp
+// task does on the ESP32. Every response closes its connection.
+
+typedef enum {
+    HTTP_GET = 0b00000001,
+    HTTP_POST = 0b00000010,
+    HTTP_DELETE = 0b00000100,
+    HTTP_PUT = 0b00001000,
+    HTTP_PATCH = 0b00010000,
+    HTTP_HEAD = 0b00100000,
+    HTTP_OPTIONS = 0b01000000,
+    HTTP_ANY = 0b01111111,
+} WebRequestMethod;
+
+typedef uint8_t WebRequestMethodComposite;
+
+class AsyncWebServerRequest;
+
+typedef std::function<void(AsyncWebServerRequest *request)> ArRequestHandlerFunction;
+typedef std::function<size_t(uint8_t *buffer, size_t maxLen, size_t index)> AwsResponseFiller;
+
+class AsyncWebServerResponse {
+public:
+    AsyncWebServerResponse(int code, const String &contentType, const std::string &content = "")
+        : code(code), contentType(contentType), content(content) {}
+    virtual ~AsyncWebServerResponse() {}
+
+    int code;
+    String contentType;
+    std::string content;
+    AwsResponseFiller filler; // set for chunked responses, content is unused then
+};
+
+class AsyncResponseStream : public AsyncWebServerResponse, public Print {
+public:
+    explicit AsyncResponseStream(const String &contentType) : AsyncWebServerResponse(200, contentType) {}
+
+    size_t write(uint8_t c) override {
+        content.push_back(static_cast<char>(c));
+        return 1;
+    }
+    size_t write(const uint8_t *buffer, size_t size) override {
+        content.append(reinterpret_cast<const char*>(buffer), size);
+        return size;
+    }
+    using Print::write;
+};
+
+class AsyncWebServerRequest {
+public:
+    AsyncWebServerRequest(WebRequestMethod method, const String &url, const std::map<std::string, String> &args)
+        : requestMethod(method), requestUrl(url), args(args) {}
+    ~AsyncWebServerRequest() { delete response; }
+
+    WebRequestMethod method() const { return requestMethod; }
+    const String &url() const { return requestUrl; }
+
+    bool hasArg(const char *name) const { return args.count(name) > 0; }
+    String arg(const char *name) const;
+
+    void send(int code, const String &contentType = String(), const String &content = String());
+    void send(FS &fs, const String &path, const String &contentType = String());
+    void send(AsyncWebServerResponse *response);
+    AsyncResponseStream *beginResponseStream(const String &contentType);
+    AsyncWebServerResponse *beginChunkedResponse(const String &contentType, AwsResponseFiller callback);
+
+    // set by one of the send() calls, written out by the server afterwards
+    AsyncWebServerResponse *response = nullptr;
+
+private:
+    WebRequestMethod requestMethod;
+    String requestUrl;
+    std::map<std::string, String> args;
+};
+
+class AsyncWebHandler {
+public:
+    virtual ~AsyncWebHandler() {}
+    virtual bool canHandle(AsyncWebServerRequest *request) { return false; }
+    virtual void handleRequest(AsyncWebServerRequest *request) {}
+};
+
+class AsyncCallbackWebHandler : public AsyncWebHandler {
+public:
+    void setUri(const String &uri) { this->uri = uri; }
+    void setMethod(WebRequestMethodComposite method) { this->method = method; }
+    void onRequest(ArRequestHandlerFunction fn) { onRequestFunction = fn; }
+
+    bool canHandle(AsyncWebServerRequest *request) override;
+    void handleRequest(AsyncWebServerRequest *request) override;
+
+private:
+    String uri;
+    WebRequestMethodComposite method = HTTP_ANY;
+    ArRequestHandlerFunction onRequestFunction;
+};
+
+class AsyncWebServer {
+public:
+    explicit AsyncWebServer(uint16_t port) : port(port) {}
+    ~AsyncWebServer();
+
+    AsyncCallbackWebHandler &on(const char *uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest);
+    AsyncWebHandler &addHandler(AsyncWebHandler *handler);
+    void onNotFound(ArRequestHandlerFunction fn) { notFoundFunction = fn; }
+
+    void begin();
+
+private:
+    void run();
+    void handleConnection(int client, const std::string &head);
+
+    uint16_t port;
+    int listenSocket = -1;
+    std::thread serverThread;
+    std::vector<AsyncWebHandler*> handlers;
+    ArRequestHandlerFunction notFoundFunction;
+};
+
+#endif
@@ -0,0 +1,15 @@
+#ifndef ESP_MDNS_H
+#define ESP_MDNS_H
+
+#include <Arduino.h>
+
+// mDNS is left to the host, these calls only succeed
+class MDNSResponder {
+public:
+    bool begin(const String &hostName) { return true; }
+    void addService(const char *service, const char *proto, uint16_t port) {}
+};
+
+extern MDNSResponder MDNS;
+
+#endif
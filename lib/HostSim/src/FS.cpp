@@ -0,0 +1,70 @@
+#include "FS.h"
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace fs {
+
+int File::available() {
+    if (!file) {
+        return 0;
+    }
+    long position = ftell(file.get());
+    return static_cast<int>(size() - position);
+}
+
+int File::read() {
+    return file ? fgetc(file.get()) : -1;
+}
+
+size_t File::readBytes(char *buffer, size_t length) {
+    return file ? fread(buffer, 1, length, file.get()) : 0;
+}
+
+size_t File::write(uint8_t c) {
+    return write(&c, 1);
+}
+
+size_t File::write(const uint8_t *buffer, size_t size) {
+    return file ? fwrite(buffer, 1, size, file.get()) : 0;
+}
+
+size_t File::size() {
+    struct stat info;
+    if (!file || fstat(fileno(file.get()), &info) != 0) {
+        return 0;
+    }
+    return info.st_size;
+}
+
+File FS::open(const String &path, const char *mode) {
+    std::string p = hostPath(path);
+    struct stat info;
+    // directories can't be read like files, same as on LittleFS
+    if (mode[0] == 'r' && (stat(p.c_str(), &info) != 0 || S_ISDIR(info.st_mode))) {
+        return File();
+    }
+    return File(fopen(p.c_str(), mode));
+}
+
+bool FS::exists(const String &path) {
+    return access(hostPath(path).c_str(), F_OK) == 0;
+}
+
+bool FS::remove(const String &path) {
+    return ::remove(hostPath(path).c_str()) == 0;
+}
+
+std::string FS::hostPath(const String &path) const {
+    std::string p = path.str();
+    // keep requests inside the root directory
+    if (p.find("..") != std::string::npos) {
+        return root + "/.invalid";
+    }
+    if (p.empty() || p[0] != '/') {
+        p = "/" + p;
+    }
+    return root + p;
+}
+
+}
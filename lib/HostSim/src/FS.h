@@ -0,0 +1,50 @@
+#ifndef FS_H
+#define FS_H
+
+#include <memory>
+#include <stdio.h>
+#include <Arduino.h>
+
+namespace fs {
+
+// File backed by a host FILE*, closes itself when the last copy goes away
+class File {
+public:
+    File() {}
+    explicit File(FILE *file) : file(file, fclose) {}
+
+    operator bool() const { return file != nullptr; }
+
+    int available();
+    int read();
+    size_t readBytes(char *buffer, size_t length);
+    size_t write(uint8_t c);
+    size_t write(const uint8_t *buffer, size_t size);
+    size_t size();
+    void close() { file.reset(); }
+
+private:
+    std::shared_ptr<FILE> file;
+};
+
+// Maps absolute firmware paths onto a directory of the host
+class FS {
+public:
+    explicit FS(const char *root) : root(root) {}
+
+    File open(const String &path, const char *mode = "r");
+    bool exists(const String &path);
+    bool remove(const String &path);
+
+protected:
+    std::string hostPath(const String &path) const;
+
+    std::string root;
+};
+
+}
+
+using fs::FS;
+using fs::File;
+
+#endif
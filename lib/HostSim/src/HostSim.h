@@ -0,0 +1,39 @@
+#ifndef HOST_SIM_H
+#define HOST_SIM_H
+
+#include <stdint.h>
+
+// Settings of the host simulator, all read from environment variables:
+//   SIM_FS_ROOT      directory that backs LittleFS (default "data")
+//   SIM_PORT_OFFSET  added to every server port, so no root is needed (default 8000)
+//   SIM_PIN_LOG      CSV file that records every pin write (default: off)
+
+// Wiring of the simulated motor: PWM pin, H-bridge inputs and the ADC1
+// channels that sense the motor terminals OUT3 and OUT4
+#ifndef SIM_MOTOR_PIN
+#define SIM_MOTOR_PIN 4
+#endif
+#ifndef SIM_MOTOR_IN3
+#define SIM_MOTOR_IN3 6
+#endif
+#ifndef SIM_MOTOR_IN4
+#define SIM_MOTOR_IN4 5
+#endif
+#ifndef SIM_SENSE_OUT3_CHANNEL
+#define SIM_SENSE_OUT3_CHANNEL 6
+#endif
+#ifndef SIM_SENSE_OUT4_CHANNEL
+#define SIM_SENSE_OUT4_CHANNEL 7
+#endif
+
+const char* simFsRoot();
+uint16_t simPort(uint16_t port);
+
+// Last value written to a pin with digitalWrite() or analogWrite()
+int simPinValue(uint8_t pin);
+void simLogPin(const char* kind, uint8_t pin, int value);
+
+// Name of the calling thread as reported by pcTaskGetName()
+void simSetTaskName(const char* name);
+
+#endif
@@ -0,0 +1,18 @@
+#include "LittleFS.h"
+
+#include <sys/stat.h>
+
+fs::LittleFSFS LittleFS;
+
+namespace fs {
+
+bool LittleFSFS::begin(bool formatOnFail) {
+    root = simFsRoot();
+    struct stat info;
+    if (stat(root.c_str(), &info) != 0 || !S_ISDIR(info.st_mode)) {
+        return false;
+    }
+    return true;
+}
+
+}
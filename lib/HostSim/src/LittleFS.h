@@ -0,0 +1,20 @@
+#ifndef LITTLE_FS_H
+#define LITTLE_FS_H
+
+#include "FS.h"
+
+namespace fs {
+
+class LittleFSFS : public FS {
+public:
+    LittleFSFS() : FS("") {}
+
+    // the directory is read from SIM_FS_ROOT on mount
+    bool begin(bool formatOnFail = false);
+};
+
+}
+
+extern fs::LittleFSFS LittleFS;
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef NTP_CLIENT_H
+#define NTP_CLIENT_H
+
+#include <time.h>
+#include "WiFiUdp.h"
+
+// Reports the host's UTC clock plus the configured offset
+class NTPClient {
+public:
+    NTPClient(WiFiUDP &udp, const char *poolServerName) {}
+
+    void begin() {}
+    bool update() { return true; }
+    void setTimeOffset(int offset) { timeOffset = offset; }
+
+    unsigned long getEpochTime() const { return time(nullptr) + timeOffset; }
+    int getHours() const { return (getEpochTime() % 86400L) / 3600; }
+    int getMinutes() const { return (getEpochTime() % 3600) / 60; }
+    int getSeconds() const { return getEpochTime() % 60; }
+
+private:
+    long timeOffset = 0;
+};
+
+#endif
@@ -0,0 +1,79 @@
+#include "Print.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+size_t Print::write(const uint8_t *buffer, size_t size) {
+    size_t n = 0;
+    while (size--) {
+        n += write(*buffer++);
+    }
+    return n;
+}
+
+size_t Print::write(const char *str) {
+    return write(reinterpret_cast<const uint8_t*>(str), strlen(str));
+}
+
+size_t Print::printf(const char *format, ...) {
+    char small[128];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(small, sizeof(small), format, args);
+    va_end(args);
+    if (length < 0) {
+        return 0;
+    }
+    if (static_cast<size_t>(length) < sizeof(small)) {
+        return write(reinterpret_cast<const uint8_t*>(small), length);
+    }
+
+    char *large = new char[length + 1];
+    va_start(args, format);
+    vsnprintf(large, length + 1, format, args);
+    va_end(args);
+    size_t n = write(reinterpret_cast<const uint8_t*>(large), length);
+    delete[] large;
+    return n;
+}
+
+size_t Print::print(const char *str) {
+    return write(str);
+}
+
+size_t Print::print(const String &str) {
+    return write(reinterpret_cast<const uint8_t*>(str.c_str()), str.length());
+}
+
+size_t Print::print(char c) {
+    return write(static_cast<uint8_t>(c));
+}
+
+size_t Print::print(int value, int base) {
+    return print(static_cast<long>(value), base);
+}
+
+size_t Print::print(unsigned int value, int base) {
+    return print(static_cast<unsigned long>(value), base);
+}
+
+size_t Print::print(long value, int base) {
+    return printf(base == HEX ? "%lx" : "%ld", value);
+}
+
+size_t Print::print(unsigned long value, int base) {
+    return printf(base == HEX ? "%lx" : "%lu", value);
+}
+
+size_t Print::print(double value, int digits) {
+    return printf("%.*f", digits, value);
+}
+
+size_t Print::print(const Printable &printable) {
+    return printable.printTo(*this);
+}
+
+size_t Print::println() {
+    return write("\r\n");
+}
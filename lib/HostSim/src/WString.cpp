@@ -0,0 +1,66 @@
+#include "WString.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+String::String(double number, unsigned int decimalPlaces) {
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "%.*f", decimalPlaces, number);
+    value = buffer;
+}
+
+String String::substring(unsigned int from) const {
+    return substring(from, value.length());
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+    if (from > to) {
+        unsigned int temp = from;
+        from = to;
+        to = temp;
+    }
+    if (from >= value.length()) {
+        return String();
+    }
+    if (to > value.length()) {
+        to = value.length();
+    }
+    return String(value.substr(from, to - from));
+}
+
+int String::indexOf(char c, unsigned int from) const {
+    size_t index = value.find(c, from);
+    return index == std::string::npos ? -1 : static_cast<int>(index);
+}
+
+int String::indexOf(const String &str, unsigned int from) const {
+    size_t index = value.find(str.value, from);
+    return index == std::string::npos ? -1 : static_cast<int>(index);
+}
+
+bool String::startsWith(const String &prefix) const {
+    return value.compare(0, prefix.value.length(), prefix.value) == 0;
+}
+
+bool String::endsWith(const String &suffix) const {
+    return value.length() >= suffix.value.length()
+        && value.compare(value.length() - suffix.value.length(), suffix.value.length(), suffix.value) == 0;
+}
+
+void String::toCharArray(char *buffer, unsigned int size) const {
+    if (size == 0) {
+        return;
+    }
+    size_t n = value.length() < size - 1 ? value.length() : size - 1;
+    memcpy(buffer, value.c_str(), n);
+    buffer[n] = '\0';
+}
+
+long String::toInt() const {
+    return atol(value.c_str());
+}
+
+float String::toFloat() const {
+    return atof(value.c_str());
+}
@@ -0,0 +1,49 @@
+#ifndef WSTRING_H
+#define WSTRING_H
+
+#include <string>
+
+// Arduino String on top of std::string, covering what the firmware uses
+class String {
+public:
+    String(const char *str = "") : value(str ? str : "") {}
+    String(const std::string &str) : value(str) {}
+    String(char c) : value(1, c) {}
+    String(int number) : value(std::to_string(number)) {}
+    String(unsigned int number) : value(std::to_string(number)) {}
+    String(long number) : value(std::to_string(number)) {}
+    String(unsigned long number) : value(std::to_string(number)) {}
+    String(float number, unsigned int decimalPlaces = 2) : String(static_cast<double>(number), decimalPlaces) {}
+    String(double number, unsigned int decimalPlaces = 2);
+
+    unsigned int length() const { return value.length(); }
+    const char *c_str() const { return value.c_str(); }
+    const std::string &str() const { return value; }
+
+    char charAt(unsigned int index) const { return index < value.length() ? value[index] : 0; }
+    char operator[](unsigned int index) const { return charAt(index); }
+    char &operator[](unsigned int index) { return value[index]; }
+
+    String substring(unsigned int from) const;
+    String substring(unsigned int from, unsigned int to) const;
+    int indexOf(char c, unsigned int from = 0) const;
+    int indexOf(const String &str, unsigned int from = 0) const;
+    bool startsWith(const String &prefix) const;
+    bool endsWith(const String &suffix) const;
+    bool equals(const String &other) const { return value == other.value; }
+    void toCharArray(char *buffer, unsigned int size) const;
+    long toInt() const;
+    float toFloat() const;
+
+    String &operator+=(const String &other) { value += other.value; return *this; }
+    bool operator==(const String &other) const { return value == other.value; }
+    bool operator!=(const String &other) const { return value != other.value; }
+    bool operator<(const String &other) const { return value < other.value; }
+
+    friend String operator+(const String &lhs, const String &rhs) { return String(lhs.value + rhs.value); }
+
+private:
+    std::string value;
+};
+
+#endif
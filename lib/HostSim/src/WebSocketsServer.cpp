@@ -0,0 +1,304 @@
+#include "WebSocketsServer.h"
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#define WS_OPCODE_TEXT 0x1
+#define WS_OPCODE_CLOSE 0x8
+#define WS_OPCODE_PING 0x9
+#define WS_OPCODE_PONG 0xA
+
+static uint32_t rotateLeft(uint32_t value, int bits) {
+    return (value << bits) | (value >> (32 - bits));
+}
+
+// only used for the Sec-WebSocket-Accept header
+static std::string sha1(const std::string &message) {
+    uint32_t h[5] = {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0};
+
+    std::string data = message;
+    uint64_t bitLength = static_cast<uint64_t>(message.length()) * 8;
+    data += static_cast<char>(0x80);
+    while (data.length() % 64 != 56) {
+        data += static_cast<char>(0);
+    }
+    for (int i = 7; i >= 0; i--) {
+        data += static_cast<char>(bitLength >> (i * 8));
+    }
+
+    for (size_t chunk = 0; chunk < data.length(); chunk += 64) {
+        uint32_t w[80];
+        for (int i = 0; i < 16; i++) {
+            w[i] = (static_cast<uint8_t>(data[chunk + i * 4]) << 24)
+                 | (static_cast<uint8_t>(data[chunk + i * 4 + 1]) << 16)
+                 | (static_cast<uint8_t>(data[chunk + i * 4 + 2]) << 8)
+                 | static_cast<uint8_t>(data[chunk + i * 4 + 3]);
+        }
+        for (int i = 16; i < 80; i++) {
+            w[i] = rotateLeft(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+        }
+
+        uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+        for (int i = 0; i < 80; i++) {
+            uint32_t f, k;
+            if (i < 20) {
+                f = (b & c) | (~b & d);
+                k = 0x5A827999;
+            } else if (i < 40) {
+                f = b ^ c ^ d;
+                k = 0x6ED9EBA1;
+            } else if (i < 60) {
+                f = (b & c) | (b & d) | (c & d);
+                k = 0x8F1BBCDC;
+            } else {
+                f = b ^ c ^ d;
+                k = 0xCA62C1D6;
+            }
+            uint32_t temp = rotateLeft(a, 5) + f + e + k + w[i];
+            e = d;
+            d = c;
+            c = rotateLeft(b, 30);
+            b = a;
+            a = temp;
+        }
+        h[0] += a;
+        h[1] += b;
+        h[2] += c;
+        h[3] += d;
+        h[4] += e;
+    }
+
+    std::string digest;
+    for (int i = 0; i < 5; i++) {
+        for (int j = 3; j >= 0; j--) {
+            digest += static_cast<char>(h[i] >> (j * 8));
+        }
+    }
+    return digest;
+}
+
+static std::string base64(const std::string &data) {
+    static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string out;
+    for (size_t i = 0; i < data.length(); i += 3) {
+        uint32_t n = static_cast<uint8_t>(data[i]) << 16;
+        if (i + 1 < data.length()) n |= static_cast<uint8_t>(data[i + 1]) << 8;
+        if (i + 2 < data.length()) n |= static_cast<uint8_t>(data[i + 2]);
+        out += alphabet[(n >> 18) & 63];
+        out += alphabet[(n >> 12) & 63];
+        out += i + 1 < data.length() ? alphabet[(n >> 6) & 63] : '=';
+        out += i + 2 < data.length() ? alphabet[n & 63] : '=';
+    }
+    return out;
+}
+
+WebSocketsServer::~WebSocketsServer() {
+    for (Client &client : clients) {
+        close(client.socket);
+    }
+    if (listenSocket >= 0) {
+        close(listenSocket);
+    }
+}
+
+void WebSocketsServer::begin() {
+    listenSocket = socket(AF_INET, SOCK_STREAM, 0);
+    int reuse = 1;
+    setsockopt(listenSocket, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(simPort(port));
+    if (bind(listenSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || listen(listenSocket, 64) != 0) {
+        Serial.printf("WebSocketsServer: cannot listen on port %u\n", simPort(port));
+        close(listenSocket);
+        listenSocket = -1;
+        return;
+    }
+    fcntl(listenSocket, F_SETFL, O_NONBLOCK);
+    Serial.printf("WebSocketsServer: listening on ws://127.0.0.1:%u\n", simPort(port));
+}
+
+void WebSocketsServer::loop() {
+    if (listenSocket < 0) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(clientsMutex);
+
+    int socket;
+    while ((socket = accept(listenSocket, nullptr, nullptr)) >= 0) {
+        fcntl(socket, F_SETFL, O_NONBLOCK);
+        clients.push_back({socket, false, false, ""});
+    }
+
+    for (size_t i = 0; i < clients.size();) {
+        Client &client = clients[i];
+        bool open = !client.failed && (client.connected ? readFrames(client) : handshake(client));
+        if (open) {
+            i++;
+        } else {
+            close(client.socket);
+            clients.erase(clients.begin() + i);
+        }
+    }
+}
+
+bool WebSocketsServer::handshake(Client &client) {
+    char chunk[1024];
+    ssize_t received = recv(client.socket, chunk, sizeof(chunk), 0);
+    if (received == 0 || (received < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) {
+        return false;
+    }
+    if (received > 0) {
+        client.buffer.append(chunk, received);
+    }
+
+    size_t end = client.buffer.find("\r\n\r\n");
+    if (end == std::string::npos) {
+        return client.buffer.length() < 4096;
+    }
+
+    std::string head = client.buffer.substr(0, end);
+    client.buffer.erase(0, end + 4);
+
+    // header names are case-insensitive
+    std::string lower = head;
+    for (char &c : lower) {
+        c = tolower(c);
+    }
+    size_t keyStart = lower.find("sec-websocket-key:");
+    if (keyStart == std::string::npos) {
+        static const char badRequest[] = "HTTP/1.1 400 Bad Request\r\nConnection: close\r\n\r\n";
+        send(client.socket, badRequest, sizeof(badRequest) - 1, MSG_NOSIGNAL);
+        return false;
+    }
+    keyStart += 18;
+    size_t keyEnd = head.find("\r\n", keyStart);
+    std::string key = head.substr(keyStart, keyEnd == std::string::npos ? std::string::npos : keyEnd - keyStart);
+    key.erase(0, key.find_first_not_of(' '));
+    key.erase(key.find_last_not_of(' ') + 1);
+
+    std::string response = "HTTP/1.1 101 Switching Protocols\r\n"
+                           "Upgrade: websocket\r\n"
+                           "Connection: Upgrade\r\n"
+                           "Sec-WebSocket-Accept: " + base64(sha1(key + "258EAFA5-E914-47DA-95CA-C5AB0DC85B11")) + "\r\n\r\n";
+    if (send(client.socket, response.data(), response.length(), MSG_NOSIGNAL) != static_cast<ssize_t>(response.length())) {
+        return false;
+    }
+    client.connected = true;
+    return true;
+}
+
+bool WebSocketsServer::readFrames(Client &client) {
+    char chunk[1024];
+    ssize_t received;
+    while ((received = recv(client.socket, chunk, sizeof(chunk), 0)) > 0) {
+        client.buffer.append(chunk, received);
+    }
+    if (received == 0 || (received < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) {
+        return false;
+    }
+
+    while (client.buffer.length() >= 2) {
+        const uint8_t *data = reinterpret_cast<const uint8_t*>(client.buffer.data());
+        uint8_t opcode = data[0] & 0x0F;
+        bool masked = data[1] & 0x80;
+        uint64_t length = data[1] & 0x7F;
+        size_t headerLength = 2;
+        if (length == 126) {
+            if (client.buffer.length() < 4) return true;
+            length = (data[2] << 8) | data[3];
+            headerLength = 4;
+        } else if (length == 127) {
+            if (client.buffer.length() < 10) return true;
+            length = 0;
+            for (int i = 0; i < 8; i++) {
+                length = (length << 8) | data[2 + i];
+            }
+            headerLength = 10;
+        }
+        size_t maskOffset = headerLength;
+        if (masked) {
+            headerLength += 4;
+        }
+        if (client.buffer.length() < headerLength + length) {
+            return true;
+        }
+
+        std::string payload = client.buffer.substr(headerLength, length);
+        if (masked) {
+            for (size_t i = 0; i < payload.length(); i++) {
+                payload[i] ^= data[maskOffset + (i % 4)];
+            }
+        }
+        client.buffer.erase(0, headerLength + length);
+
+        if (opcode == WS_OPCODE_CLOSE) {
+            sendFrame(client, WS_OPCODE_CLOSE, payload.data(), payload.length() < 2 ? payload.length() : 2);
+            return false;
+        } else if (opcode == WS_OPCODE_PING) {
+            sendFrame(client, WS_OPCODE_PONG, payload.data(), payload.length());
+        }
+        // the firmware doesn't handle incoming messages
+    }
+    return true;
+}
+
+bool WebSocketsServer::sendFrame(Client &client, uint8_t opcode, const char *payload, size_t length) {
+    std::string frame;
+    frame += static_cast<char>(0x80 | opcode);
+    if (length < 126) {
+        frame += static_cast<char>(length);
+    } else if (length < 65536) {
+        frame += static_cast<char>(126);
+        frame += static_cast<char>(length >> 8);
+        frame += static_cast<char>(length);
+    } else {
+        frame += static_cast<char>(127);
+        for (int i = 7; i >= 0; i--) {
+            frame += static_cast<char>(static_cast<uint64_t>(length) >> (i * 8));
+        }
+    }
+    frame.append(payload, length);
+
+    // Called with clientsMutex held, so never wait for the socket. A client
+    // that can't take a whole frame (full send buffer, partial write or an
+    // error) is disconnected like the links2004 library does, it would
+    // otherwise be left with half a frame on the wire.
+    ssize_t sent = send(client.socket, frame.data(), frame.length(), MSG_NOSIGNAL);
+    if (sent != static_cast<ssize_t>(frame.length())) {
+        client.failed = true;
+        shutdown(client.socket, SHUT_RDWR);
+        return false;
+    }
+    return true;
+}
+
+bool WebSocketsServer::broadcastTXT(const char *payload, size_t length) {
+    if (length == 0) {
+        length = strlen(payload);
+    }
+    std::lock_guard<std::mutex> lock(clientsMutex);
+    bool ok = true;
+    for (Client &client : clients) {
+        if (client.connected && !client.failed && !sendFrame(client, WS_OPCODE_TEXT, payload, length)) {
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+int WebSocketsServer::connectedClients() {
+    std::lock_guard<std::mutex> lock(clientsMutex);
+    int count = 0;
+    for (const Client &client : clients) {
+        count += client.connected && !client.failed ? 1 : 0;
+    }
+    return count;
+}
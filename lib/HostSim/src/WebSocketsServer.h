@@ -0,0 +1,43 @@
+#ifndef WEBSOCKETS_SERVER_H
+#define WEBSOCKETS_SERVER_H
+
+#include <mutex>
+#include <vector>
+#include <Arduino.h>
+
+// WebSocket server on plain sockets. Connections are accepted and read in
+// loop() like with the links2004 library; broadcasts may come from the HTTP
+// thread, so the client list is guarded by a mutex.
+class WebSocketsServer {
+public:
+    explicit WebSocketsServer(uint16_t port, const String &origin = "", const String &protocol = "arduino")
+        : port(port) {}
+    ~WebSocketsServer();
+
+    void begin();
+    void loop();
+
+    bool broadcastTXT(const char *payload, size_t length = 0);
+    bool broadcastTXT(String &payload) { return broadcastTXT(payload.c_str(), payload.length()); }
+
+    int connectedClients();
+
+private:
+    struct Client {
+        int socket;
+        bool connected;
+        bool failed; // a send failed, loop() drops the client
+        std::string buffer;
+    };
+
+    bool handshake(Client &client);
+    bool readFrames(Client &client);
+    bool sendFrame(Client &client, uint8_t opcode, const char *payload, size_t length);
+
+    uint16_t port;
+    int listenSocket = -1;
+    std::mutex clientsMutex;
+    std::vector<Client> clients;
+};
+
+#endif
@@ -0,0 +1,48 @@
+#ifndef WIFI_H
+#define WIFI_H
+
+#include <Arduino.h>
+
+// The host is always "connected", servers are reachable on localhost
+
+typedef enum {
+    WL_IDLE_STATUS = 0,
+    WL_CONNECTED = 3,
+    WL_DISCONNECTED = 6
+} wl_status_t;
+
+class IPAddress : public Printable {
+public:
+    IPAddress(uint8_t a = 0, uint8_t b = 0, uint8_t c = 0, uint8_t d = 0) : bytes{a, b, c, d} {}
+
+    String toString() const {
+        char buffer[16];
+        snprintf(buffer, sizeof(buffer), "%u.%u.%u.%u", bytes[0], bytes[1], bytes[2], bytes[3]);
+        return String(buffer);
+    }
+
+    size_t printTo(Print& p) const override {
+        return p.print(toString());
+    }
+
+private:
+    uint8_t bytes[4];
+};
+
+class WiFiClass {
+public:
+    bool setHostname(const char *name) {
+        hostname = name;
+        return true;
+    }
+    const char *getHostname() { return hostname.c_str(); }
+    wl_status_t status() { return WL_CONNECTED; }
+    IPAddress localIP() { return IPAddress(127, 0, 0, 1); }
+
+private:
+    String hostname = "esp32";
+};
+
+extern WiFiClass WiFi;
+
+#endif
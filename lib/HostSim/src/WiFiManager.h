@@ -0,0 +1,37 @@
+#ifndef WIFI_MANAGER_H
+#define WIFI_MANAGER_H
+
+#include <functional>
+#include <Arduino.h>
+
+// There is no config portal on the host, autoConnect() succeeds right away
+// and custom parameters keep their default values.
+
+class WiFiManagerParameter {
+public:
+    WiFiManagerParameter(const char *id, const char *label, const char *defaultValue, int length)
+        : id(id), label(label), value(defaultValue ? defaultValue : "") {}
+
+    const char *getID() const { return id; }
+    const char *getValue() const { return value.c_str(); }
+
+private:
+    const char *id;
+    const char *label;
+    String value;
+};
+
+class WiFiManager {
+public:
+    bool addParameter(WiFiManagerParameter *p) { return true; }
+    void setSaveConfigCallback(std::function<void()> callback) { saveConfigCallback = callback; }
+    void setConnectTimeout(unsigned long seconds) {}
+    void setConnectRetries(uint8_t retries) {}
+    bool autoConnect(const char *apName) { return true; }
+    void resetSettings() { Serial.println("WiFiManager: resetSettings() ignored on host"); }
+
+private:
+    std::function<void()> saveConfigCallback;
+};
+
+#endif
@@ -0,0 +1,8 @@
+#ifndef WIFI_UDP_H
+#define WIFI_UDP_H
+
+// NTPClient takes the time from the host clock, so no UDP is needed
+class WiFiUDP {
+};
+
+#endif
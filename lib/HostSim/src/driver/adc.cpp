@@ -0,0 +1,124 @@
+#include "adc.h"
+
+#include <Arduino.h>
+
+// The motor follows the PWM duty of SIM_MOTOR_PIN in the direction set by the
+// H-bridge inputs. In the on-phase the terminal whose input is high reads
+// near full scale and the other one 0, in the off-phase the terminal on the
+// positive side of the back-EMF reads it and the other one 0.
+
+#define SIM_PWM_FREQUENCY 1000     // analogWrite() default on the ESP32
+#define SIM_MOTOR_TIME_CONSTANT 300000.0 // us to reach 63% of the target speed
+#define SIM_BEMF_FULL_SCALE 2048   // back-EMF reading at full speed
+#define SIM_ON_PHASE_LEVEL 3700
+#define SIM_MAX_PATTERN 4
+#define SIM_RESULT_BYTES sizeof(adc_digi_output_data_t)
+
+static adc_digi_init_config_t initConfig;
+static adc_digi_pattern_config_t patterns[SIM_MAX_PATTERN];
+static uint32_t patternCount = 0;
+static uint32_t sampleRate = 0;
+static bool running = false;
+static unsigned long lastRead = 0;
+static uint64_t sampleIndex = 0;
+static double motorSpeed = 0; // -1.0 - 1.0, positive when OUT4 is driven
+
+esp_err_t adc_digi_initialize(const adc_digi_init_config_t *init_config) {
+    initConfig = *init_config;
+    return ESP_OK;
+}
+
+esp_err_t adc_digi_controller_configure(const adc_digi_configuration_t *config) {
+    if (config->pattern_num == 0 || config->pattern_num > SIM_MAX_PATTERN || config->sample_freq_hz == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    for (uint32_t i = 0; i < config->pattern_num; i++) {
+        patterns[i] = config->adc_pattern[i];
+    }
+    patternCount = config->pattern_num;
+    sampleRate = config->sample_freq_hz;
+    return ESP_OK;
+}
+
+esp_err_t adc_digi_start() {
+    running = true;
+    lastRead = micros();
+    return ESP_OK;
+}
+
+esp_err_t adc_digi_stop() {
+    running = false;
+    return ESP_OK;
+}
+
+static int terminalValue(uint8_t channel, bool onPhase, bool in3, bool in4) {
+    bool out3 = (channel == SIM_SENSE_OUT3_CHANNEL);
+    bool out4 = (channel == SIM_SENSE_OUT4_CHANNEL);
+    if (onPhase) {
+        return ((out3 && in3) || (out4 && in4)) ? SIM_ON_PHASE_LEVEL : 0;
+    }
+    if (out4 && motorSpeed > 0) {
+        return (int)(motorSpeed * SIM_BEMF_FULL_SCALE);
+    }
+    if (out3 && motorSpeed < 0) {
+        return (int)(-motorSpeed * SIM_BEMF_FULL_SCALE);
+    }
+    return 0;
+}
+
+esp_err_t adc_digi_read_bytes(uint8_t *buf, uint32_t length_max, uint32_t *out_length, uint32_t timeout_ms) {
+    *out_length = 0;
+    if (!running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    unsigned long now = micros();
+    uint64_t pending = (uint64_t)(now - lastRead) * sampleRate / 1000000;
+    uint64_t capacity = initConfig.max_store_buf_size / SIM_RESULT_BYTES;
+    esp_err_t result = ESP_OK;
+    if (pending > capacity) {
+        // the DMA ring buffer overflowed, older samples are lost
+        pending = capacity;
+        result = ESP_ERR_INVALID_STATE;
+    }
+    if (pending == 0) {
+        return ESP_ERR_TIMEOUT;
+    }
+
+    uint32_t count = length_max / SIM_RESULT_BYTES;
+    if (count > pending) {
+        count = pending;
+    }
+    // only advance the clock by the samples handed out, the rest stays pending
+    lastRead = now - (unsigned long)((pending - count) * 1000000 / sampleRate);
+
+    int duty = simPinValue(SIM_MOTOR_PIN);
+    bool in3 = simPinValue(SIM_MOTOR_IN3);
+    bool in4 = simPinValue(SIM_MOTOR_IN4);
+    double direction = in4 == in3 ? 0 : (in4 ? 1 : -1);
+    double step = 1.0 / sampleRate * 1000000 / SIM_MOTOR_TIME_CONSTANT;
+    uint32_t samplesPerPeriod = sampleRate / SIM_PWM_FREQUENCY;
+
+    for (uint32_t i = 0; i < count; i++, sampleIndex++) {
+        motorSpeed += (direction * duty / 255.0 - motorSpeed) * step;
+
+        bool onPhase = (sampleIndex % samplesPerPeriod) < duty * samplesPerPeriod / 255;
+        const adc_digi_pattern_config_t &pattern = patterns[sampleIndex % patternCount];
+        int value = terminalValue(pattern.channel, onPhase, in3, in4) + (int)random(-8, 9);
+        value = value < 0 ? 0 : (value > 4095 ? 4095 : value);
+
+        adc_digi_output_data_t sample;
+        sample.val = 0;
+        sample.type2.data = value;
+        sample.type2.channel = pattern.channel;
+        sample.type2.unit = pattern.unit;
+        memcpy(&buf[i * SIM_RESULT_BYTES], &sample, SIM_RESULT_BYTES);
+    }
+    *out_length = count * SIM_RESULT_BYTES;
+    return result;
+}
+
+esp_err_t adc_digi_deinitialize() {
+    running = false;
+    return ESP_OK;
+}
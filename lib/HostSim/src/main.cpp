@@ -0,0 +1,19 @@
+#include <Arduino.h>
+#include <signal.h>
+
+// Arduino entry points of the firmware
+void setup();
+void loop();
+
+int main() {
+    signal(SIGPIPE, SIG_IGN);
+    setvbuf(stdout, nullptr, _IOLBF, 0);
+    simSetTaskName("loopTask");
+
+    setup();
+    for (;;) {
+        loop();
+        // yield like the idle task would, without it loop() spins a whole core
+        delayMicroseconds(100);
+    }
+}
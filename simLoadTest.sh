@@ -0,0 +1,24 @@
+pio run -e native && \
+pio run -e loadgen || exit 1
+
+# run on a copy of the web assets, the firmware writes config.json into LittleFS
+SIM_FS_ROOT=$(mktemp -d)
+cp -R data/. "$SIM_FS_ROOT"
+
+SIM_FS_ROOT="$SIM_FS_ROOT" .pio/build/native/program > sim.log 2>&1 &
+SIM_PID=$!
+trap 'kill $SIM_PID 2>/dev/null; rm -rf "$SIM_FS_ROOT"' EXIT
+
+# wait until the web server accepts requests, at most 10 seconds
+for i in $(seq 100); do
+    if curl -s -o /dev/null "http://127.0.0.1:8080/getSpeed"; then
+        break
+    fi
+    if ! kill -0 $SIM_PID 2>/dev/null || [ "$i" -eq 100 ]; then
+        echo "simulator did not start, see sim.log"
+        exit 1
+    fi
+    sleep 0.1
+done
+
+.pio/build/loadgen/program "$@"
@@ -0,0 +1,111 @@
+#include "Trace.h"
+
+#if TRACE_ENABLED
+
+TraceBuffer traceBuffers[portNUM_PROCESSORS];
+uint32_t tracePauseCount = 0;
+
+static uint32_t eventCount(const TraceBuffer& buffer) {
+    return buffer.head < TRACE_BUFFER_SIZE ? buffer.head : TRACE_BUFFER_SIZE;
+}
+
+static const TraceEvent& eventAt(const TraceBuffer& buffer, uint32_t i) {
+    uint32_t start = buffer.head - eventCount(buffer);
+    return buffer.events[(start + i) & (TRACE_BUFFER_SIZE - 1)];
+}
+
+void traceRecordEnd(const char* name, uint32_t duration) {
+    traceRecord(name, esp_timer_get_time() - duration, duration);
+}
+
+TraceJsonWriter::TraceJsonWriter() {
+    __atomic_fetch_add(&tracePauseCount, 1, __ATOMIC_RELAXED);
+
+    // collect the tasks so each one gets a named track
+    for (int c = 0; c < portNUM_PROCESSORS; c++) {
+        for (uint32_t i = 0; i < eventCount(traceBuffers[c]); i++) {
+            TaskHandle_t handle = eventAt(traceBuffers[c], i).task;
+            bool known = false;
+            for (int t = 0; t < taskCount; t++) {
+                known = known || tasks[t] == handle;
+            }
+            if (!known && taskCount < (int)(sizeof(tasks) / sizeof(tasks[0]))) {
+                tasks[taskCount++] = handle;
+            }
+        }
+    }
+}
+
+TraceJsonWriter::~TraceJsonWriter() {
+    __atomic_fetch_sub(&tracePauseCount, 1, __ATOMIC_RELAXED);
+}
+
+size_t TraceJsonWriter::read(uint8_t* buffer, size_t maxLen) {
+    size_t written = 0;
+    while (written < maxLen) {
+        if (lineOffset == lineLength) {
+            if (!nextLine()) {
+                break;
+            }
+        }
+        size_t n = lineLength - lineOffset;
+        if (n > maxLen - written) {
+            n = maxLen - written;
+        }
+        memcpy(buffer + written, line + lineOffset, n);
+        lineOffset += n;
+        written += n;
+    }
+    return written;
+}
+
+bool TraceJsonWriter::nextLine() {
+    lineOffset = 0;
+    lineLength = 0;
+    const char* separator = first ? "" : ",";
+    int n = 0;
+
+    while (n == 0) {
+        if (section == 0) {
+            n = snprintf(line, sizeof(line), "{\"traceEvents\":[");
+            section++;
+            continue;
+        }
+        if (section == 1) {
+            if (task < taskCount) {
+                n = snprintf(line, sizeof(line), "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%lu,\"args\":{\"name\":\"%s\"}}",
+                             separator, (unsigned long)(uintptr_t)tasks[task], pcTaskGetName(tasks[task]));
+                task++;
+                first = false;
+            } else {
+                section++;
+            }
+            continue;
+        }
+        if (section == 2) {
+            if (core >= portNUM_PROCESSORS) {
+                section++;
+            } else if (event >= eventCount(traceBuffers[core])) {
+                core++;
+                event = 0;
+            } else {
+                const TraceEvent& e = eventAt(traceBuffers[core], event++);
+                n = snprintf(line, sizeof(line), "%s{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%lld,\"dur\":%lu,\"pid\":0,\"tid\":%lu,\"args\":{\"core\":%d}}",
+                             separator, e.name, (long long)e.start, (unsigned long)e.duration, (unsigned long)(uintptr_t)e.task, core);
+                first = false;
+            }
+            continue;
+        }
+        if (section == 3) {
+            n = snprintf(line, sizeof(line), "],\"displayTimeUnit\":\"ms\"}");
+            section++;
+            continue;
+        }
+        return false;
+    }
+
+    lineLength = n < (int)sizeof(line) ? n : sizeof(line) - 1;
+    return true;
+}
+
+#endif
@@ -10,6 +10,10 @@
 #include <NTPClient.h>
 #include <WiFiUdp.h>
 #include <ArduinoJson.h>
+#include <memory>
+#include <driver/adc.h>
+#include "BackEmf.h"
+#include "Trace.h"
 
 #define ENB 4
 #define IN4 5
@@ -18,6 +22,24 @@
 #define OE 12
 #define RCLK 13
 #define SRCLK 14
+#define BEMF_OUT3 7 // motor terminal OUT3 through a voltage divider, ADC1 channel 6
+#define BEMF_OUT4 8 // motor terminal OUT4 through a voltage divider, ADC1 channel 7
+#define BEMF_OUT3_CHANNEL ADC1_CHANNEL_6
+#define BEMF_OUT4_CHANNEL ADC1_CHANNEL_7
+#define BEMF_PWM_FREQUENCY 1000 // analogWrite() default
+#define BEMF_SAMPLE_RATE 40000 // Hz per terminal, 40 samples per PWM period
+#define BEMF_BLANKING_SAMPLES 4 // 100us after each on-phase
+#define BEMF_MIN_OFF_SAMPLES 2 // measured samples needed per PWM period
+#define BEMF_SAMPLES_PER_PERIOD (BEMF_SAMPLE_RATE / BEMF_PWM_FREQUENCY)
+// highest duty whose off-phase can still be measured, ~216
+#define BEMF_MAX_DUTY (255 * (BEMF_SAMPLES_PER_PERIOD - BEMF_BLANKING_SAMPLES - BEMF_MIN_OFF_SAMPLES) / BEMF_SAMPLES_PER_PERIOD)
+// adc_digi_output_data_t is one 32 bit word on the ESP32-S3
+#define BEMF_RESULT_BYTES sizeof(adc_digi_output_data_t)
+
+// Set to 1 to let the measured speed correct the PWM value
+#ifndef BEMF_CLOSED_LOOP
+#define BEMF_CLOSED_LOOP 0
+#endif
 
 struct Config {
     char timeZoneOffset[64];
@@ -54,6 +76,11 @@ void getSpeedLimit(AsyncWebServerRequest *request);
 void forgetConfig(AsyncWebServerRequest *request);
 void setConfig(AsyncWebServerRequest *request);
 void reverseDirection(AsyncWebServerRequest *request);
+void getRealSpeed(AsyncWebServerRequest *request);
+void getTrace(AsyncWebServerRequest *request);
+void initBackEmf();
+void readBackEmf();
+void updateRealSpeed();
 
 WiFiManager wifiManager;
 AsyncWebServer server(80);
@@ -79,6 +106,19 @@ unsigned long lastTimeUpdate = 0;
 unsigned long updateInterval = 0.016666 * 60 * 1000; // Update interval: 30 minutes
 String currentLights="0"; // Previous lights status
 
+// Back-EMF: on-phase threshold, blanking samples, filter shift, full scale (calibrate to the loco)
+BackEmfEstimator backEmf({3000, BEMF_BLANKING_SAMPLES, 6, 2048});
+SpeedController speedController(64, 8, BEMF_MAX_DUTY);
+uint8_t bemfBuffer[256 * BEMF_RESULT_BYTES];
+uint16_t bemfOut3 = 0;
+uint32_t lastBemfSampleCount = 0;
+int realSpeed = -1; // -1 while unknown, e.g. at full duty there is no off-phase to measure
+unsigned long lastRealSpeedUpdate = 0;
+unsigned long realSpeedInterval = 20; // 50 Hz control loop
+int broadcastRealSpeed = -1;
+unsigned long lastRealSpeedBroadcast = 0;
+unsigned long realSpeedBroadcastInterval = 200;
+
 void initPins() {
     pinMode(IN4, OUTPUT);
     pinMode(IN3, OUTPUT);
@@ -176,11 +216,16 @@ void initWebserver() {
     server.on("/getLocalIP", HTTP_GET, getLocalIP);
     server.on("/getSpeed", HTTP_GET, getSpeed);
     server.on("/getSpeedLimit", HTTP_GET, getSpeedLimit);
+    server.on("/getRealSpeed", HTTP_GET, getRealSpeed);
     server.on("/forgetConfig", HTTP_GET, forgetConfig);
+#if TRACE_ENABLED
+    server.on("/trace", HTTP_GET, getTrace);
+#endif
     server.onNotFound(notFound);
 
     AsyncCallbackWebHandler* handler = new AsyncCallbackWebHandler();
     handler->onRequest( [](AsyncWebServerRequest *request) {
+        TRACE_SCOPE("serveFile");
         String path = request->url();
 
         if (path.endsWith("/")) {
@@ -211,6 +256,7 @@ void setup() {
     Serial.println("Train-Server initializing...");
 
     initPins();
+    initBackEmf();
     initFS();
     initWiFi();
     initWebserver();
@@ -226,12 +272,29 @@ void setup() {
 }
 
 void loop() {
-    webSocket.loop();
-    if (!timeClient.update()) {
+    TRACE_SCOPE("loop");
+    {
+        TRACE_SCOPE("webSocket.loop");
+        webSocket.loop();
+    }
+    {
+        TRACE_SCOPE("timeClient.update");
+        if (!timeClient.update()) {
+        }
+    }
+
+    {
+        TRACE_SCOPE("readBackEmf");
+        readBackEmf();
     }
 
     unsigned long currentMillis = millis();
 
+    if (currentMillis - lastRealSpeedUpdate >= realSpeedInterval) {
+        lastRealSpeedUpdate = currentMillis;
+        updateRealSpeed();
+    }
+
     int interval = 1000 * 60 * 10; // every 10 minutes;
     int testInterval = 1000 / 6; // 1 second == 1 hour
 
@@ -584,6 +647,7 @@ String byteToBinaryString(byte value) {
 }
 
 void updateShiftRegister(int brightness, String ledString) {
+    TRACE_SCOPE("updateShiftRegister");
     // reset array pointer
     if (leds != nullptr) {
         delete[] leds;
@@ -616,6 +680,111 @@ void updateShiftRegister(int brightness, String ledString) {
     digitalWrite(RCLK, HIGH);
 }
 
+void initBackEmf() {
+    adc_digi_init_config_t initConfig = {
+        .max_store_buf_size = 16384, // ~50ms of samples, enough to ride out a slow loop()
+        .conv_num_each_intr = 256,
+        .adc1_chan_mask = BIT(BEMF_OUT3_CHANNEL) | BIT(BEMF_OUT4_CHANNEL),
+        .adc2_chan_mask = 0,
+    };
+    if (adc_digi_initialize(&initConfig) != ESP_OK) {
+        Serial.println("An Error has occurred while initializing the back-EMF ADC");
+        return;
+    }
+
+    // alternate between both terminals, OUT3 first
+    adc_digi_pattern_config_t pattern[2] = {
+        {
+            .atten = ADC_ATTEN_DB_11,
+            .channel = BEMF_OUT3_CHANNEL,
+            .unit = 0, // ADC1
+            .bit_width = SOC_ADC_DIGI_MAX_BITWIDTH,
+        },
+        {
+            .atten = ADC_ATTEN_DB_11,
+            .channel = BEMF_OUT4_CHANNEL,
+            .unit = 0,
+            .bit_width = SOC_ADC_DIGI_MAX_BITWIDTH,
+        },
+    };
+    adc_digi_configuration_t digiConfig = {
+        .conv_limit_en = false, // only used by the ESP32 and ESP32-S2
+        .conv_limit_num = 250,
+        .pattern_num = 2,
+        .adc_pattern = pattern,
+        .sample_freq_hz = BEMF_SAMPLE_RATE * 2,
+        .conv_mode = ADC_CONV_SINGLE_UNIT_1,
+        .format = ADC_DIGI_OUTPUT_FORMAT_TYPE2,
+    };
+    adc_digi_controller_configure(&digiConfig);
+    adc_digi_start();
+}
+
+void readBackEmf() {
+    // drain everything the DMA has collected since the last loop
+    uint32_t length = 0;
+    esp_err_t result;
+    // IN4 high drives OUT4, so the back-EMF shows up on OUT4
+    bool forward = (digitalRead(IN4) == HIGH);
+    do {
+        result = adc_digi_read_bytes(bemfBuffer, sizeof(bemfBuffer), &length, 0);
+        // ESP_ERR_INVALID_STATE only signals an overrun, the data is still valid
+        if (result != ESP_OK && result != ESP_ERR_INVALID_STATE) {
+            return;
+        }
+        for (uint32_t i = 0; i < length; i += BEMF_RESULT_BYTES) {
+            adc_digi_output_data_t *sample = (adc_digi_output_data_t*)&bemfBuffer[i];
+            if (sample->type2.channel == BEMF_OUT3_CHANNEL) {
+                bemfOut3 = sample->type2.data;
+            } else if (sample->type2.channel == BEMF_OUT4_CHANNEL) {
+                // OUT4 completes a pair
+                uint16_t bemfOut4 = sample->type2.data;
+                if (forward) {
+                    backEmf.addSample(bemfOut4, bemfOut3);
+                } else {
+                    backEmf.addSample(bemfOut3, bemfOut4);
+                }
+            }
+        }
+    } while (length == sizeof(bemfBuffer));
+}
+
+void updateRealSpeed() {
+    // without fresh samples since the last update the filter only holds an old value
+    uint32_t sampleCount = backEmf.sampleCount();
+    bool fresh = (sampleCount != lastBemfSampleCount);
+    lastBemfSampleCount = sampleCount;
+    realSpeed = fresh ? backEmf.speed() : -1;
+
+#if BEMF_CLOSED_LOOP
+    if (fresh) {
+        analogWrite(ENB, speedController.update(globalSpeed, realSpeed));
+    } else {
+        analogWrite(ENB, speedController.hold(globalSpeed));
+    }
+#endif
+
+    unsigned long currentMillis = millis();
+    if (realSpeed != broadcastRealSpeed && currentMillis - lastRealSpeedBroadcast >= realSpeedBroadcastInterval) {
+        lastRealSpeedBroadcast = currentMillis;
+        broadcastRealSpeed = realSpeed;
+        // prefixed so clients can tell it apart from the plain set speed
+        String realSpeedTXT = "real:" + (realSpeed < 0 ? String("unknown") : String(realSpeed));
+        webSocket.broadcastTXT(realSpeedTXT);
+    }
+}
+
+#if TRACE_ENABLED
+void getTrace(AsyncWebServerRequest *request) {
+    // streamed in chunks, buffering the whole dump would need tens of KB of heap
+    std::shared_ptr<TraceJsonWriter> writer = std::make_shared<TraceJsonWriter>();
+    AsyncWebServerResponse *response = request->beginChunkedResponse("application/json", [writer](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+        return writer->read(buffer, maxLen);
+    });
+    request->send(response);
+}
+#endif
+
 void setBrightness(int b) {
     analogWrite(OE, 255 - b);
 }
@@ -637,14 +806,22 @@ String getContentType(String filename) {
 }
 
 void getLocalIP(AsyncWebServerRequest *request) {
+    TRACE_SCOPE("getLocalIP");
     request->send(200, "text/plain", WiFi.localIP().toString());
 }
 
 void getSpeed(AsyncWebServerRequest *request) {
+    TRACE_SCOPE("getSpeed");
     request->send(200, "text/plain", String(globalSpeed));
 }
 
+void getRealSpeed(AsyncWebServerRequest *request) {
+    TRACE_SCOPE("getRealSpeed");
+    request->send(200, "text/plain", realSpeed < 0 ? String("unknown") : String(realSpeed));
+}
+
 void getSpeedLimit(AsyncWebServerRequest *request) {
+    TRACE_SCOPE("getSpeedLimit");
     request->send(200, "text/plain", String(config.speedLimit));
 }
 
@@ -661,6 +838,7 @@ void forgetConfig(AsyncWebServerRequest *request) {
 }
 
 void setConfig(AsyncWebServerRequest *request) {
+    TRACE_SCOPE("setConfig");
     if (request->hasArg("speed")) {
         Serial.println("Set Config -> speed: " + request->arg("speed"));
         int speed = request->arg("speed").toInt();
@@ -692,12 +870,14 @@ void setConfig(AsyncWebServerRequest *request) {
 }
 
 void reverseDirection(AsyncWebServerRequest *request) {
+    TRACE_SCOPE("reverseDirection");
     String log = "reversed direction";
     Serial.println(log);
 
     bool currPin = (digitalRead(IN4) == HIGH);
     digitalWrite(IN4, !currPin);
     digitalWrite(IN3, currPin);
+    speedController.reset();
 
     request->send(200, "text/plain", log);
 }
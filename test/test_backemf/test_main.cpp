@@ -0,0 +1,208 @@
+#include <unity.h>
+#include "BackEmf.h"
+
+// Synthetic waveforms at the firmware's sampling: 40 samples per PWM period
+// and terminal, 4 blanking samples, back-EMF full scale 2048.
+
+#define SAMPLES_PER_PERIOD 40
+#define ON_PHASE_LEVEL 3700
+#define FULL_SCALE 2048
+#define MAX_DUTY (255 * (SAMPLES_PER_PERIOD - 4 - 2) / SAMPLES_PER_PERIOD)
+
+static const BackEmfConfig config = {3000, 4, 6, FULL_SCALE};
+
+static uint32_t noiseState = 1;
+
+static int noise(int amplitude) {
+    noiseState = noiseState * 1103515245 + 12345;
+    return (int)((noiseState >> 16) % (2 * amplitude + 1)) - amplitude;
+}
+
+static uint16_t clampSample(int value) {
+    return value < 0 ? 0 : (value > 4095 ? 4095 : value);
+}
+
+// Feeds the differential pair (driven, other). backEmf is positive when it
+// shows up on the driven terminal and negative when the motor still turns
+// the other way, so it shows up on the other terminal.
+static void feed(BackEmfEstimator& estimator, int duty, int backEmf, int periods, int noiseAmplitude = 0) {
+    for (int period = 0; period < periods; period++) {
+        for (int i = 0; i < SAMPLES_PER_PERIOD; i++) {
+            bool onPhase = i < duty * SAMPLES_PER_PERIOD / 255;
+            int driven = onPhase ? ON_PHASE_LEVEL : (backEmf > 0 ? backEmf : 0);
+            int other = onPhase ? 0 : (backEmf < 0 ? -backEmf : 0);
+            estimator.addSample(clampSample(driven + noise(noiseAmplitude)), clampSample(other + noise(noiseAmplitude)));
+        }
+    }
+}
+
+static int backEmfAt(int speed) {
+    return speed * FULL_SCALE / 255;
+}
+
+void setUp() {
+    noiseState = 1;
+}
+
+void tearDown() {
+}
+
+void test_estimate_follows_duty() {
+    const int duties[] = {0, 64, 128, 180, 200, MAX_DUTY};
+    for (int duty : duties) {
+        BackEmfEstimator estimator(config);
+        feed(estimator, duty, backEmfAt(duty), 200);
+        TEST_ASSERT_INT_WITHIN(2, duty, estimator.speed());
+    }
+}
+
+void test_estimate_with_noise() {
+    BackEmfEstimator estimator(config);
+    feed(estimator, 150, backEmfAt(150), 200, 24);
+    TEST_ASSERT_INT_WITHIN(4, 150, estimator.speed());
+}
+
+void test_no_fresh_samples_above_max_duty() {
+    BackEmfEstimator estimator(config);
+    feed(estimator, MAX_DUTY, backEmfAt(MAX_DUTY), 50);
+    uint32_t count = estimator.sampleCount();
+    TEST_ASSERT_TRUE(count > 0);
+
+    feed(estimator, 230, backEmfAt(230), 50);
+    TEST_ASSERT_EQUAL_UINT32(count, estimator.sampleCount());
+
+    feed(estimator, 255, backEmfAt(255), 50);
+    TEST_ASSERT_EQUAL_UINT32(count, estimator.sampleCount());
+}
+
+void test_reverse_step() {
+    BackEmfEstimator estimator(config);
+    feed(estimator, 150, backEmfAt(150), 200);
+    TEST_ASSERT_INT_WITHIN(2, 150, estimator.speed());
+
+    // right after reversing the motor still turns the old way
+    feed(estimator, 150, -backEmfAt(100), 200);
+    TEST_ASSERT_INT_WITHIN(2, 0, estimator.speed());
+
+    // then it runs in the new direction
+    feed(estimator, 150, backEmfAt(150), 200);
+    TEST_ASSERT_INT_WITHIN(2, 150, estimator.speed());
+}
+
+void test_controller_clamps_without_windup() {
+    SpeedController controller(64, 8, MAX_DUTY);
+    uint8_t output = 0;
+    for (int i = 0; i < 100; i++) {
+        output = controller.update(200, 0);
+    }
+    TEST_ASSERT_EQUAL_UINT8(MAX_DUTY, output);
+
+    // the integral didn't grow while saturated, so there is no overshoot
+    TEST_ASSERT_EQUAL_UINT8(200, controller.update(200, 200));
+}
+
+void test_controller_open_loop_above_max_duty() {
+    SpeedController controller(64, 8, MAX_DUTY);
+    controller.update(150, 100);
+    TEST_ASSERT_EQUAL_UINT8(230, controller.update(230, 0));
+    TEST_ASSERT_EQUAL_UINT8(255, controller.hold(255));
+    // leaving open loop starts without the old correction
+    TEST_ASSERT_EQUAL_UINT8(150, controller.update(150, 150));
+}
+
+void test_controller_hold_does_not_integrate() {
+    SpeedController controller(64, 8, MAX_DUTY);
+    for (int i = 0; i < 10; i++) {
+        controller.update(100, 90);
+    }
+    uint8_t held = controller.hold(100);
+    TEST_ASSERT_TRUE(held > 100);
+    for (int i = 0; i < 100; i++) {
+        TEST_ASSERT_EQUAL_UINT8(held, controller.hold(100));
+    }
+}
+
+void test_controller_reset() {
+    SpeedController controller(64, 8, MAX_DUTY);
+    for (int i = 0; i < 10; i++) {
+        controller.update(100, 50);
+    }
+    TEST_ASSERT_EQUAL_UINT8(0, controller.update(0, 50));
+    TEST_ASSERT_EQUAL_UINT8(100, controller.update(100, 100));
+
+    for (int i = 0; i < 10; i++) {
+        controller.update(100, 50);
+    }
+    controller.reset();
+    TEST_ASSERT_EQUAL_UINT8(100, controller.update(100, 100));
+}
+
+#ifdef ARDUINO
+#include <Arduino.h>
+
+#define TIMING_PERIODS 250
+#define TIMING_RUNS 5
+
+// Times the differential addSample() against BACK_EMF_SAMPLE_BUDGET_CYCLES.
+// The waveform is prepared up front so that only the loop and the call are
+// counted, the best of a few runs keeps interrupts out of the result.
+static void test_add_sample_within_budget() {
+    static uint16_t driven[SAMPLES_PER_PERIOD];
+    static uint16_t other[SAMPLES_PER_PERIOD];
+    for (int i = 0; i < SAMPLES_PER_PERIOD; i++) {
+        bool onPhase = i < 128 * SAMPLES_PER_PERIOD / 255;
+        driven[i] = clampSample((onPhase ? ON_PHASE_LEVEL : backEmfAt(128)) + noise(40));
+        other[i] = clampSample(noise(40));
+    }
+
+    BackEmfEstimator estimator(config);
+    uint32_t best = UINT32_MAX;
+    for (int run = 0; run < TIMING_RUNS; run++) {
+        uint32_t start = ESP.getCycleCount();
+        for (int period = 0; period < TIMING_PERIODS; period++) {
+            for (int i = 0; i < SAMPLES_PER_PERIOD; i++) {
+                estimator.addSample(driven[i], other[i]);
+            }
+        }
+        uint32_t cycles = ESP.getCycleCount() - start;
+        if (cycles < best) {
+            best = cycles;
+        }
+    }
+    uint32_t perSample = best / (TIMING_PERIODS * SAMPLES_PER_PERIOD);
+    Serial.printf("addSample: %u cycles per sample, budget %u\n", (unsigned) perSample, (unsigned) BACK_EMF_SAMPLE_BUDGET_CYCLES);
+
+    TEST_ASSERT_GREATER_THAN_UINT32(0, estimator.sampleCount());
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(BACK_EMF_SAMPLE_BUDGET_CYCLES, perSample);
+}
+#endif
+
+int runTests() {
+    UNITY_BEGIN();
+    RUN_TEST(test_estimate_follows_duty);
+    RUN_TEST(test_estimate_with_noise);
+    RUN_TEST(test_no_fresh_samples_above_max_duty);
+    RUN_TEST(test_reverse_step);
+    RUN_TEST(test_controller_clamps_without_windup);
+    RUN_TEST(test_controller_open_loop_above_max_duty);
+    RUN_TEST(test_controller_hold_does_not_integrate);
+    RUN_TEST(test_controller_reset);
+#ifdef ARDUINO
+    RUN_TEST(test_add_sample_within_budget);
+#endif
+    return UNITY_END();
+}
+
+#ifdef ARDUINO
+void setup() {
+    delay(2000); // give the serial monitor time to connect
+    runTests();
+}
+
+void loop() {
+}
+#else
+int main() {
+    return runTests();
+}
+#endif
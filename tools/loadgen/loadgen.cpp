@@ -0,0 +1,349 @@
+// Load generator for the host simulator (or a board on the network).
+// HTTP clients set speeds in a loop while WebSocket clients stay connected.
+// Each client owns its own speed values, so every broadcast a WebSocket
+// client receives can be matched to the request that caused it, which gives
+// the control-path latency. Prints p50/p99 latency and throughput and exits
+// with 1 if a request failed, fewer than half of the broadcasts arrived or a
+// p99 is above --max-p99-ms.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+typedef std::chrono::steady_clock Clock;
+
+struct Options {
+    const char *host = "127.0.0.1";
+    int httpPort = 8080;
+    int wsPort = 8081;
+    int httpClients = 8;
+    int wsClients = 4;
+    int duration = 10; // seconds
+    std::string path = "/config?speed={speed}"; // {speed} is replaced with 0-255
+    double maxP99 = 0; // ms, 0 disables the check
+};
+
+struct Samples {
+    std::mutex mutex;
+    std::vector<double> latencies; // ms
+    long errors = 0;
+
+    void add(const std::vector<double> &values, long errorCount) {
+        std::lock_guard<std::mutex> lock(mutex);
+        latencies.insert(latencies.end(), values.begin(), values.end());
+        errors += errorCount;
+    }
+};
+
+// Time each speed value was last requested, ns on the steady clock, 0 if never
+static std::atomic<int64_t> sentAt[256];
+
+static int64_t nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+}
+
+static double elapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+static double percentile(std::vector<double> &values, double p) {
+    if (values.empty()) {
+        return 0;
+    }
+    size_t index = static_cast<size_t>(p / 100.0 * (values.size() - 1) + 0.5);
+    std::nth_element(values.begin(), values.begin() + index, values.end());
+    return values[index];
+}
+
+static int connectTo(const char *host, int port) {
+    int s = socket(AF_INET, SOCK_STREAM, 0);
+    if (s < 0) {
+        return -1;
+    }
+    int noDelay = 1;
+    setsockopt(s, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    if (inet_pton(AF_INET, host, &address.sin_addr) != 1
+        || connect(s, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+        close(s);
+        return -1;
+    }
+    return s;
+}
+
+static bool sendAll(int s, const std::string &data) {
+    size_t sent = 0;
+    while (sent < data.length()) {
+        ssize_t n = send(s, data.data() + sent, data.length() - sent, MSG_NOSIGNAL);
+        if (n <= 0) {
+            return false;
+        }
+        sent += n;
+    }
+    return true;
+}
+
+// One GET on its own connection, the firmware closes after every response
+static bool httpGet(const Options &options, const std::string &target) {
+    int s = connectTo(options.host, options.httpPort);
+    if (s < 0) {
+        return false;
+    }
+    std::string request = "GET " + target + " HTTP/1.1\r\nHost: " + options.host + "\r\nConnection: close\r\n\r\n";
+    if (!sendAll(s, request)) {
+        close(s);
+        return false;
+    }
+
+    std::string response;
+    char buffer[4096];
+    ssize_t n;
+    while ((n = recv(s, buffer, sizeof(buffer), 0)) > 0) {
+        response.append(buffer, n);
+    }
+    close(s);
+    return response.compare(0, 12, "HTTP/1.1 200") == 0;
+}
+
+static std::string buildTarget(const std::string &path, int speed) {
+    static const std::string placeholder = "{speed}";
+    std::string target = path;
+    size_t position;
+    while ((position = target.find(placeholder)) != std::string::npos) {
+        target.replace(position, placeholder.length(), std::to_string(speed));
+    }
+    return target;
+}
+
+static void httpClient(const Options &options, int id, Clock::time_point end, Samples &samples) {
+    std::vector<double> latencies;
+    long errors = 0;
+
+    // this client's values are id, id + clients, id + 2 * clients, ...
+    int clients = std::min(options.httpClients, 256);
+    int first = id % clients;
+    int count = (256 - first + clients - 1) / clients;
+
+    for (int i = 0; Clock::now() < end; i++) {
+        int speed = first + (i % count) * clients;
+        std::string target = buildTarget(options.path, speed);
+        Clock::time_point start = Clock::now();
+        sentAt[speed] = nowNs();
+        if (httpGet(options, target)) {
+            latencies.push_back(elapsedMs(start));
+        } else {
+            errors++;
+        }
+    }
+    samples.add(latencies, errors);
+}
+
+// Matches a broadcast of a plain speed value to the request that set it
+static void recordBroadcast(const std::string &payload, std::vector<double> &latencies) {
+    if (payload.empty() || payload.length() > 3 || payload.find_first_not_of("0123456789") != std::string::npos) {
+        return; // e.g. "real:<n>"
+    }
+    int speed = atoi(payload.c_str());
+    if (speed > 255) {
+        return;
+    }
+    int64_t sent = sentAt[speed];
+    if (sent != 0) {
+        latencies.push_back((nowNs() - sent) / 1e6);
+    }
+}
+
+static void wsClient(const Options &options, Clock::time_point end, Samples &handshakes, Samples &control, std::atomic<long> &messages) {
+    Clock::time_point start = Clock::now();
+    int s = connectTo(options.host, options.wsPort);
+    if (s < 0) {
+        handshakes.add({}, 1);
+        return;
+    }
+    std::string request = std::string("GET / HTTP/1.1\r\nHost: ") + options.host + "\r\n"
+                          "Upgrade: websocket\r\nConnection: Upgrade\r\n"
+                          "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\nSec-WebSocket-Version: 13\r\n\r\n";
+    std::string buffer;
+    char chunk[4096];
+    ssize_t n;
+    bool upgraded = false;
+    if (sendAll(s, request)) {
+        // the firmware only serves the handshake from its loop(), so wait for it
+        while (Clock::now() < end) {
+            pollfd fd = {s, POLLIN, 0};
+            if (poll(&fd, 1, 100) <= 0) {
+                continue;
+            }
+            if ((n = recv(s, chunk, sizeof(chunk), 0)) <= 0) {
+                break;
+            }
+            buffer.append(chunk, n);
+            size_t headerEnd = buffer.find("\r\n\r\n");
+            if (headerEnd != std::string::npos) {
+                upgraded = buffer.compare(0, 12, "HTTP/1.1 101") == 0;
+                buffer.erase(0, headerEnd + 4);
+                break;
+            }
+        }
+    }
+    if (!upgraded) {
+        handshakes.add({}, 1);
+        close(s);
+        return;
+    }
+    handshakes.add({elapsedMs(start)}, 0);
+
+    // read unmasked server frames until the test ends
+    std::vector<double> latencies;
+    while (Clock::now() < end) {
+        while (buffer.length() >= 2) {
+            const uint8_t *data = reinterpret_cast<const uint8_t*>(buffer.data());
+            uint64_t length = data[1] & 0x7F;
+            size_t header = 2;
+            if (length == 126) {
+                if (buffer.length() < 4) break;
+                length = (data[2] << 8) | data[3];
+                header = 4;
+            } else if (length == 127) {
+                if (buffer.length() < 10) break;
+                length = 0;
+                for (int i = 0; i < 8; i++) {
+                    length = (length << 8) | data[2 + i];
+                }
+                header = 10;
+            }
+            if (buffer.length() < header + length) {
+                break;
+            }
+            if ((data[0] & 0x0F) == 0x1) {
+                recordBroadcast(buffer.substr(header, length), latencies);
+            }
+            buffer.erase(0, header + length);
+            messages++;
+        }
+
+        pollfd fd = {s, POLLIN, 0};
+        if (poll(&fd, 1, 100) <= 0) {
+            continue;
+        }
+        if ((n = recv(s, chunk, sizeof(chunk), 0)) <= 0) {
+            break;
+        }
+        buffer.append(chunk, n);
+    }
+    close(s);
+    control.add(latencies, 0);
+}
+
+static void usage(const char *name) {
+    fprintf(stderr,
+            "usage: %s [--host 127.0.0.1] [--http-port 8080] [--ws-port 8081]\n"
+            "          [--http-clients 8] [--ws-clients 4] [--duration 10]\n"
+            "          [--path '/config?speed={speed}'] [--max-p99-ms 0]\n", name);
+}
+
+static bool parseOptions(int argc, char **argv, Options &options) {
+    for (int i = 1; i < argc; i++) {
+        const char *name = argv[i];
+        if (i + 1 >= argc) {
+            return false;
+        }
+        const char *value = argv[++i];
+        if (strcmp(name, "--host") == 0) options.host = value;
+        else if (strcmp(name, "--http-port") == 0) options.httpPort = atoi(value);
+        else if (strcmp(name, "--ws-port") == 0) options.wsPort = atoi(value);
+        else if (strcmp(name, "--http-clients") == 0) options.httpClients = atoi(value);
+        else if (strcmp(name, "--ws-clients") == 0) options.wsClients = atoi(value);
+        else if (strcmp(name, "--duration") == 0) options.duration = atoi(value);
+        else if (strcmp(name, "--path") == 0) options.path = value;
+        else if (strcmp(name, "--max-p99-ms") == 0) options.maxP99 = atof(value);
+        else return false;
+    }
+    return true;
+}
+
+int main(int argc, char **argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        usage(argv[0]);
+        return 2;
+    }
+    signal(SIGPIPE, SIG_IGN);
+
+    printf("%d HTTP and %d WebSocket clients against %s for %ds\n",
+           options.httpClients, options.wsClients, options.host, options.duration);
+
+    Samples requests;
+    Samples handshakes;
+    Samples control;
+    std::atomic<long> messages(0);
+    Clock::time_point start = Clock::now();
+    Clock::time_point end = start + std::chrono::seconds(options.duration);
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < options.wsClients; i++) {
+        threads.emplace_back(wsClient, std::cref(options), end, std::ref(handshakes), std::ref(control), std::ref(messages));
+    }
+    for (int i = 0; i < options.httpClients; i++) {
+        threads.emplace_back(httpClient, std::cref(options), i, end, std::ref(requests));
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    double seconds = elapsedMs(start) / 1000.0;
+
+    size_t requestCount = requests.latencies.size();
+    double p50 = percentile(requests.latencies, 50);
+    double p99 = percentile(requests.latencies, 99);
+    printf("http: %zu requests, %ld errors, %.1f req/s, p50 %.3f ms, p99 %.3f ms\n",
+           requestCount, requests.errors, requestCount / seconds, p50, p99);
+
+    size_t handshakeCount = handshakes.latencies.size();
+    printf("ws:   %zu connected, %ld errors, handshake p50 %.3f ms, p99 %.3f ms, %ld messages, %.1f msg/s\n",
+           handshakeCount, handshakes.errors, percentile(handshakes.latencies, 50),
+           percentile(handshakes.latencies, 99), messages.load(), messages.load() / seconds);
+
+    size_t controlCount = control.latencies.size();
+    double controlP99 = percentile(control.latencies, 99);
+    printf("control: %zu broadcasts matched, request to broadcast p50 %.3f ms, p99 %.3f ms\n",
+           controlCount, percentile(control.latencies, 50), controlP99);
+
+    if (requests.errors > 0 || handshakes.errors > 0) {
+        printf("FAIL: %ld failed requests\n", requests.errors + handshakes.errors);
+        return 1;
+    }
+    // every speed request is broadcast to every connected client, so most of
+    // them have to arrive, otherwise the control p99 says nothing
+    size_t expected = requestCount * handshakeCount;
+    if (options.wsClients > 0 && options.path.find("{speed}") != std::string::npos && (controlCount == 0 || controlCount < expected / 2)) {
+        printf("FAIL: %zu of %zu broadcasts matched\n", controlCount, expected);
+        return 1;
+    }
+    if (options.maxP99 > 0 && p99 > options.maxP99) {
+        printf("FAIL: http p99 %.3f ms is above %.3f ms\n", p99, options.maxP99);
+        return 1;
+    }
+    if (options.maxP99 > 0 && controlP99 > options.maxP99) {
+        printf("FAIL: control p99 %.3f ms is above %.3f ms\n", controlP99, options.maxP99);
+        return 1;
+    }
+    return 0;
+}